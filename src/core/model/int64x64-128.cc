@@ -47,6 +47,30 @@ output_sign(const int128_t sa, const int128_t sb, uint128_t& ua, uint128_t& ub)
     return negA != negB;
 }
 
+/**
+ * \ingroup highprec
+ * Divide a 128-bit unsigned integer by a 64-bit one, when the quotient
+ * fits in 64 bits, using the hardware instruction where available.
+ *
+ * \param [in]  hi The most significant half of the dividend, which must be
+ *                  less than \pname{d}.
+ * \param [in]  lo The least significant half of the dividend.
+ * \param [in]  d The divisor.
+ * \returns The quotient.
+ */
+static inline uint64_t
+Udiv128By64(const uint64_t hi, const uint64_t lo, const uint64_t d)
+{
+#if defined(__x86_64__) && defined(__GNUC__)
+    uint64_t quo;
+    uint64_t rem;
+    __asm__("divq %4" : "=a"(quo), "=d"(rem) : "a"(lo), "d"(hi), "rm"(d));
+    return quo;
+#else
+    return static_cast<uint64_t>(((static_cast<uint128_t>(hi) << 64) | lo) / d);
+#endif
+}
+
 void
 int64x64_t::Mul(const int64x64_t& o)
 {
@@ -127,6 +151,21 @@ int64x64_t::Div(const int64x64_t& o)
 uint128_t
 int64x64_t::Udiv(const uint128_t a, const uint128_t b)
 {
+    if (!(b & HP_MASK_LO))
+    {
+        // Fast path for integer divisors, such as the bit rates and the
+        // integer scale factors: the Q64.64 quotient is simply a / d.
+        // The long division below reaches the same result, since it first
+        // shifts the 64 trailing zeros out of the divisor.
+        const uint64_t d = static_cast<uint64_t>(b >> 64);
+        const auto ah = static_cast<uint64_t>(a >> 64);
+        const auto al = static_cast<uint64_t>(a);
+        uint128_t result = ah / d;
+        result <<= 64;
+        result |= Udiv128By64(ah % d, al, d);
+        return result;
+    }
+
     uint128_t rem = a;
     uint128_t den = b;
     uint128_t quo = rem / den;
@@ -120,6 +120,14 @@ int64x64_t::Div(const int64x64_t& o)
 cairo_uint128_t
 int64x64_t::Udiv(const cairo_uint128_t a, const cairo_uint128_t b)
 {
+    if (b.lo == 0)
+    {
+        // Fast path for integer divisors: the Q64.64 quotient is simply
+        // a / b.hi.  The long division below reaches the same result, since
+        // it first shifts the 64 trailing zeros out of the divisor.
+        return _cairo_uint128_divrem(a, _cairo_uint64_to_uint128(b.hi)).quo;
+    }
+
     cairo_uint128_t den = b;
     cairo_uquorem128_t qr = _cairo_uint128_divrem(a, b);
     cairo_uint128_t result = qr.quo;
@@ -497,13 +497,24 @@ class Time
         }
         else
         {
-            value /= info->factor;
+            value = DivideByFactor(value, info->factor);
         }
         return Time(value);
     }
 
     inline static Time FromDouble(double value, Unit unit)
     {
+        Information* info = PeekInformation(unit);
+
+        NS_ASSERT_MSG(info->isValid, "Attempted a conversion from an unavailable unit.");
+
+        // Integer values (e.g., Seconds (1)) are converted exactly, and much
+        // faster, with integer arithmetic
+        if (info->fromMul && std::trunc(value) == value &&
+            std::fabs(value) < static_cast<double>(info->maxInteger))
+        {
+            return Time(static_cast<int64_t>(value) * info->factor);
+        }
         return From(int64x64_t(value), unit);
     }
 
@@ -513,6 +524,15 @@ class Time
 
         NS_ASSERT_MSG(info->isValid, "Attempted a conversion from an unavailable unit.");
 
+        if (info->fromMul && value.GetLow() == 0)
+        {
+            const int64_t high = value.GetHigh();
+            if (high <= info->maxInteger && high >= -info->maxInteger)
+            {
+                return Time(high * info->factor);
+            }
+        }
+
         // DO NOT REMOVE this temporary variable. It's here
         // to work around a compiler bug in gcc 3.4
         int64x64_t retval = value;
@@ -554,7 +574,7 @@ class Time
         }
         else
         {
-            v /= info->factor;
+            v = DivideByFactor(v, info->factor);
         }
         return v;
     }
@@ -573,7 +593,14 @@ class Time
         int64x64_t retval(m_data);
         if (info->toMul)
         {
-            retval *= info->timeTo;
+            if (m_data <= info->maxInteger && m_data >= -info->maxInteger)
+            {
+                retval = m_data * info->factor;
+            }
+            else
+            {
+                retval *= info->timeTo;
+            }
         }
         else
         {
@@ -626,6 +653,7 @@ class Time
         int64_t factor;      //!< Ratio of this unit / current unit
         int64x64_t timeTo;   //!< Multiplier to convert to this unit
         int64x64_t timeFrom; //!< Multiplier to convert from this unit
+        int64_t maxInteger;  //!< Largest value which can be multiplied by factor
         bool isValid;        //!< True if the current unit can be used
     };
 
@@ -658,6 +686,38 @@ class Time
         return &(PeekResolution()->info[timeUnit]);
     }
 
+    /**
+     * Divide by a conversion factor, rounding towards zero.
+     *
+     * The conversions between the units smaller than the second are by
+     * powers of ten: dividing by these constants lets the compiler replace
+     * the (slow) integer division by a multiplication.
+     *
+     * \tparam T \deduced The integer type of the value.
+     * \param [in] value The value to divide.
+     * \param [in] factor The conversion factor.
+     * \return The quotient of \pname{value} by \pname{factor}.
+     */
+    template <typename T>
+    static inline T DivideByFactor(T value, int64_t factor)
+    {
+        switch (factor)
+        {
+        case 1000:
+            return value / T{1000};
+        case 1000000:
+            return value / T{1000000};
+        case 1000000000:
+            return value / T{1000000000};
+        case 1000000000000:
+            return value / T{1000000000000};
+        case 1000000000000000:
+            return value / T{1000000000000000};
+        default:
+            return value / factor;
+        }
+    }
+
     /**
      *  Set the default resolution
      *
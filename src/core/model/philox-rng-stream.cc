@@ -0,0 +1,160 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "philox-rng-stream.h"
+
+#include "log.h"
+
+/**
+ * \file
+ * \ingroup rngimpl
+ * ns3::PhiloxRngStream implementation.
+ */
+
+namespace ns3
+{
+
+// Note:  Logging in this file is largely avoided due to the
+// number of calls that are made to these functions and the possibility
+// of causing recursions leading to stack overflow
+NS_LOG_COMPONENT_DEFINE("PhiloxRngStream");
+
+namespace
+{
+
+/** First round multiplier. */
+constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+/** Second round multiplier. */
+constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+/** First key schedule increment (golden ratio). */
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9;
+/** Second key schedule increment (sqrt(3) - 1). */
+constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+/** Number of rounds. */
+constexpr int PHILOX_ROUNDS = 10;
+/** Number of blocks processed together by the batch generator. */
+constexpr std::size_t PHILOX_LANES = 8;
+
+/**
+ * Convert two 32-bit words into a double uniformly distributed in (0, 1)
+ * with 53-bit resolution.
+ *
+ * \param [in] hi The most significant word.
+ * \param [in] lo The least significant word.
+ * \returns The uniform random number.
+ */
+inline double
+ToU01(uint32_t hi, uint32_t lo)
+{
+    uint64_t bits = ((static_cast<uint64_t>(hi) << 32) | lo) >> 11;
+    return (static_cast<double>(bits) + 0.5) * 0x1.0p-53;
+}
+
+} // namespace
+
+PhiloxRngStream::PhiloxRngStream(uint32_t seed, uint64_t stream, uint64_t substream)
+    : m_key{static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)},
+      m_seed(seed),
+      m_substream(static_cast<uint32_t>(substream)),
+      m_nextBlock(0),
+      m_buffered(0),
+      m_hasBuffered(false)
+{
+}
+
+PhiloxRngStream::Block
+PhiloxRngStream::Philox4x32(Block counter, Key key)
+{
+    for (int round = 0; round < PHILOX_ROUNDS; ++round)
+    {
+        uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * counter[0];
+        uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * counter[2];
+        counter = {static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+                   static_cast<uint32_t>(p1),
+                   static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+                   static_cast<uint32_t>(p0)};
+        key[0] += PHILOX_W0;
+        key[1] += PHILOX_W1;
+    }
+    return counter;
+}
+
+PhiloxRngStream::Block
+PhiloxRngStream::GenerateBlock(uint64_t index) const
+{
+    return Philox4x32(
+        {static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32), m_substream, m_seed},
+        m_key);
+}
+
+double
+PhiloxRngStream::RandU01()
+{
+    if (m_hasBuffered)
+    {
+        m_hasBuffered = false;
+        return m_buffered;
+    }
+    Block block = GenerateBlock(m_nextBlock++);
+    m_buffered = ToU01(block[2], block[3]);
+    m_hasBuffered = true;
+    return ToU01(block[0], block[1]);
+}
+
+void
+PhiloxRngStream::RandU01(std::span<double> values)
+{
+    std::size_t i = 0;
+    if (m_hasBuffered && !values.empty())
+    {
+        values[i++] = RandU01();
+    }
+
+    // Generate PHILOX_LANES blocks at a time, with the state laid out as
+    // structure of arrays so that the rounds can be vectorized.
+    while (values.size() - i >= 2 * PHILOX_LANES)
+    {
+        uint32_t c0[PHILOX_LANES];
+        uint32_t c1[PHILOX_LANES];
+        uint32_t c2[PHILOX_LANES];
+        uint32_t c3[PHILOX_LANES];
+        for (std::size_t lane = 0; lane < PHILOX_LANES; ++lane)
+        {
+            uint64_t index = m_nextBlock + lane;
+            c0[lane] = static_cast<uint32_t>(index);
+            c1[lane] = static_cast<uint32_t>(index >> 32);
+            c2[lane] = m_substream;
+            c3[lane] = m_seed;
+        }
+        Key key = m_key;
+        for (int round = 0; round < PHILOX_ROUNDS; ++round)
+        {
+            for (std::size_t lane = 0; lane < PHILOX_LANES; ++lane)
+            {
+                uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * c0[lane];
+                uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * c2[lane];
+                c0[lane] = static_cast<uint32_t>(p1 >> 32) ^ c1[lane] ^ key[0];
+                c1[lane] = static_cast<uint32_t>(p1);
+                c2[lane] = static_cast<uint32_t>(p0 >> 32) ^ c3[lane] ^ key[1];
+                c3[lane] = static_cast<uint32_t>(p0);
+            }
+            key[0] += PHILOX_W0;
+            key[1] += PHILOX_W1;
+        }
+        for (std::size_t lane = 0; lane < PHILOX_LANES; ++lane)
+        {
+            values[i + 2 * lane] = ToU01(c0[lane], c1[lane]);
+            values[i + 2 * lane + 1] = ToU01(c2[lane], c3[lane]);
+        }
+        m_nextBlock += PHILOX_LANES;
+        i += 2 * PHILOX_LANES;
+    }
+
+    for (; i < values.size(); ++i)
+    {
+        values[i] = RandU01();
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,89 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef PHILOX_RNG_STREAM_H
+#define PHILOX_RNG_STREAM_H
+
+#include "rng-engine.h"
+
+#include <array>
+#include <stdint.h>
+
+/**
+ * \file
+ * \ingroup rngimpl
+ * ns3::PhiloxRngStream declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup rngimpl
+ *
+ * \brief Counter-based Philox4x32-10 generator
+ *
+ * Philox4x32-10 is the counter-based generator described in
+ * J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw,
+ * "Parallel random numbers: as easy as 1, 2, 3", SC'11.
+ * Each output block of four 32-bit words is a bijective function of a
+ * 128-bit counter and a 64-bit key, therefore the n-th random number of a
+ * stream can be computed without computing the previous ones, and blocks
+ * can be generated independently of each other.
+ *
+ * The key holds the stream number, while the counter holds the seed, the
+ * (32 least significant bits of the) run number and the index of the
+ * block within the stream. Each block produces two uniform random numbers
+ * with 53-bit resolution, so that each stream can produce up to
+ * \f$2^{65}\f$ random numbers before wrapping around.
+ */
+class PhiloxRngStream : public RngEngine
+{
+  public:
+    /**
+     * Construct from explicit seed, stream and substream values.
+     *
+     * \param [in] seed The starting seed.
+     * \param [in] stream The stream number.
+     * \param [in] substream The sub-stream number.
+     */
+    PhiloxRngStream(uint32_t seed, uint64_t stream, uint64_t substream);
+
+    double RandU01() override;
+    void RandU01(std::span<double> values) override;
+
+    /** Counter or output block of the Philox4x32 generator. */
+    using Block = std::array<uint32_t, 4>;
+    /** Key of the Philox4x32 generator. */
+    using Key = std::array<uint32_t, 2>;
+
+    /**
+     * Apply the ten rounds of the Philox4x32 bijection.
+     *
+     * \param [in] counter The counter to encrypt.
+     * \param [in] key The key.
+     * \returns The random block associated with \pname{counter}.
+     */
+    static Block Philox4x32(Block counter, Key key);
+
+  private:
+    /**
+     * Compute the block associated with the given index in this stream.
+     *
+     * \param [in] index The index of the block.
+     * \returns The random block.
+     */
+    Block GenerateBlock(uint64_t index) const;
+
+    Key m_key;            //!< The key, i.e., the stream number
+    uint32_t m_seed;      //!< The seed, stored in the last counter word
+    uint32_t m_substream; //!< The substream, stored in the third counter word
+    uint64_t m_nextBlock; //!< The index of the next block to generate
+    double m_buffered;    //!< The second number of the last generated block
+    bool m_hasBuffered;   //!< Whether m_buffered has not been returned yet
+};
+
+} // namespace ns3
+
+#endif /* PHILOX_RNG_STREAM_H */
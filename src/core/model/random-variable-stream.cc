@@ -18,6 +18,7 @@
 #include "double.h"
 #include "integer.h"
 #include "log.h"
+#include "philox-rng-stream.h"
 #include "pointer.h"
 #include "rng-seed-manager.h"
 #include "rng-stream.h"
@@ -28,6 +29,7 @@
 #include <cmath>
 #include <iostream>
 #include <numbers>
+#include <vector>
 
 /**
  * \file
@@ -42,6 +44,27 @@ NS_LOG_COMPONENT_DEFINE("RandomVariableStream");
 
 NS_OBJECT_ENSURE_REGISTERED(RandomVariableStream);
 
+/**
+ * \ingroup randomvariable
+ * Create the random number generator selected by the
+ * \ref GlobalValueRngType "RngType" global value.
+ *
+ * \param [in] stream The stream number.
+ * \returns The new random number generator.
+ */
+static RngEngine*
+CreateRngEngine(uint64_t stream)
+{
+    switch (RngSeedManager::GetRngType())
+    {
+    case RngSeedManager::PHILOX4X32:
+        return new PhiloxRngStream(RngSeedManager::GetSeed(), stream, RngSeedManager::GetRun());
+    case RngSeedManager::MRG32K3A:
+    default:
+        return new RngStream(RngSeedManager::GetSeed(), stream, RngSeedManager::GetRun());
+    }
+}
+
 TypeId
 RandomVariableStream::GetTypeId()
 {
@@ -114,7 +137,7 @@ RandomVariableStream::SetStream(int64_t stream)
         uint64_t nextStream = RngSeedManager::GetNextStreamIndex();
         NS_ASSERT(nextStream <= ((1ULL) << 63));
         NS_LOG_INFO(GetInstanceTypeId().GetName() << " automatic stream: " << nextStream);
-        m_rng = new RngStream(RngSeedManager::GetSeed(), nextStream, RngSeedManager::GetRun());
+        m_rng = CreateRngEngine(nextStream);
     }
     else
     {
@@ -123,18 +146,28 @@ RandomVariableStream::SetStream(int64_t stream)
         uint64_t base = ((1ULL) << 63);
         uint64_t target = base + stream;
         NS_LOG_INFO(GetInstanceTypeId().GetName() << " configured stream: " << stream);
-        m_rng = new RngStream(RngSeedManager::GetSeed(), target, RngSeedManager::GetRun());
+        m_rng = CreateRngEngine(target);
     }
     m_stream = stream;
 }
 
+void
+RandomVariableStream::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    for (auto& value : values)
+    {
+        value = GetValue();
+    }
+}
+
 int64_t
 RandomVariableStream::GetStream() const
 {
     return m_stream;
 }
 
-RngStream*
+RngEngine*
 RandomVariableStream::Peek() const
 {
     return m_rng;
@@ -218,6 +251,26 @@ UniformRandomVariable::GetInteger()
     return v;
 }
 
+void
+UniformRandomVariable::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    Peek()->RandU01(values);
+    const double min = m_min;
+    const double max = m_max;
+    for (auto& v : values)
+    {
+        v = min + v * (max - min);
+    }
+    if (IsAntithetic())
+    {
+        for (auto& v : values)
+        {
+            v = min + (max - v);
+        }
+    }
+}
+
 NS_OBJECT_ENSURE_REGISTERED(ConstantRandomVariable);
 
 TypeId
@@ -443,6 +496,31 @@ ExponentialRandomVariable::GetValue()
     return GetValue(m_mean, m_bound);
 }
 
+void
+ExponentialRandomVariable::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    if (m_bound != 0)
+    {
+        // rejected values consume extra uniforms, draw them one at a time
+        RandomVariableStream::GetValues(values);
+        return;
+    }
+    Peek()->RandU01(values);
+    if (IsAntithetic())
+    {
+        for (auto& v : values)
+        {
+            v = (1 - v);
+        }
+    }
+    const double mean = m_mean;
+    for (auto& v : values)
+    {
+        v = -mean * std::log(v);
+    }
+}
+
 NS_OBJECT_ENSURE_REGISTERED(ParetoRandomVariable);
 
 TypeId
@@ -539,6 +617,32 @@ ParetoRandomVariable::GetValue()
     return GetValue(m_scale, m_shape, m_bound);
 }
 
+void
+ParetoRandomVariable::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    if (m_bound != 0)
+    {
+        // rejected values consume extra uniforms, draw them one at a time
+        RandomVariableStream::GetValues(values);
+        return;
+    }
+    Peek()->RandU01(values);
+    if (IsAntithetic())
+    {
+        for (auto& v : values)
+        {
+            v = (1 - v);
+        }
+    }
+    const double scale = m_scale;
+    const double exponent = 1.0 / m_shape;
+    for (auto& v : values)
+    {
+        v = (scale * (1.0 / std::pow(v, exponent)));
+    }
+}
+
 NS_OBJECT_ENSURE_REGISTERED(WeibullRandomVariable);
 
 TypeId
@@ -650,6 +754,32 @@ WeibullRandomVariable::GetValue()
     return GetValue(m_scale, m_shape, m_bound);
 }
 
+void
+WeibullRandomVariable::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    if (m_bound != 0)
+    {
+        // rejected values consume extra uniforms, draw them one at a time
+        RandomVariableStream::GetValues(values);
+        return;
+    }
+    Peek()->RandU01(values);
+    if (IsAntithetic())
+    {
+        for (auto& v : values)
+        {
+            v = (1 - v);
+        }
+    }
+    const double scale = m_scale;
+    const double exponent = 1.0 / m_shape;
+    for (auto& v : values)
+    {
+        v = scale * std::pow(-std::log(v), exponent);
+    }
+}
+
 NS_OBJECT_ENSURE_REGISTERED(NormalRandomVariable);
 
 const double NormalRandomVariable::INFINITE_VALUE = 1e307;
@@ -778,6 +908,65 @@ NormalRandomVariable::GetValue()
     return GetValue(m_mean, m_variance, m_bound);
 }
 
+void
+NormalRandomVariable::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    if (m_bound < INFINITE_VALUE)
+    {
+        // rejected values consume extra uniforms, draw them one at a time
+        RandomVariableStream::GetValues(values);
+        return;
+    }
+
+    std::size_t i = 0;
+    if (m_nextValid && !values.empty())
+    {
+        values[i++] = GetValue();
+    }
+
+    const double mean = m_mean;
+    const double stddev = std::sqrt(m_variance);
+    std::vector<double> u;
+    while (i < values.size())
+    {
+        // Draw as many candidate pairs as needed to fill the buffer if none is
+        // rejected, so that no more uniforms are consumed than GetValue() would
+        const std::size_t pairs = (values.size() - i + 1) / 2;
+        u.resize(2 * pairs);
+        Peek()->RandU01(u);
+        if (IsAntithetic())
+        {
+            for (auto& v : u)
+            {
+                v = (1 - v);
+            }
+        }
+        for (std::size_t p = 0; p < pairs; ++p)
+        {
+            double v1 = 2 * u[2 * p] - 1;
+            double v2 = 2 * u[2 * p + 1] - 1;
+            double w = v1 * v1 + v2 * v2;
+            // w == 0 yields NaN values, which GetValue() discards as out of bounds
+            if (w <= 1.0 && w > 0)
+            {
+                double y = std::sqrt((-2 * std::log(w)) / w);
+                values[i++] = mean + v1 * y * stddev;
+                if (i < values.size())
+                {
+                    values[i++] = mean + v2 * y * stddev;
+                }
+                else
+                {
+                    m_nextValid = true;
+                    m_y = y;
+                    m_v2 = v2;
+                }
+            }
+        }
+    }
+}
+
 NS_OBJECT_ENSURE_REGISTERED(LogNormalRandomVariable);
 
 TypeId
@@ -901,6 +1090,58 @@ LogNormalRandomVariable::GetValue()
     return GetValue(m_mu, m_sigma);
 }
 
+void
+LogNormalRandomVariable::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    std::size_t i = 0;
+    if (m_nextValid && !values.empty())
+    {
+        values[i++] = GetValue();
+    }
+
+    const double mu = m_mu;
+    const double sigma = m_sigma;
+    std::vector<double> u;
+    while (i < values.size())
+    {
+        // Draw as many candidate pairs as needed to fill the buffer if none is
+        // rejected, so that no more uniforms are consumed than GetValue() would
+        const std::size_t pairs = (values.size() - i + 1) / 2;
+        u.resize(2 * pairs);
+        Peek()->RandU01(u);
+        if (IsAntithetic())
+        {
+            for (auto& v : u)
+            {
+                v = (1 - v);
+            }
+        }
+        for (std::size_t p = 0; p < pairs; ++p)
+        {
+            double v1 = -1 + 2 * u[2 * p];
+            double v2 = -1 + 2 * u[2 * p + 1];
+            double r2 = v1 * v1 + v2 * v2;
+            if (r2 > 1.0 || r2 == 0)
+            {
+                continue;
+            }
+            double normal = std::sqrt(-2.0 * std::log(r2) / r2);
+            values[i++] = std::exp(sigma * (v1 * normal) + mu);
+            if (i < values.size())
+            {
+                values[i++] = std::exp(sigma * v2 * normal + mu);
+            }
+            else
+            {
+                m_nextValid = true;
+                m_normal = normal;
+                m_v2 = v2;
+            }
+        }
+    }
+}
+
 NS_OBJECT_ENSURE_REGISTERED(GammaRandomVariable);
 
 TypeId
@@ -1289,6 +1530,29 @@ TriangularRandomVariable::GetValue()
     return GetValue(m_mean, m_min, m_max);
 }
 
+void
+TriangularRandomVariable::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    Peek()->RandU01(values);
+    if (IsAntithetic())
+    {
+        for (auto& v : values)
+        {
+            v = (1 - v);
+        }
+    }
+    const double min = m_min;
+    const double max = m_max;
+    const double mode = 3.0 * m_mean - min - max;
+    const double threshold = (mode - min) / (max - min);
+    for (auto& v : values)
+    {
+        v = (v <= threshold) ? min + std::sqrt(v * (max - min) * (mode - min))
+                             : max - std::sqrt((1 - v) * (max - min) * (max - mode));
+    }
+}
+
 NS_OBJECT_ENSURE_REGISTERED(ZipfRandomVariable);
 
 TypeId
@@ -1620,6 +1884,41 @@ EmpiricalRandomVariable::GetValue()
     return value;
 }
 
+void
+EmpiricalRandomVariable::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    if (!m_validated)
+    {
+        Validate();
+    }
+    Peek()->RandU01(values);
+    if (IsAntithetic())
+    {
+        for (auto& v : values)
+        {
+            v = (1 - v);
+        }
+    }
+    const auto& [firstCdf, firstValue] = *m_empCdf.begin();
+    const auto& [lastCdf, lastValue] = *m_empCdf.rbegin();
+    for (auto& v : values)
+    {
+        if (v <= firstCdf)
+        {
+            v = firstValue;
+        }
+        else if (v >= lastCdf)
+        {
+            v = lastValue;
+        }
+        else
+        {
+            v = m_interpolate ? DoInterpolate(v) : DoSampleCDF(v);
+        }
+    }
+}
+
 double
 EmpiricalRandomVariable::DoSampleCDF(double r)
 {
@@ -2040,6 +2339,27 @@ LargestExtremeValueRandomVariable::GetValue()
     return GetValue(m_location, m_scale);
 }
 
+void
+LargestExtremeValueRandomVariable::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    NS_ABORT_MSG_IF(m_scale <= 0, "Scale parameter should be larger than 0");
+    Peek()->RandU01(values);
+    if (IsAntithetic())
+    {
+        for (auto& v : values)
+        {
+            v = (1 - v);
+        }
+    }
+    const double location = m_location;
+    const double scale = m_scale;
+    for (auto& v : values)
+    {
+        v = location - (scale * std::log(std::log(v) * (-1.0)));
+    }
+}
+
 double
 LargestExtremeValueRandomVariable::GetMean(double location, double scale)
 {
@@ -20,6 +20,7 @@
 #include "type-id.h"
 
 #include <map>
+#include <span>
 #include <stdint.h>
 
 /**
@@ -61,7 +62,7 @@ namespace ns3
  *   section on how to perform independent replications.
  */
 
-class RngStream;
+class RngEngine;
 
 /**
  * \ingroup randomvariable
@@ -69,7 +70,9 @@ class RngStream;
  *
  * \note The underlying random number generation method used
  * by ns-3 is the RngStream code by Pierre L'Ecuyer at
- * the University of Montreal.
+ * the University of Montreal.  The counter-based Philox4x32-10
+ * generator can be selected instead through the ns3::GlobalValue
+ * \ref GlobalValueRngType "RngType".
  *
  * ns-3 has a rich set of random number generators that allow stream
  * numbers to be set deterministically if desired.  Class
@@ -143,16 +146,30 @@ class RandomVariableStream : public Object
     // The base implementation returns `(uint32_t)GetValue()`
     virtual uint32_t GetInteger();
 
+    /**
+     * \brief Fill a buffer with the next random values drawn from the distribution.
+     *
+     * The values are exactly those that would be returned by as many
+     * consecutive calls to GetValue(), so that batch and single draws
+     * can be interleaved without affecting reproducibility.  The base
+     * implementation calls GetValue() for each element; subclasses
+     * override it to draw all the underlying uniform random numbers at
+     * once and to apply their transform in a vectorizable loop.
+     *
+     * \param [out] values The buffer to fill.
+     */
+    virtual void GetValues(std::span<double> values);
+
   protected:
     /**
-     * \brief Get the pointer to the underlying RngStream.
-     * \return The underlying RngStream
+     * \brief Get the pointer to the underlying random number generator.
+     * \return The underlying random number generator
      */
-    RngStream* Peek() const;
+    RngEngine* Peek() const;
 
   private:
-    /** Pointer to the underlying RngStream. */
-    RngStream* m_rng;
+    /** Pointer to the underlying random number generator. */
+    RngEngine* m_rng;
 
     /** Indicates if antithetic values should be generated by this RNG stream. */
     bool m_isAntithetic;
@@ -273,6 +290,8 @@ class UniformRandomVariable : public RandomVariableStream
      */
     uint32_t GetInteger() override;
 
+    void GetValues(std::span<double> values) override;
+
   private:
     /** The lower bound on values that can be returned by this RNG stream. */
     double m_min;
@@ -582,6 +601,7 @@ class ExponentialRandomVariable : public RandomVariableStream
     // Inherited
     double GetValue() override;
     using RandomVariableStream::GetInteger;
+    void GetValues(std::span<double> values) override;
 
   private:
     /** The mean value of the unbounded exponential distribution. */
@@ -718,6 +738,7 @@ class ParetoRandomVariable : public RandomVariableStream
     // Inherited
     double GetValue() override;
     using RandomVariableStream::GetInteger;
+    void GetValues(std::span<double> values) override;
 
   private:
     /** The scale parameter for the Pareto distribution returned by this RNG stream. */
@@ -878,6 +899,7 @@ class WeibullRandomVariable : public RandomVariableStream
     // Inherited
     double GetValue() override;
     using RandomVariableStream::GetInteger;
+    void GetValues(std::span<double> values) override;
 
   private:
     /** The scale parameter for the Weibull distribution returned by this RNG stream. */
@@ -1020,6 +1042,7 @@ class NormalRandomVariable : public RandomVariableStream
     // Inherited
     double GetValue() override;
     using RandomVariableStream::GetInteger;
+    void GetValues(std::span<double> values) override;
 
   private:
     /** The mean value for the normal distribution returned by this RNG stream. */
@@ -1171,6 +1194,7 @@ class LogNormalRandomVariable : public RandomVariableStream
     // Inherited
     double GetValue() override;
     using RandomVariableStream::GetInteger;
+    void GetValues(std::span<double> values) override;
 
   private:
     /** The mu value for the log-normal distribution returned by this RNG stream. */
@@ -1555,6 +1579,7 @@ class TriangularRandomVariable : public RandomVariableStream
     // Inherited
     double GetValue() override;
     using RandomVariableStream::GetInteger;
+    void GetValues(std::span<double> values) override;
 
   private:
     /** The mean value for the triangular distribution returned by this RNG stream. */
@@ -2003,6 +2028,7 @@ class EmpiricalRandomVariable : public RandomVariableStream
      */
     double GetValue() override;
     using RandomVariableStream::GetInteger;
+    void GetValues(std::span<double> values) override;
 
     /**
      * \brief Returns the next value in the empirical distribution using
@@ -2462,6 +2488,7 @@ class LargestExtremeValueRandomVariable : public RandomVariableStream
     // Inherited
     double GetValue() override;
     using RandomVariableStream::GetInteger;
+    void GetValues(std::span<double> values) override;
 
     /**
      * \brief Returns the mean value for the Largest Extreme Value distribution returned by this RNG
@@ -0,0 +1,67 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef RNG_ENGINE_H
+#define RNG_ENGINE_H
+
+#include <span>
+
+/**
+ * \file
+ * \ingroup rngimpl
+ * ns3::RngEngine declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup rngimpl
+ *
+ * \brief Interface of the uniform pseudo-random number generators
+ * underlying every RandomVariableStream.
+ *
+ * Each RandomVariableStream owns one engine, whose type is selected by
+ * the \ref GlobalValueRngType "RngType" global value when the stream
+ * number is assigned.
+ */
+class RngEngine
+{
+  public:
+    /** Destructor. */
+    virtual ~RngEngine() = default;
+
+    /**
+     * Generate the next random number for this stream.
+     * Uniformly distributed between 0 and 1 (both excluded).
+     *
+     * \returns The next random.
+     */
+    virtual double RandU01() = 0;
+
+    /**
+     * Fill \pname{values} with the next random numbers of this stream.
+     *
+     * The numbers written are exactly those that would be returned by
+     * as many consecutive calls to RandU01(), hence batch and single
+     * draws can be freely interleaved without affecting reproducibility.
+     * The base implementation simply calls RandU01() for each element.
+     *
+     * \param [out] values The buffer to fill.
+     */
+    virtual void RandU01(std::span<double> values);
+};
+
+inline void
+RngEngine::RandU01(std::span<double> values)
+{
+    for (auto& value : values)
+    {
+        value = RandU01();
+    }
+}
+
+} // namespace ns3
+
+#endif /* RNG_ENGINE_H */
@@ -9,6 +9,7 @@
 
 #include "attribute-helper.h"
 #include "config.h"
+#include "enum.h"
 #include "global-value.h"
 #include "log.h"
 #include "uinteger.h"
@@ -59,6 +60,24 @@ static ns3::GlobalValue g_rngRun("RngRun",
                                  ns3::UintegerValue(1),
                                  ns3::MakeUintegerChecker<uint64_t>());
 
+/**
+ * \relates RngSeedManager
+ * \anchor GlobalValueRngType
+ * The random number generator backing all rng streams.  The default
+ * MRG32k3a generator advances its state sequentially, while the
+ * counter-based Philox4x32-10 generator computes each block of random
+ * numbers independently, which makes bulk generation much faster.
+ *
+ * This is accessible as "--RngType" from CommandLine.
+ */
+static ns3::GlobalValue g_rngType("RngType",
+                                  "The random number generator used by all rng streams",
+                                  ns3::EnumValue(RngSeedManager::MRG32K3A),
+                                  ns3::MakeEnumChecker(RngSeedManager::MRG32K3A,
+                                                       "MRG32k3a",
+                                                       RngSeedManager::PHILOX4X32,
+                                                       "Philox4x32"));
+
 uint32_t
 RngSeedManager::GetSeed()
 {
@@ -92,6 +111,22 @@ RngSeedManager::GetRun()
     return run;
 }
 
+void
+RngSeedManager::SetRngType(RngType type)
+{
+    NS_LOG_FUNCTION(type);
+    Config::SetGlobal("RngType", EnumValue(type));
+}
+
+RngSeedManager::RngType
+RngSeedManager::GetRngType()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    EnumValue<RngType> value;
+    g_rngType.GetValue(value);
+    return value.Get();
+}
+
 uint64_t
 RngSeedManager::GetNextStreamIndex()
 {
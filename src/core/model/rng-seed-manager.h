@@ -28,6 +28,16 @@ namespace ns3
 class RngSeedManager
 {
   public:
+    /**
+     * The pseudo-random number generators available to back the
+     * RandomVariableStream instances.
+     */
+    enum RngType
+    {
+        MRG32K3A,  //!< Combined multiple-recursive generator (RngStream), the default
+        PHILOX4X32 //!< Counter-based Philox4x32-10 generator (PhiloxRngStream)
+    };
+
     /**
      * \brief Set the seed.
      *
@@ -88,6 +98,23 @@ class RngSeedManager
      */
     static uint64_t GetRun();
 
+    /**
+     * \brief Set the type of the underlying random number generator.
+     *
+     * Like the seed and the run number, the generator type must be set
+     * before the random variables are created (more precisely, before
+     * their stream number is assigned).
+     *
+     * \param [in] type The generator type.
+     */
+    static void SetRngType(RngType type);
+    /**
+     * \brief Get the type of the underlying random number generator.
+     * \returns The generator type.
+     * \see SetRngType
+     */
+    static RngType GetRngType();
+
     /**
      * Get the next automatically assigned stream index.
      * \returns The next stream index.
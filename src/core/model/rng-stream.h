@@ -7,6 +7,8 @@
 
 #ifndef RNGSTREAM_H
 #define RNGSTREAM_H
+#include "rng-engine.h"
+
 #include <stdint.h>
 #include <string>
 
@@ -35,7 +37,7 @@ namespace ns3
  * class are explained in:
  * http://www.iro.umontreal.ca/~lecuyer/myftp/papers/streams00.pdf
  */
-class RngStream
+class RngStream : public RngEngine
 {
   public:
     /**
@@ -58,7 +60,8 @@ class RngStream
      *
      * \returns The next random.
      */
-    double RandU01();
+    double RandU01() override;
+    using RngEngine::RandU01;
 
   private:
     /**
@@ -12,6 +12,7 @@
 #include <cmath>  // fabs, round
 #include <iomanip>
 #include <limits> // numeric_limits<>::epsilon ()
+#include <vector>
 
 #ifdef __WIN32__
 /**
@@ -1499,6 +1500,104 @@ Int64x64DoubleTestCase::DoRun()
     std::cout.flags(ff);
 }
 
+/**
+ * \ingroup int64x64-tests
+ *
+ * Test: division by an integer-valued divisor.
+ *
+ * Dividing by a number with no fractional part is the common case
+ * (e.g. converting a bit count into a duration with a DataRate), and
+ * is handled by a dedicated fast path in some implementations.
+ * Check the result against the definition of the truncated quotient.
+ */
+class Int64x64IntegerDivisorTestCase : public TestCase
+{
+  public:
+    Int64x64IntegerDivisorTestCase();
+    void DoRun() override;
+    /**
+     * Check the quotient of \pname{a} by \pname{divisor}.
+     * \param a The dividend.
+     * \param divisor The integer divisor.
+     */
+    void Check(const int64x64_t a, const int64_t divisor);
+};
+
+Int64x64IntegerDivisorTestCase::Int64x64IntegerDivisorTestCase()
+    : TestCase("Division by integer divisors")
+{
+}
+
+void
+Int64x64IntegerDivisorTestCase::Check(const int64x64_t a, const int64_t divisor)
+{
+    const int64x64_t d(divisor);
+    const int64x64_t q = a / d;
+
+    // |a| - |q| * |d| must be in [0, |d| * 2^-64)
+    const int64x64_t remainder = Abs(a) - Abs(q) * Abs(d);
+    const int64x64_t bound(0, static_cast<uint64_t>(divisor < 0 ? -divisor : divisor));
+
+    NS_TEST_EXPECT_MSG_EQ((remainder >= 0),
+                          true,
+                          "Quotient too large: " << a << " / " << divisor << " = " << q);
+    NS_TEST_EXPECT_MSG_EQ((remainder < bound),
+                          true,
+                          "Quotient too small: " << a << " / " << divisor << " = " << q);
+    NS_TEST_EXPECT_MSG_EQ(((q < 0) == ((a < 0) != (divisor < 0)) || q == 0),
+                          true,
+                          "Wrong sign: " << a << " / " << divisor << " = " << q);
+}
+
+void
+Int64x64IntegerDivisorTestCase::DoRun()
+{
+    std::cout << std::endl;
+    std::cout << GetParent()->GetName() << " Integer divisor: " << GetName() << std::endl;
+
+    const std::vector<int64x64_t> dividends{
+        int64x64_t(0, 1),
+        int64x64_t(1, 0),
+        int64x64_t(3, 0x5555555555555555ULL),
+        int64x64_t(1000000, 0x8000000000000000ULL),
+        int64x64_t(12000, 0),
+        int64x64_t(0x7fffffffffffffffLL, 0xffffffffffffffffULL),
+        int64x64_t(-1, 0),
+        int64x64_t(-12000, 0),
+        int64x64_t(-123456789, 0x0123456789abcdefULL),
+    };
+    const std::vector<int64_t> divisors{
+        1,
+        2,
+        3,
+        7,
+        1000,
+        54000000,
+        1000000000,
+        1000000000000000LL,
+        0x7fffffffffffffffLL,
+        -1,
+        -3,
+        -1000000000,
+    };
+
+    // The long double implementation rounds the quotient instead
+    if (int64x64_t::implementation != int64x64_t::ld_impl)
+    {
+        for (const auto& a : dividends)
+        {
+            for (auto divisor : divisors)
+            {
+                Check(a, divisor);
+            }
+        }
+    }
+
+    NS_TEST_EXPECT_MSG_EQ(int64x64_t(12000) / int64x64_t(1000), int64x64_t(12), "12000 / 1000");
+    NS_TEST_EXPECT_MSG_EQ(int64x64_t(-15) / int64x64_t(4), int64x64_t(-3.75), "-15 / 4");
+    NS_TEST_EXPECT_MSG_EQ(int64x64_t(1) / int64x64_t(2), int64x64_t(0.5), "1 / 2");
+}
+
 /**
  * \ingroup int64x64-tests
  *
@@ -1588,6 +1687,7 @@ class Int64x64TestSuite : public TestSuite
         AddTestCase(new Int64x64Bug863TestCase(), TestCase::Duration::QUICK);
         AddTestCase(new Int64x64Bug1786TestCase(), TestCase::Duration::QUICK);
         AddTestCase(new Int64x64InvertTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new Int64x64IntegerDivisorTestCase(), TestCase::Duration::QUICK);
         AddTestCase(new Int64x64DoubleTestCase(), TestCase::Duration::QUICK);
     }
 };
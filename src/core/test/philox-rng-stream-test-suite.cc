@@ -0,0 +1,278 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/object-factory.h"
+#include "ns3/philox-rng-stream.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/test.h"
+
+#include <sstream>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup core-tests
+ * \ingroup rng-tests
+ * Counter-based Philox4x32-10 generator and bulk sampling tests.
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup rng-tests
+ * Check the Philox4x32-10 bijection against the known answer vectors
+ * published with the Random123 library.
+ */
+class PhiloxKnownAnswerTestCase : public TestCase
+{
+  public:
+    PhiloxKnownAnswerTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+PhiloxKnownAnswerTestCase::PhiloxKnownAnswerTestCase()
+    : TestCase("Philox4x32-10 known answer vectors")
+{
+}
+
+void
+PhiloxKnownAnswerTestCase::DoRun()
+{
+    struct Vector
+    {
+        PhiloxRngStream::Block counter;
+        PhiloxRngStream::Key key;
+        PhiloxRngStream::Block expected;
+    };
+
+    const std::vector<Vector> vectors{
+        {{0, 0, 0, 0}, {0, 0}, {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}},
+        {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+         {0xffffffff, 0xffffffff},
+         {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}},
+        {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+         {0xa4093822, 0x299f31d0},
+         {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}},
+    };
+
+    for (const auto& v : vectors)
+    {
+        auto result = PhiloxRngStream::Philox4x32(v.counter, v.key);
+        for (std::size_t i = 0; i < result.size(); ++i)
+        {
+            NS_TEST_EXPECT_MSG_EQ(result[i], v.expected[i], "Unexpected word " << i);
+        }
+    }
+}
+
+/**
+ * \ingroup rng-tests
+ * Check that filling a buffer with RandomVariableStream::GetValues() returns
+ * the same sequence as repeated calls to GetValue(), for every generator type.
+ */
+class BulkSamplingReproducibilityTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param type The generator type to test.
+     * \param name The generator name.
+     */
+    BulkSamplingReproducibilityTestCase(RngSeedManager::RngType type, std::string name);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Compare the values returned by interleaved batch and single draws
+     * with those returned by single draws only.
+     * \param factory The factory configured to create the random variable.
+     */
+    void CheckDistribution(ObjectFactory factory);
+
+    RngSeedManager::RngType m_type; //!< The generator type to test
+};
+
+BulkSamplingReproducibilityTestCase::BulkSamplingReproducibilityTestCase(
+    RngSeedManager::RngType type,
+    std::string name)
+    : TestCase("GetValues() matches GetValue() with the " + name + " generator"),
+      m_type(type)
+{
+}
+
+void
+BulkSamplingReproducibilityTestCase::CheckDistribution(ObjectFactory factory)
+{
+    const std::size_t count = 1001;
+    const auto name = factory.GetTypeId().GetName();
+
+    for (bool antithetic : {false, true})
+    {
+        factory.Set("Antithetic", BooleanValue(antithetic));
+        auto single = factory.Create<RandomVariableStream>();
+        auto bulk = factory.Create<RandomVariableStream>();
+        if (auto empirical = DynamicCast<EmpiricalRandomVariable>(single))
+        {
+            for (auto rv : {empirical, DynamicCast<EmpiricalRandomVariable>(bulk)})
+            {
+                rv->CDF(1.0, 0.1);
+                rv->CDF(2.0, 0.5);
+                rv->CDF(4.0, 0.9);
+                rv->CDF(8.0, 1.0);
+            }
+        }
+        single->SetStream(17);
+        bulk->SetStream(17);
+
+        std::vector<double> expected(count);
+        for (auto& value : expected)
+        {
+            value = single->GetValue();
+        }
+
+        // odd-sized and interleaved batches exercise the partially consumed
+        // generator blocks and the values cached by the pairwise algorithms
+        std::vector<double> values(count);
+        values[0] = bulk->GetValue();
+        bulk->GetValues(std::span(values).subspan(1, 45));
+        values[46] = bulk->GetValue();
+        bulk->GetValues(std::span(values).subspan(47, 3));
+        bulk->GetValues(std::span(values).subspan(50));
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            NS_TEST_EXPECT_MSG_EQ(values[i],
+                                  expected[i],
+                                  name << " (antithetic: " << antithetic << ") mismatch at index "
+                                       << i);
+        }
+        NS_TEST_EXPECT_MSG_EQ(bulk->GetValue(),
+                              single->GetValue(),
+                              name << " (antithetic: " << antithetic << ") streams diverged");
+    }
+}
+
+void
+BulkSamplingReproducibilityTestCase::DoRun()
+{
+    auto savedType = RngSeedManager::GetRngType();
+    RngSeedManager::SetRngType(m_type);
+
+    const std::vector<std::string> factories{
+        "ns3::UniformRandomVariable[Min=-3|Max=7]",
+        "ns3::ExponentialRandomVariable[Mean=2.5]",
+        "ns3::ExponentialRandomVariable[Mean=2.5|Bound=4]",
+        "ns3::ParetoRandomVariable[Scale=1.5|Shape=2.2]",
+        "ns3::ParetoRandomVariable[Scale=1.5|Shape=2.2|Bound=10]",
+        "ns3::WeibullRandomVariable[Scale=3|Shape=1.5]",
+        "ns3::WeibullRandomVariable[Scale=3|Shape=1.5|Bound=5]",
+        "ns3::NormalRandomVariable[Mean=5|Variance=4]",
+        "ns3::NormalRandomVariable[Mean=5|Variance=4|Bound=3]",
+        "ns3::LogNormalRandomVariable[Mu=1|Sigma=0.5]",
+        "ns3::TriangularRandomVariable[Mean=2|Min=1|Max=4]",
+        "ns3::EmpiricalRandomVariable[Interpolate=false]",
+        "ns3::EmpiricalRandomVariable[Interpolate=true]",
+        "ns3::LargestExtremeValueRandomVariable[Location=1|Scale=2]",
+        // the base implementation loops over GetValue()
+        "ns3::GammaRandomVariable[Alpha=2|Beta=3]",
+    };
+
+    for (const auto& description : factories)
+    {
+        ObjectFactory factory;
+        std::istringstream(description) >> factory;
+        CheckDistribution(factory);
+    }
+
+    RngSeedManager::SetRngType(savedType);
+}
+
+/**
+ * \ingroup rng-tests
+ * Check that Philox streams and runs are distinct and that the mean of the
+ * generated numbers is about one half.
+ */
+class PhiloxStreamsTestCase : public TestCase
+{
+  public:
+    PhiloxStreamsTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+PhiloxStreamsTestCase::PhiloxStreamsTestCase()
+    : TestCase("Philox4x32-10 streams and runs")
+{
+}
+
+void
+PhiloxStreamsTestCase::DoRun()
+{
+    const std::size_t count = 100000;
+
+    PhiloxRngStream a(1, 0, 1);
+    PhiloxRngStream b(1, 1, 1);
+    PhiloxRngStream c(1, 0, 2);
+    PhiloxRngStream d(2, 0, 1);
+
+    std::vector<double> values(count);
+    a.RandU01(values);
+    double sum = 0;
+    for (auto value : values)
+    {
+        NS_TEST_ASSERT_MSG_GT(value, 0, "Value not in (0, 1)");
+        NS_TEST_ASSERT_MSG_LT(value, 1, "Value not in (0, 1)");
+        sum += value;
+    }
+    NS_TEST_EXPECT_MSG_EQ_TOL(sum / count, 0.5, 0.01, "Unexpected mean");
+
+    std::size_t equal = 0;
+    for (auto value : values)
+    {
+        auto vb = b.RandU01();
+        auto vc = c.RandU01();
+        auto vd = d.RandU01();
+        equal += (vb == value) + (vc == value) + (vd == value);
+    }
+    NS_TEST_EXPECT_MSG_EQ(equal, 0, "Streams, runs or seeds are correlated");
+}
+
+/**
+ * \ingroup rng-tests
+ * Philox4x32-10 generator test suite.
+ */
+class PhiloxRngStreamTestSuite : public TestSuite
+{
+  public:
+    PhiloxRngStreamTestSuite();
+};
+
+PhiloxRngStreamTestSuite::PhiloxRngStreamTestSuite()
+    : TestSuite("philox-rng-stream", Type::UNIT)
+{
+    AddTestCase(new PhiloxKnownAnswerTestCase);
+    AddTestCase(new PhiloxStreamsTestCase);
+    AddTestCase(new BulkSamplingReproducibilityTestCase(RngSeedManager::MRG32K3A, "MRG32k3a"));
+    AddTestCase(new BulkSamplingReproducibilityTestCase(RngSeedManager::PHILOX4X32, "Philox4x32"));
+}
+
+/**
+ * \ingroup rng-tests
+ * PhiloxRngStreamTestSuite instance variable.
+ */
+static PhiloxRngStreamTestSuite g_philoxRngStreamTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
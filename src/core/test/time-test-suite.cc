@@ -523,6 +523,69 @@ TimeInputOutputTestCase::DoRun()
     CheckAs(t * 1e+8, "+9.961925y");
 }
 
+/**
+ * \ingroup core-tests
+ * \brief Check the conversions between Time and values in a given unit
+ */
+class TimeUnitConversionTestCase : public TestCase
+{
+  public:
+    /**
+     * \brief Constructor for TimeUnitConversionTestCase.
+     */
+    TimeUnitConversionTestCase();
+
+  private:
+    /**
+     * \brief DoRun for TimeUnitConversionTestCase.
+     */
+    void DoRun() override;
+};
+
+TimeUnitConversionTestCase::TimeUnitConversionTestCase()
+    : TestCase("Conversions from and to values in a given unit")
+{
+}
+
+void
+TimeUnitConversionTestCase::DoRun()
+{
+    // integer values, converted with integer arithmetic
+    NS_TEST_EXPECT_MSG_EQ(Seconds(3).GetTimeStep(), 3000000000, "Seconds (integer)");
+    NS_TEST_EXPECT_MSG_EQ(Seconds(-2).GetTimeStep(), -2000000000, "Seconds (negative)");
+    NS_TEST_EXPECT_MSG_EQ(Seconds(0.0).GetTimeStep(), 0, "Seconds (zero)");
+    NS_TEST_EXPECT_MSG_EQ(Seconds(-0.0).GetTimeStep(), 0, "Seconds (negative zero)");
+    NS_TEST_EXPECT_MSG_EQ(Minutes(2), Seconds(120), "Minutes");
+    NS_TEST_EXPECT_MSG_EQ(Hours(-1), Seconds(-3600), "Hours");
+    NS_TEST_EXPECT_MSG_EQ(Seconds(9223372036).GetTimeStep(),
+                          9223372036000000000,
+                          "Largest number of seconds");
+    NS_TEST_EXPECT_MSG_EQ(MilliSeconds(int64x64_t(-7)).GetTimeStep(),
+                          -7000000,
+                          "MilliSeconds (int64x64_t)");
+    NS_TEST_EXPECT_MSG_EQ(Time("100us"), MicroSeconds(100), "Time from string");
+
+    // fractional values, converted with int64x64_t arithmetic
+    NS_TEST_EXPECT_MSG_EQ(Seconds(0.5), MilliSeconds(500), "Seconds (fraction)");
+    NS_TEST_EXPECT_MSG_EQ(Seconds(1.1).GetTimeStep(), 1100000000, "Seconds (inexact fraction)");
+    NS_TEST_EXPECT_MSG_EQ(NanoSeconds(int64x64_t(-2.5)).GetTimeStep(), -3, "Rounding");
+    NS_TEST_EXPECT_MSG_EQ(MicroSeconds(int64x64_t(1.5)).GetTimeStep(),
+                          1500,
+                          "MicroSeconds (int64x64_t)");
+    NS_TEST_EXPECT_MSG_EQ(PicoSeconds(1500).GetTimeStep(), 1, "PicoSeconds");
+
+    // conversions to smaller units are truncated towards zero
+    NS_TEST_EXPECT_MSG_EQ(NanoSeconds(1999).GetMicroSeconds(), 1, "GetMicroSeconds");
+    NS_TEST_EXPECT_MSG_EQ(NanoSeconds(-1999).GetMicroSeconds(), -1, "GetMicroSeconds (negative)");
+    NS_TEST_EXPECT_MSG_EQ(Seconds(-1.5).GetMilliSeconds(), -1500, "GetMilliSeconds");
+    NS_TEST_EXPECT_MSG_EQ(NanoSeconds(-123456789012345).GetMilliSeconds(),
+                          -123456789,
+                          "GetMilliSeconds (large)");
+    NS_TEST_EXPECT_MSG_EQ(MicroSeconds(3).To(Time::PS), int64x64_t(3000000), "To picoseconds");
+    NS_TEST_EXPECT_MSG_EQ(NanoSeconds(-3).To(Time::FS), int64x64_t(-3000000), "To femtoseconds");
+    NS_TEST_EXPECT_MSG_EQ(NanoSeconds(1500).To(Time::US), int64x64_t(1.5), "To microseconds");
+}
+
 /**
  * \ingroup core-tests
  * \brief   Time test Suite.  Runs the appropriate test cases for time
@@ -535,6 +598,7 @@ static class TimeTestSuite : public TestSuite
     {
         AddTestCase(new TimeWithSignTestCase(), TestCase::Duration::QUICK);
         AddTestCase(new TimeInputOutputTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new TimeUnitConversionTestCase(), TestCase::Duration::QUICK);
         // This should be last, since it changes the resolution
         AddTestCase(new TimeSimpleTestCase(), TestCase::Duration::QUICK);
     }
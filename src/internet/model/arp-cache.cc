@@ -9,6 +9,7 @@
 
 #include "ipv4-header.h"
 #include "ipv4-interface.h"
+#include "mac-address-key.h"
 
 #include "ns3/assert.h"
 #include "ns3/log.h"
@@ -19,6 +20,9 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+#include <map>
+
 namespace ns3
 {
 
@@ -186,40 +190,46 @@ void
 ArpCache::HandleWaitReplyTimeout()
 {
     NS_LOG_FUNCTION(this);
-    ArpCache::Entry* entry;
     bool restartWaitReplyTimer = false;
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    // only the entries which have been marked WaitReply are visited, in
+    // address order as they would be by a scan of the whole cache
+    for (auto i = m_waitReply.begin(); i != m_waitReply.end();)
     {
-        entry = (*i).second;
-        if (entry != nullptr && entry->IsWaitReply())
+        auto it = m_arpCache.find(*i);
+        ArpCache::Entry* entry = (it != m_arpCache.end()) ? it->second : nullptr;
+        if (entry == nullptr || !entry->IsWaitReply())
         {
-            if (entry->GetRetries() < m_maxRetries)
-            {
-                NS_LOG_LOGIC("node=" << m_device->GetNode()->GetId() << ", ArpWaitTimeout for "
-                                     << entry->GetIpv4Address()
-                                     << " expired -- retransmitting arp request since retries = "
-                                     << entry->GetRetries());
-                m_arpRequestCallback(this, entry->GetIpv4Address());
-                restartWaitReplyTimer = true;
-                entry->IncrementRetries();
-            }
-            else
+            i = m_waitReply.erase(i);
+            continue;
+        }
+        if (entry->GetRetries() < m_maxRetries)
+        {
+            NS_LOG_LOGIC("node=" << m_device->GetNode()->GetId() << ", ArpWaitTimeout for "
+                                 << entry->GetIpv4Address()
+                                 << " expired -- retransmitting arp request since retries = "
+                                 << entry->GetRetries());
+            m_arpRequestCallback(this, entry->GetIpv4Address());
+            restartWaitReplyTimer = true;
+            entry->IncrementRetries();
+            ++i;
+        }
+        else
+        {
+            NS_LOG_LOGIC("node=" << m_device->GetNode()->GetId() << ", wait reply for "
+                                 << entry->GetIpv4Address()
+                                 << " expired -- drop since max retries exceeded: "
+                                 << entry->GetRetries());
+            entry->MarkDead();
+            entry->ClearRetries();
+            Ipv4PayloadHeaderPair pending = entry->DequeuePending();
+            while (pending.first)
             {
-                NS_LOG_LOGIC("node=" << m_device->GetNode()->GetId() << ", wait reply for "
-                                     << entry->GetIpv4Address()
-                                     << " expired -- drop since max retries exceeded: "
-                                     << entry->GetRetries());
-                entry->MarkDead();
-                entry->ClearRetries();
-                Ipv4PayloadHeaderPair pending = entry->DequeuePending();
-                while (pending.first)
-                {
-                    // add the Ipv4 header for tracing purposes
-                    pending.first->AddHeader(pending.second);
-                    m_dropTrace(pending.first);
-                    pending = entry->DequeuePending();
-                }
+                // add the Ipv4 header for tracing purposes
+                pending.first->AddHeader(pending.second);
+                m_dropTrace(pending.first);
+                pending = entry->DequeuePending();
             }
+            i = m_waitReply.erase(i);
         }
     }
     if (restartWaitReplyTimer)
@@ -239,6 +249,8 @@ ArpCache::Flush()
         delete (*i).second;
     }
     m_arpCache.erase(m_arpCache.begin(), m_arpCache.end());
+    m_macIndex.clear();
+    m_waitReply.clear();
     if (m_waitReplyTimer.IsPending())
     {
         NS_LOG_LOGIC("Stopping WaitReplyTimer at " << Simulator::Now().GetSeconds()
@@ -253,7 +265,9 @@ ArpCache::PrintArpCache(Ptr<OutputStreamWrapper> stream)
     NS_LOG_FUNCTION(this << stream);
     std::ostream* os = stream->GetStream();
 
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    // print the entries in address order
+    std::map<Ipv4Address, ArpCache::Entry*> sorted(m_arpCache.begin(), m_arpCache.end());
+    for (auto i = sorted.begin(); i != sorted.end(); i++)
     {
         *os << i->first << " dev ";
         std::string found = Names::FindName(m_device);
@@ -300,6 +314,7 @@ ArpCache::RemoveAutoGeneratedEntries()
         if (i->second->IsAutoGenerated())
         {
             i->second->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
+            RemoveFromMacIndex(i->second);
             delete i->second;
             m_arpCache.erase(i++);
             continue;
@@ -314,14 +329,18 @@ ArpCache::LookupInverse(Address to)
     NS_LOG_FUNCTION(this << to);
 
     std::list<ArpCache::Entry*> entryList;
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    auto [begin, end] = m_macIndex.equal_range(GetMacKey(to));
+    for (auto i = begin; i != end; i++)
     {
-        ArpCache::Entry* entry = (*i).second;
+        ArpCache::Entry* entry = i->second;
         if (entry->GetMacAddress() == to)
         {
             entryList.push_back(entry);
         }
     }
+    entryList.sort([](ArpCache::Entry* a, ArpCache::Entry* b) {
+        return a->GetIpv4Address() < b->GetIpv4Address();
+    });
     return entryList;
 }
 
@@ -346,6 +365,7 @@ ArpCache::Add(Ipv4Address to)
     auto entry = new ArpCache::Entry(this);
     m_arpCache[to] = entry;
     entry->SetIpv4Address(to);
+    AddToMacIndex(entry);
     return entry;
 }
 
@@ -354,17 +374,45 @@ ArpCache::Remove(ArpCache::Entry* entry)
 {
     NS_LOG_FUNCTION(this << entry);
 
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    auto i = m_arpCache.find(entry->GetIpv4Address());
+    if (i == m_arpCache.end() || i->second != entry)
+    {
+        // the address of the entry has been changed after its insertion
+        i = std::find_if(m_arpCache.begin(), m_arpCache.end(), [entry](const auto& item) {
+            return item.second == entry;
+        });
+    }
+    if (i != m_arpCache.end())
     {
-        if ((*i).second == entry)
+        m_arpCache.erase(i);
+        RemoveFromMacIndex(entry);
+        entry->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
+        delete entry;
+        return;
+    }
+    NS_LOG_WARN("Entry not found in this ARP Cache");
+}
+
+void
+ArpCache::AddToMacIndex(ArpCache::Entry* entry)
+{
+    NS_LOG_FUNCTION(this << entry);
+    m_macIndex.emplace(GetMacKey(entry->GetMacAddress()), entry);
+}
+
+void
+ArpCache::RemoveFromMacIndex(ArpCache::Entry* entry)
+{
+    NS_LOG_FUNCTION(this << entry);
+    auto [begin, end] = m_macIndex.equal_range(GetMacKey(entry->GetMacAddress()));
+    for (auto i = begin; i != end; i++)
+    {
+        if (i->second == entry)
         {
-            m_arpCache.erase(i);
-            entry->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
-            delete entry;
+            m_macIndex.erase(i);
             return;
         }
     }
-    NS_LOG_WARN("Entry not found in this ARP Cache");
 }
 
 ArpCache::Entry::Entry(ArpCache* arp)
@@ -425,7 +473,7 @@ ArpCache::Entry::MarkAlive(Address macAddress)
 {
     NS_LOG_FUNCTION(this << macAddress);
     NS_ASSERT(m_state == WAIT_REPLY);
-    m_macAddress = macAddress;
+    SetMacAddress(macAddress);
     m_state = ALIVE;
     ClearRetries();
     UpdateSeen();
@@ -481,6 +529,7 @@ ArpCache::Entry::MarkWaitReply(Ipv4PayloadHeaderPair waiting)
     m_state = WAIT_REPLY;
     m_pending.push_back(waiting);
     UpdateSeen();
+    m_arp->m_waitReply.insert(m_ipv4Address);
     m_arp->StartWaitReplyTimer();
 }
 
@@ -495,7 +544,9 @@ void
 ArpCache::Entry::SetMacAddress(Address macAddress)
 {
     NS_LOG_FUNCTION(this);
+    m_arp->RemoveFromMacIndex(this);
     m_macAddress = macAddress;
+    m_arp->AddToMacIndex(this);
 }
 
 Ipv4Address
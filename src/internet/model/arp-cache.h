@@ -21,8 +21,10 @@
 #include "ns3/traced-callback.h"
 
 #include <list>
-#include <map>
+#include <set>
 #include <stdint.h>
+#include <string>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -37,6 +39,10 @@ class Ipv4Header;
  *
  * A cached lookup table for translating layer 3 addresses to layer 2.
  * This implementation does lookups from IPv4 to a MAC address
+ *
+ * The entries are hashed by IPv4 address and indexed by MAC address, as
+ * both lookups are done for every packet.  The entries waiting for a reply
+ * are tracked apart, so that the WaitReply timer does not scan the cache.
  */
 class ArpCache : public Object
 {
@@ -310,11 +316,11 @@ class ArpCache : public Object
     /**
      * \brief ARP Cache container
      */
-    typedef std::map<Ipv4Address, ArpCache::Entry*> Cache;
+    typedef std::unordered_map<Ipv4Address, ArpCache::Entry*, Ipv4AddressHash> Cache;
     /**
      * \brief ARP Cache container iterator
      */
-    typedef std::map<Ipv4Address, ArpCache::Entry*>::iterator CacheI;
+    typedef Cache::iterator CacheI;
 
     void DoDispose() override;
 
@@ -334,8 +340,24 @@ class ArpCache : public Object
      * If there are no Arp requests pending, this event is not scheduled.
      */
     void HandleWaitReplyTimeout();
-    uint32_t m_pendingQueueSize; //!< number of packets waiting for a resolution
-    Cache m_arpCache;            //!< the ARP cache
+
+    /**
+     * \brief Index an entry by its MAC address
+     * \param entry the entry
+     */
+    void AddToMacIndex(ArpCache::Entry* entry);
+
+    /**
+     * \brief Remove an entry from the MAC address index
+     * \param entry the entry
+     */
+    void RemoveFromMacIndex(ArpCache::Entry* entry);
+
+    uint32_t m_pendingQueueSize;       //!< number of packets waiting for a resolution
+    Cache m_arpCache;                  //!< the ARP cache
+    std::set<Ipv4Address> m_waitReply; //!< addresses of the entries possibly in WaitReply state
+    std::unordered_multimap<std::string, ArpCache::Entry*>
+        m_macIndex; //!< the entries, indexed by the bytes of their MAC address
     TracedCallback<Ptr<const Packet>>
         m_dropTrace; //!< trace for packets dropped by the ARP cache queue
 };
@@ -19,6 +19,7 @@
 #include <list>
 #include <map>
 #include <queue>
+#include <set>
 #include <stdint.h>
 #include <vector>
 
@@ -28,7 +29,9 @@ namespace ns3
 const uint32_t SPF_INFINITY = 0xffffffff; //!< "infinite" distance between nodes
 
 class CandidateQueue;
+class Ipv4;
 class Ipv4GlobalRouting;
+class Node;
 
 /**
  * \ingroup globalrouting
@@ -661,6 +664,30 @@ class GlobalRouteManagerLSDB
      */
     uint32_t GetNumExtLSAs() const;
 
+    /**
+     * @brief Create a deep copy of this Link State Database.
+     *
+     * The SPF computation stores its state in the LSAs, hence SPF computations
+     * running concurrently must each use their own copy of the database.
+     *
+     * @returns A pointer to the new database, owned by the caller.
+     */
+    GlobalRouteManagerLSDB* Copy() const;
+
+    /**
+     * @brief Compare this Link State Database with another one.
+     *
+     * The link state IDs of the LSAs which are only found in one of the two
+     * databases, or whose content differs, are returned.  The external LSAs
+     * are compared as a whole: if they differ, \p extChanged is set to true.
+     *
+     * @param other The database to compare with.
+     * @param extChanged Set to true if the external LSAs differ.
+     * @returns The link state IDs of the LSAs which differ.
+     */
+    std::set<Ipv4Address> GetChangedLSAs(const GlobalRouteManagerLSDB& other,
+                                         bool& extChanged) const;
+
   private:
     typedef std::map<Ipv4Address, GlobalRoutingLSA*>
         LSDBMap_t; //!< container of IPv4 addresses / Link State Advertisements
@@ -670,6 +697,8 @@ class GlobalRouteManagerLSDB
     LSDBMap_t m_database; //!< database of IPv4 addresses / Link State Advertisements
     std::vector<GlobalRoutingLSA*>
         m_extdatabase; //!< database of External Link State Advertisements
+    std::map<Ipv4Address, LSDBMap_t::iterator>
+        m_linkDataIndex; //!< LSAs owning a TransitNetwork link record, by LinkData
 };
 
 /**
@@ -714,6 +743,22 @@ class GlobalRouteManagerImpl
      */
     virtual void InitializeRoutes();
 
+    /**
+     * @brief Rebuild the routing database and recompute the routes after a
+     * change in the topology.
+     *
+     * By default, this is equivalent to calling DeleteGlobalRoutes (),
+     * BuildGlobalRoutingDatabase () and InitializeRoutes () in sequence.  If the
+     * \ref GlobalValueGlobalRoutingIncremental "GlobalRoutingIncremental" global
+     * value is true, the new Link State Database is compared with the previous
+     * one and only the routes which may have been affected by the changes are
+     * recomputed: the routing tables of the stub routers (i.e., routers with a
+     * single point-to-point link to another router) are left untouched if neither
+     * their LSA nor the LSA of their neighbor changed, while the routes of the
+     * other routers are recomputed if any LSA changed.
+     */
+    virtual void UpdateGlobalRoutes();
+
     /**
      * @brief Debugging routine; allow client code to supply a pre-built LSDB
      * @param lsdb the pre-built LSDB
@@ -727,8 +772,69 @@ class GlobalRouteManagerImpl
     void DebugSPFCalculate(Ipv4Address root);
 
   private:
+    /**
+     * @brief The objects of the node at the root of an SPF computation, to which
+     * the computed routes are written.
+     */
+    struct SPFRoot
+    {
+        Ipv4Address routerId;           //!< the router ID of the node
+        Ptr<Node> node;                 //!< the node
+        Ptr<Ipv4> ipv4;                 //!< the Ipv4 interface of the node
+        Ptr<Ipv4GlobalRouting> routing; //!< the global routing protocol of the node
+    };
+
     SPFVertex* m_spfroot;           //!< the root node
     GlobalRouteManagerLSDB* m_lsdb; //!< the Link State DataBase (LSDB) of the Global Route Manager
+    SPFRoot m_root;                 //!< the objects of the root node during SPF computations
+
+    /**
+     * \brief Find the node with the given router ID and its routing objects.
+     *
+     * If there is no such node, the returned node and objects are null.
+     *
+     * \param routerId the router ID
+     * \returns the objects of the node
+     */
+    SPFRoot FindSPFRoot(Ipv4Address routerId) const;
+
+    /**
+     * \brief Collect the nodes of this system for which routes are computed.
+     *
+     * \returns the objects of the nodes
+     */
+    std::vector<SPFRoot> GetSPFRoots() const;
+
+    /**
+     * \brief Remove all the routes of a global routing protocol.
+     *
+     * \param node the node of the routing protocol
+     * \param gr the routing protocol
+     */
+    void DeleteRoutes(Ptr<Node> node, Ptr<Ipv4GlobalRouting> gr) const;
+
+    /**
+     * \brief Run the SPF computation for each of the given roots.
+     *
+     * The computations are shared among the number of threads selected by the
+     * \ref GlobalValueGlobalRoutingThreads "GlobalRoutingThreads" global value.
+     * Each thread works on its own copy of the LSDB, while the routes of each
+     * root are computed by a single thread, hence the routing tables do not
+     * depend on the number of threads.
+     *
+     * \param roots the roots of the SPF computations
+     */
+    void SPFCalculate(const std::vector<SPFRoot>& roots);
+
+    /**
+     * \brief Test if the routes of a stub node, in the sense of CheckForStubNode (),
+     * do not depend on the given LSAs.
+     *
+     * \param root the root node
+     * \param changed the link state IDs of the LSAs
+     * \returns true if the node is a stub which does not depend on the LSAs
+     */
+    bool IsUnaffectedStubNode(Ipv4Address root, const std::set<Ipv4Address>& changed) const;
 
     /**
      * \brief Test if a node is a stub, from an OSPF sense.
@@ -750,6 +856,13 @@ class GlobalRouteManagerImpl
      */
     void SPFCalculate(Ipv4Address root);
 
+    /**
+     * \brief Calculate the shortest path first (SPF) tree
+     *
+     * \param spfRoot the objects of the root node
+     */
+    void SPFCalculate(const SPFRoot& spfRoot);
+
     /**
      * \brief Process Stub nodes
      *
@@ -59,6 +59,17 @@ class GlobalRouteManager
      * per-node forwarding tables
      */
     static void InitializeRoutes();
+
+    /**
+     * @brief Rebuild the routing database and recompute the routes after a
+     * change in the topology.
+     *
+     * If the \ref GlobalValueGlobalRoutingIncremental "GlobalRoutingIncremental"
+     * global value is true, only the routes which may have been affected by the
+     * changes are recomputed, otherwise all the routes are deleted and computed
+     * again.
+     */
+    static void UpdateGlobalRoutes();
 };
 
 } // namespace ns3
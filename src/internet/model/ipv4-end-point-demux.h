@@ -15,6 +15,8 @@
 
 #include <list>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -31,6 +33,11 @@ class Ipv4EndPoint;
  * of endpoints, and has APIs to add and find endpoints in this demux.  This
  * code is shared in common to TCP and UDP protocols in ns3.  This demux
  * sits between ns3's layer four and the socket layer
+ *
+ * Besides the list of endpoints, the demux maintains hash indexes of the
+ * endpoints by local port and, for the endpoints with a peer, by local port
+ * and peer, so that the cost of a lookup does not grow with the number of
+ * connections.
  */
 
 class Ipv4EndPointDemux
@@ -160,6 +167,83 @@ class Ipv4EndPointDemux
     void DeAllocate(Ipv4EndPoint* endPoint);
 
   private:
+    friend class Ipv4EndPoint;
+
+    /**
+     * \brief Add an end point to the container and to the lookup indexes.
+     * \param endPoint the end point
+     */
+    void Insert(Ipv4EndPoint* endPoint);
+
+    /**
+     * \brief Add an end point to the lookup indexes.
+     *
+     * Called when an end point is inserted and when its peer changes.
+     *
+     * \param endPoint the end point
+     */
+    void AddToIndex(Ipv4EndPoint* endPoint);
+
+    /**
+     * \brief Remove an end point from the lookup indexes.
+     *
+     * Called when an end point is removed and before its peer changes.
+     *
+     * \param endPoint the end point
+     */
+    void RemoveFromIndex(Ipv4EndPoint* endPoint);
+
+    /**
+     * \brief Get the index bucket holding the end points with a given local
+     * port and peer.
+     *
+     * The end points with both a peer address and a peer port (e.g., the
+     * connected TCP sockets) are indexed by local port and peer, so that the
+     * packets of a connection are demultiplexed in constant time.  The other
+     * end points (e.g., the listening sockets) are indexed by local port only.
+     *
+     * \param localPort the local port
+     * \param peerAddress the peer address
+     * \param peerPort the peer port
+     * \return the bucket
+     */
+    std::vector<Ipv4EndPoint*>& GetBucket(uint16_t localPort,
+                                          Ipv4Address peerAddress,
+                                          uint16_t peerPort);
+
+    /**
+     * \brief Key of the connected end points: local port, peer address and peer port.
+     */
+    struct ConnectionKey
+    {
+        uint16_t localPort;      //!< local port
+        Ipv4Address peerAddress; //!< peer address
+        uint16_t peerPort;       //!< peer port
+
+        /**
+         * \brief Equality operator.
+         * \param other the other key
+         * \return true if the keys are equal
+         */
+        bool operator==(const ConnectionKey& other) const
+        {
+            return localPort == other.localPort && peerAddress == other.peerAddress &&
+                   peerPort == other.peerPort;
+        }
+    };
+
+    /**
+     * \brief Hash function of the connection keys.
+     */
+    struct ConnectionKeyHash
+    {
+        /**
+         * \param key the key
+         * \return the hash of the key
+         */
+        std::size_t operator()(const ConnectionKey& key) const;
+    };
+
     /**
      * \brief Allocate an ephemeral port.
      * \returns the ephemeral port
@@ -185,6 +269,26 @@ class Ipv4EndPointDemux
      * \brief A list of IPv4 end points.
      */
     EndPoints m_endPoints;
+
+    /**
+     * \brief The position of each end point in m_endPoints.
+     */
+    std::unordered_map<Ipv4EndPoint*, EndPointsI> m_positions;
+
+    /**
+     * \brief The end points with a peer, indexed by local port and peer.
+     */
+    std::unordered_map<ConnectionKey, std::vector<Ipv4EndPoint*>, ConnectionKeyHash> m_connected;
+
+    /**
+     * \brief The end points without a peer, indexed by local port.
+     */
+    std::unordered_map<uint16_t, std::vector<Ipv4EndPoint*>> m_unconnected;
+
+    /**
+     * \brief The number of end points using each local port.
+     */
+    std::unordered_map<uint16_t, uint32_t> m_portUsage;
 };
 
 } // namespace ns3
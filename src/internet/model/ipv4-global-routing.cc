@@ -9,8 +9,10 @@
 #include "global-route-manager.h"
 #include "ipv4-route.h"
 #include "ipv4-routing-table-entry.h"
+#include "prefix-trie.h"
 
 #include "ns3/boolean.h"
+#include "ns3/hash.h"
 #include "ns3/log.h"
 #include "ns3/names.h"
 #include "ns3/net-device.h"
@@ -18,6 +20,7 @@
 #include "ns3/object.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
+#include "ns3/uinteger.h"
 
 #include <iomanip>
 #include <vector>
@@ -47,13 +50,31 @@ Ipv4GlobalRouting::GetTypeId()
                           "Interface notification events (up/down, or add/remove address)",
                           BooleanValue(false),
                           MakeBooleanAccessor(&Ipv4GlobalRouting::m_respondToInterfaceEvents),
-                          MakeBooleanChecker());
+                          MakeBooleanChecker())
+            .AddAttribute("FlowEcmpRouting",
+                          "Set to true if packets are routed among ECMP according to a hash of "
+                          "their addresses, protocol and ports, so that the packets of a flow "
+                          "follow the same route; takes precedence over RandomEcmpRouting",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&Ipv4GlobalRouting::m_flowEcmpRouting),
+                          MakeBooleanChecker())
+            .AddAttribute("FlowCacheSize",
+                          "The number of entries of the cache of the routes selected for the "
+                          "recent flows (or destinations, if FlowEcmpRouting is false); "
+                          "0 disables the cache, which is not used with RandomEcmpRouting",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&Ipv4GlobalRouting::m_flowCacheSize),
+                          MakeUintegerChecker<uint32_t>());
     return tid;
 }
 
 Ipv4GlobalRouting::Ipv4GlobalRouting()
     : m_randomEcmpRouting(false),
-      m_respondToInterfaceEvents(false)
+      m_respondToInterfaceEvents(false),
+      m_flowEcmpRouting(false),
+      m_flowCacheSize(0),
+      m_flowHashSeed(0),
+      m_fibValid(false)
 {
     NS_LOG_FUNCTION(this);
 
@@ -72,6 +93,7 @@ Ipv4GlobalRouting::AddHostRouteTo(Ipv4Address dest, Ipv4Address nextHop, uint32_
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateHostRouteTo(dest, nextHop, interface);
     m_hostRoutes.push_back(route);
+    m_fibValid = false;
 }
 
 void
@@ -81,6 +103,7 @@ Ipv4GlobalRouting::AddHostRouteTo(Ipv4Address dest, uint32_t interface)
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateHostRouteTo(dest, interface);
     m_hostRoutes.push_back(route);
+    m_fibValid = false;
 }
 
 void
@@ -93,6 +116,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo(Ipv4Address network,
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, nextHop, interface);
     m_networkRoutes.push_back(route);
+    m_fibValid = false;
 }
 
 void
@@ -102,6 +126,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo(Ipv4Address network, Ipv4Mask networkMask,
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, interface);
     m_networkRoutes.push_back(route);
+    m_fibValid = false;
 }
 
 void
@@ -114,20 +139,150 @@ Ipv4GlobalRouting::AddASExternalRouteTo(Ipv4Address network,
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, nextHop, interface);
     m_ASexternalRoutes.push_back(route);
+    m_fibValid = false;
+}
+
+namespace
+{
+
+/**
+ * \param address An IPv4 address.
+ * \returns the address as a prefix trie key.
+ */
+std::array<uint8_t, 4>
+ToFibKey(Ipv4Address address)
+{
+    std::array<uint8_t, 4> key;
+    address.Serialize(key.data());
+    return key;
+}
+
+/**
+ * \param mask An IPv4 mask.
+ * \returns the length of the contiguous prefix covered by the mask.
+ */
+uint8_t
+GetFibPrefixLength(Ipv4Mask mask)
+{
+    return PrefixTrie<4, Ipv4RoutingTableEntry*>::GetLeadingOnes(ToFibKey(Ipv4Address(mask.Get())));
+}
+
+} // namespace
+
+void
+Ipv4GlobalRouting::UpdateFib()
+{
+    NS_LOG_FUNCTION(this);
+    m_hostFib.Clear();
+    m_networkFib.Clear();
+    m_ASexternalFib.Clear();
+    for (auto route : m_hostRoutes)
+    {
+        m_hostFib.Insert(ToFibKey(route->GetDest()), 32, route);
+    }
+    for (auto route : m_networkRoutes)
+    {
+        m_networkFib.Insert(ToFibKey(route->GetDestNetwork()),
+                            GetFibPrefixLength(route->GetDestNetworkMask()),
+                            route);
+    }
+    for (auto route : m_ASexternalRoutes)
+    {
+        m_ASexternalFib.Insert(ToFibKey(route->GetDestNetwork()),
+                               GetFibPrefixLength(route->GetDestNetworkMask()),
+                               route);
+    }
+    m_fibValid = true;
+    // the cached routes may have been removed
+    m_flowCache.clear();
+}
+
+uint32_t
+Ipv4GlobalRouting::GetFlowHash(const Ipv4Header& header, Ptr<const Packet> p) const
+{
+    uint8_t buf[17];
+    std::size_t size = 0;
+    for (uint32_t word : {m_flowHashSeed, header.GetSource().Get(), header.GetDestination().Get()})
+    {
+        for (int shift = 24; shift >= 0; shift -= 8)
+        {
+            buf[size++] = static_cast<uint8_t>(word >> shift);
+        }
+    }
+    buf[size++] = header.GetProtocol();
+    // the ports are the first four bytes of both the TCP and UDP headers,
+    // which are only present in the first fragment of a packet
+    const uint8_t tcp = 6;
+    const uint8_t udp = 17;
+    if (p && (header.GetProtocol() == tcp || header.GetProtocol() == udp) &&
+        header.IsLastFragment() && header.GetFragmentOffset() == 0 && p->GetSize() >= 4)
+    {
+        size += p->CopyData(buf + size, 4);
+    }
+    return Hash32(reinterpret_cast<const char*>(buf), size);
 }
 
 Ptr<Ipv4Route>
-Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif)
+Ipv4GlobalRouting::CreateRoute(const Ipv4RoutingTableEntry* route) const
 {
-    NS_LOG_FUNCTION(this << dest << oif);
+    // create a Ipv4Route object from the selected routing table entry
+    Ptr<Ipv4Route> rtentry = Create<Ipv4Route>();
+    rtentry->SetDestination(route->GetDest());
+    /// \todo handle multi-address case
+    rtentry->SetSource(m_ipv4->GetAddress(route->GetInterface(), 0).GetLocal());
+    rtentry->SetGateway(route->GetGateway());
+    uint32_t interfaceIdx = route->GetInterface();
+    rtentry->SetOutputDevice(m_ipv4->GetNetDevice(interfaceIdx));
+    return rtentry;
+}
+
+Ptr<Ipv4Route>
+Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif, uint32_t flowHash)
+{
+    NS_LOG_FUNCTION(this << dest << oif << flowHash);
     NS_LOG_LOGIC("Looking for route for destination " << dest);
-    Ptr<Ipv4Route> rtentry = nullptr;
     // store all available routes that bring packets to their destination
     typedef std::vector<Ipv4RoutingTableEntry*> RouteVec_t;
     RouteVec_t allRoutes;
 
+    if (!m_fibValid)
+    {
+        UpdateFib();
+    }
+
+    // The route selected for a destination, an output interface and (with
+    // flow based ECMP) a flow hash does not change until the routing tables
+    // change, unless the route is picked at random
+    FlowCacheEntry* cacheEntry = nullptr;
+    if (m_flowCacheSize > 0 && (m_flowEcmpRouting || !m_randomEcmpRouting))
+    {
+        if (m_flowCache.size() != m_flowCacheSize)
+        {
+            m_flowCache.assign(m_flowCacheSize, FlowCacheEntry());
+        }
+        if (!m_flowEcmpRouting)
+        {
+            flowHash = 0;
+        }
+        uint32_t slot = (dest.Get() * 2654435761U) ^ flowHash ^ (oif ? oif->GetIfIndex() + 1 : 0);
+        cacheEntry = &m_flowCache[slot % m_flowCacheSize];
+        if (cacheEntry->route && cacheEntry->dest == dest && cacheEntry->oif == oif &&
+            cacheEntry->flowHash == flowHash)
+        {
+            NS_LOG_LOGIC("Found cached route " << cacheEntry->route);
+            return CreateRoute(cacheEntry->route);
+        }
+    }
+
+    // The FIB returns the routes whose (contiguous part of the) prefix
+    // contains the destination, in routing table order; the masks are
+    // still checked below to support non-contiguous masks.
+    auto key = ToFibKey(dest);
+    RouteVec_t candidates;
+
     NS_LOG_LOGIC("Number of m_hostRoutes = " << m_hostRoutes.size());
-    for (auto i = m_hostRoutes.begin(); i != m_hostRoutes.end(); i++)
+    m_hostFib.Lookup(key, candidates);
+    for (auto i = candidates.begin(); i != candidates.end(); i++)
     {
         NS_ASSERT((*i)->IsHost());
         if ((*i)->GetDest() == dest)
@@ -147,7 +302,9 @@ Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif)
     if (allRoutes.empty()) // if no host route is found
     {
         NS_LOG_LOGIC("Number of m_networkRoutes" << m_networkRoutes.size());
-        for (auto j = m_networkRoutes.begin(); j != m_networkRoutes.end(); j++)
+        candidates.clear();
+        m_networkFib.Lookup(key, candidates);
+        for (auto j = candidates.begin(); j != candidates.end(); j++)
         {
             Ipv4Mask mask = (*j)->GetDestNetworkMask();
             Ipv4Address entry = (*j)->GetDestNetwork();
@@ -168,7 +325,9 @@ Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif)
     }
     if (allRoutes.empty()) // consider external if no host/network found
     {
-        for (auto k = m_ASexternalRoutes.begin(); k != m_ASexternalRoutes.end(); k++)
+        candidates.clear();
+        m_ASexternalFib.Lookup(key, candidates);
+        for (auto k = candidates.begin(); k != candidates.end(); k++)
         {
             Ipv4Mask mask = (*k)->GetDestNetworkMask();
             Ipv4Address entry = (*k)->GetDestNetwork();
@@ -190,11 +349,18 @@ Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif)
     }
     if (!allRoutes.empty()) // if route(s) is found
     {
-        // pick up one of the routes uniformly at random if random
+        // pick up one of the routes according to the flow hash if flow
+        // based ECMP routing is enabled, uniformly at random if random
         // ECMP routing is enabled, or always select the first route
-        // consistently if random ECMP routing is disabled
+        // consistently if ECMP routing is disabled
         uint32_t selectIndex;
-        if (m_randomEcmpRouting)
+        if (m_flowEcmpRouting)
+        {
+            // hash-threshold selection (RFC 2992), which moves fewer flows
+            // than a modulo when the number of routes changes
+            selectIndex = (static_cast<uint64_t>(flowHash) * allRoutes.size()) >> 32;
+        }
+        else if (m_randomEcmpRouting)
         {
             selectIndex = m_rand->GetInteger(0, allRoutes.size() - 1);
         }
@@ -203,15 +369,11 @@ Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif)
             selectIndex = 0;
         }
         Ipv4RoutingTableEntry* route = allRoutes.at(selectIndex);
-        // create a Ipv4Route object from the selected routing table entry
-        rtentry = Create<Ipv4Route>();
-        rtentry->SetDestination(route->GetDest());
-        /// \todo handle multi-address case
-        rtentry->SetSource(m_ipv4->GetAddress(route->GetInterface(), 0).GetLocal());
-        rtentry->SetGateway(route->GetGateway());
-        uint32_t interfaceIdx = route->GetInterface();
-        rtentry->SetOutputDevice(m_ipv4->GetNetDevice(interfaceIdx));
-        return rtentry;
+        if (cacheEntry)
+        {
+            *cacheEntry = {dest, oif, flowHash, route};
+        }
+        return CreateRoute(route);
     }
     else
     {
@@ -288,6 +450,7 @@ Ipv4GlobalRouting::RemoveRoute(uint32_t index)
                 NS_LOG_LOGIC("Removing route " << index << "; size = " << m_hostRoutes.size());
                 delete *i;
                 m_hostRoutes.erase(i);
+                m_fibValid = false;
                 NS_LOG_LOGIC("Done removing host route "
                              << index << "; host route remaining size = " << m_hostRoutes.size());
                 return;
@@ -304,6 +467,7 @@ Ipv4GlobalRouting::RemoveRoute(uint32_t index)
             NS_LOG_LOGIC("Removing route " << index << "; size = " << m_networkRoutes.size());
             delete *j;
             m_networkRoutes.erase(j);
+            m_fibValid = false;
             NS_LOG_LOGIC("Done removing network route "
                          << index << "; network route remaining size = " << m_networkRoutes.size());
             return;
@@ -319,6 +483,7 @@ Ipv4GlobalRouting::RemoveRoute(uint32_t index)
             NS_LOG_LOGIC("Removing route " << index << "; size = " << m_ASexternalRoutes.size());
             delete *k;
             m_ASexternalRoutes.erase(k);
+            m_fibValid = false;
             NS_LOG_LOGIC("Done removing network route "
                          << index << "; network route remaining size = " << m_networkRoutes.size());
             return;
@@ -353,6 +518,11 @@ Ipv4GlobalRouting::DoDispose()
     {
         delete (*l);
     }
+    m_fibValid = false;
+    m_flowCache.clear();
+    m_hostFib.Clear();
+    m_networkFib.Clear();
+    m_ASexternalFib.Clear();
 
     Ipv4RoutingProtocol::DoDispose();
 }
@@ -445,7 +615,12 @@ Ipv4GlobalRouting::RouteOutput(Ptr<Packet> p,
     // See if this is a unicast packet we have a route for.
     //
     NS_LOG_LOGIC("Unicast destination- looking up");
-    Ptr<Ipv4Route> rtentry = LookupGlobal(header.GetDestination(), oif);
+    // the transport header of the locally generated packets may not have
+    // been added yet, hence their flows are identified by addresses and
+    // protocol only
+    Ptr<Ipv4Route> rtentry = LookupGlobal(header.GetDestination(),
+                                          oif,
+                                          m_flowEcmpRouting ? GetFlowHash(header, nullptr) : 0);
     if (rtentry)
     {
         sockerr = Socket::ERROR_NOTERROR;
@@ -500,7 +675,8 @@ Ipv4GlobalRouting::RouteInput(Ptr<const Packet> p,
     }
     // Next, try to find a route
     NS_LOG_LOGIC("Unicast destination- looking up global route");
-    Ptr<Ipv4Route> rtentry = LookupGlobal(header.GetDestination());
+    uint32_t flowHash = m_flowEcmpRouting ? GetFlowHash(header, p) : 0;
+    Ptr<Ipv4Route> rtentry = LookupGlobal(header.GetDestination(), nullptr, flowHash);
     if (rtentry)
     {
         NS_LOG_LOGIC("Found unicast destination- calling unicast callback");
@@ -521,9 +697,7 @@ Ipv4GlobalRouting::NotifyInterfaceUp(uint32_t i)
     NS_LOG_FUNCTION(this << i);
     if (m_respondToInterfaceEvents && Simulator::Now().GetSeconds() > 0) // avoid startup events
     {
-        GlobalRouteManager::DeleteGlobalRoutes();
-        GlobalRouteManager::BuildGlobalRoutingDatabase();
-        GlobalRouteManager::InitializeRoutes();
+        GlobalRouteManager::UpdateGlobalRoutes();
     }
 }
 
@@ -533,9 +707,7 @@ Ipv4GlobalRouting::NotifyInterfaceDown(uint32_t i)
     NS_LOG_FUNCTION(this << i);
     if (m_respondToInterfaceEvents && Simulator::Now().GetSeconds() > 0) // avoid startup events
     {
-        GlobalRouteManager::DeleteGlobalRoutes();
-        GlobalRouteManager::BuildGlobalRoutingDatabase();
-        GlobalRouteManager::InitializeRoutes();
+        GlobalRouteManager::UpdateGlobalRoutes();
     }
 }
 
@@ -545,9 +717,7 @@ Ipv4GlobalRouting::NotifyAddAddress(uint32_t interface, Ipv4InterfaceAddress add
     NS_LOG_FUNCTION(this << interface << address);
     if (m_respondToInterfaceEvents && Simulator::Now().GetSeconds() > 0) // avoid startup events
     {
-        GlobalRouteManager::DeleteGlobalRoutes();
-        GlobalRouteManager::BuildGlobalRoutingDatabase();
-        GlobalRouteManager::InitializeRoutes();
+        GlobalRouteManager::UpdateGlobalRoutes();
     }
 }
 
@@ -557,9 +727,7 @@ Ipv4GlobalRouting::NotifyRemoveAddress(uint32_t interface, Ipv4InterfaceAddress
     NS_LOG_FUNCTION(this << interface << address);
     if (m_respondToInterfaceEvents && Simulator::Now().GetSeconds() > 0) // avoid startup events
     {
-        GlobalRouteManager::DeleteGlobalRoutes();
-        GlobalRouteManager::BuildGlobalRoutingDatabase();
-        GlobalRouteManager::InitializeRoutes();
+        GlobalRouteManager::UpdateGlobalRoutes();
     }
 }
 
@@ -569,6 +737,10 @@ Ipv4GlobalRouting::SetIpv4(Ptr<Ipv4> ipv4)
     NS_LOG_FUNCTION(this << ipv4);
     NS_ASSERT(!m_ipv4 && ipv4);
     m_ipv4 = ipv4;
+    if (auto node = ipv4->GetObject<Node>())
+    {
+        m_flowHashSeed = node->GetId();
+    }
 }
 
 } // namespace ns3
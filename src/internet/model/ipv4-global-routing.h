@@ -10,6 +10,7 @@
 #include "ipv4-header.h"
 #include "ipv4-routing-protocol.h"
 #include "ipv4.h"
+#include "prefix-trie.h"
 
 #include "ns3/ipv4-address.h"
 #include "ns3/ptr.h"
@@ -17,6 +18,7 @@
 
 #include <list>
 #include <stdint.h>
+#include <vector>
 
 namespace ns3
 {
@@ -232,6 +234,12 @@ class Ipv4GlobalRouting : public Ipv4RoutingProtocol
     bool m_respondToInterfaceEvents;
     /// A uniform random number generator for randomly routing packets among ECMP
     Ptr<UniformRandomVariable> m_rand;
+    /// Set to true if packets are routed among ECMP according to a hash of their flow
+    bool m_flowEcmpRouting;
+    /// Number of entries of the flow route cache, 0 to disable the cache
+    uint32_t m_flowCacheSize;
+    /// Seed of the flow hash, which differs among nodes to avoid the polarization of the flows
+    uint32_t m_flowHashSeed;
 
     /// container of Ipv4RoutingTableEntry (routes to hosts)
     typedef std::list<Ipv4RoutingTableEntry*> HostRoutes;
@@ -258,14 +266,63 @@ class Ipv4GlobalRouting : public Ipv4RoutingProtocol
      * \brief Lookup in the forwarding table for destination.
      * \param dest destination address
      * \param oif output interface if any (put 0 otherwise)
+     * \param flowHash hash of the flow of the packet, used to select one of the ECMP routes
      * \return Ipv4Route to route the packet to reach dest address
      */
-    Ptr<Ipv4Route> LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif = nullptr);
+    Ptr<Ipv4Route> LookupGlobal(Ipv4Address dest,
+                                Ptr<NetDevice> oif = nullptr,
+                                uint32_t flowHash = 0);
+
+    /**
+     * \brief Compute the hash of the flow of a packet.
+     *
+     * Like the Linux fib_multipath_hash() with the layer 4 policy, the hash
+     * covers the addresses, the protocol and, for unfragmented TCP and UDP
+     * packets, the ports.
+     *
+     * \param header the IPv4 header of the packet
+     * \param p the packet, starting with the transport header, or nullptr if
+     *          the transport header is not available
+     * \return the flow hash
+     */
+    uint32_t GetFlowHash(const Ipv4Header& header, Ptr<const Packet> p) const;
+
+    /**
+     * \brief Create the route to be returned for a routing table entry.
+     * \param route the routing table entry
+     * \return the route
+     */
+    Ptr<Ipv4Route> CreateRoute(const Ipv4RoutingTableEntry* route) const;
+
+    /**
+     * \brief Rebuild the forwarding tables from the routing tables.
+     */
+    void UpdateFib();
 
     HostRoutes m_hostRoutes;             //!< Routes to hosts
     NetworkRoutes m_networkRoutes;       //!< Routes to networks
     ASExternalRoutes m_ASexternalRoutes; //!< External routes imported
 
+    /// Forwarding table indexing routing table entries by destination prefix
+    typedef PrefixTrie<4, Ipv4RoutingTableEntry*> Fib;
+
+    Fib m_hostFib;       //!< Forwarding table of the routes to hosts
+    Fib m_networkFib;    //!< Forwarding table of the routes to networks
+    Fib m_ASexternalFib; //!< Forwarding table of the external routes
+    bool m_fibValid;     //!< Whether the forwarding tables match the routing tables
+
+    /// Entry of the flow route cache
+    struct FlowCacheEntry
+    {
+        Ipv4Address dest;                      //!< Destination address
+        Ptr<NetDevice> oif;                    //!< Requested output interface, if any
+        uint32_t flowHash{0};                  //!< Flow hash
+        Ipv4RoutingTableEntry* route{nullptr}; //!< Selected route, nullptr if the entry is empty
+    };
+
+    /// Direct-mapped cache of the routes selected for the recent flows
+    std::vector<FlowCacheEntry> m_flowCache;
+
     Ptr<Ipv4> m_ipv4; //!< associated IPv4 instance
 };
 
@@ -17,6 +17,7 @@
 
 #include "ipv4-route.h"
 #include "ipv4-routing-table-entry.h"
+#include "prefix-trie.h"
 
 #include "ns3/log.h"
 #include "ns3/names.h"
@@ -26,6 +27,7 @@
 #include "ns3/simulator.h"
 
 #include <iomanip>
+#include <vector>
 
 using std::make_pair;
 
@@ -47,7 +49,8 @@ Ipv4StaticRouting::GetTypeId()
 }
 
 Ipv4StaticRouting::Ipv4StaticRouting()
-    : m_ipv4(nullptr)
+    : m_fibValid(false),
+      m_ipv4(nullptr)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -69,6 +72,7 @@ Ipv4StaticRouting::AddNetworkRouteTo(Ipv4Address network,
     {
         auto routePtr = new Ipv4RoutingTableEntry(route);
         m_networkRoutes.emplace_back(routePtr, metric);
+        m_fibValid = false;
     }
 }
 
@@ -87,6 +91,7 @@ Ipv4StaticRouting::AddNetworkRouteTo(Ipv4Address network,
         auto routePtr = new Ipv4RoutingTableEntry(route);
 
         m_networkRoutes.emplace_back(routePtr, metric);
+        m_fibValid = false;
     }
 }
 
@@ -142,6 +147,7 @@ Ipv4StaticRouting::SetDefaultMulticastRoute(uint32_t outputInterface)
     Ipv4Mask networkMask("240.0.0.0");
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, outputInterface);
     m_networkRoutes.emplace_back(route, 0);
+    m_fibValid = false;
 }
 
 uint32_t
@@ -228,6 +234,36 @@ Ipv4StaticRouting::LookupRoute(const Ipv4RoutingTableEntry& route, uint32_t metr
     return false;
 }
 
+namespace
+{
+
+/**
+ * \param address An IPv4 address.
+ * \returns the address as a prefix trie key.
+ */
+std::array<uint8_t, 4>
+ToFibKey(Ipv4Address address)
+{
+    std::array<uint8_t, 4> key;
+    address.Serialize(key.data());
+    return key;
+}
+
+} // namespace
+
+void
+Ipv4StaticRouting::UpdateFib()
+{
+    NS_LOG_FUNCTION(this);
+    m_fib.Clear();
+    for (const auto& route : m_networkRoutes)
+    {
+        auto mask = ToFibKey(Ipv4Address(route.first->GetDestNetworkMask().Get()));
+        m_fib.Insert(ToFibKey(route.first->GetDestNetwork()), Fib::GetLeadingOnes(mask), route);
+    }
+    m_fibValid = true;
+}
+
 Ptr<Ipv4Route>
 Ipv4StaticRouting::LookupStatic(Ipv4Address dest, Ptr<NetDevice> oif)
 {
@@ -250,7 +286,17 @@ Ipv4StaticRouting::LookupStatic(Ipv4Address dest, Ptr<NetDevice> oif)
         return rtentry;
     }
 
-    for (auto i = m_networkRoutes.begin(); i != m_networkRoutes.end(); i++)
+    if (!m_fibValid)
+    {
+        UpdateFib();
+    }
+    // The FIB returns the routes whose (contiguous part of the) prefix
+    // contains the destination, in routing table order; the masks are
+    // still checked below to support non-contiguous masks.
+    std::vector<NetworkRoutes::value_type> candidates;
+    m_fib.Lookup(ToFibKey(dest), candidates);
+
+    for (auto i = candidates.begin(); i != candidates.end(); i++)
     {
         Ipv4RoutingTableEntry* j = i->first;
         uint32_t metric = i->second;
@@ -448,6 +494,7 @@ Ipv4StaticRouting::RemoveRoute(uint32_t index)
         {
             delete j->first;
             m_networkRoutes.erase(j);
+            m_fibValid = false;
             return;
         }
         tmp++;
@@ -581,6 +628,8 @@ Ipv4StaticRouting::DoDispose()
     {
         delete (j->first);
     }
+    m_fibValid = false;
+    m_fib.Clear();
     for (auto i = m_multicastRoutes.begin(); i != m_multicastRoutes.end();
          i = m_multicastRoutes.erase(i))
     {
@@ -622,6 +671,7 @@ Ipv4StaticRouting::NotifyInterfaceDown(uint32_t i)
         {
             delete it->first;
             it = m_networkRoutes.erase(it);
+            m_fibValid = false;
         }
         else
         {
@@ -667,6 +717,7 @@ Ipv4StaticRouting::NotifyRemoveAddress(uint32_t interface, Ipv4InterfaceAddress
         {
             delete it->first;
             it = m_networkRoutes.erase(it);
+            m_fibValid = false;
         }
         else
         {
@@ -13,6 +13,7 @@
 #include "ipv4-header.h"
 #include "ipv4-routing-protocol.h"
 #include "ipv4.h"
+#include "prefix-trie.h"
 
 #include "ns3/ipv4-address.h"
 #include "ns3/ptr.h"
@@ -400,6 +401,24 @@ class Ipv4StaticRouting : public Ipv4RoutingProtocol
      */
     NetworkRoutes m_networkRoutes;
 
+    /// Index of the network routes by destination prefix
+    typedef PrefixTrie<4, NetworkRoutes::value_type> Fib;
+
+    /**
+     * \brief Rebuild the prefix index from the network routes.
+     */
+    void UpdateFib();
+
+    /**
+     * \brief the network routes indexed by destination prefix.
+     */
+    Fib m_fib;
+
+    /**
+     * \brief whether m_fib matches m_networkRoutes.
+     */
+    bool m_fibValid;
+
     /**
      * \brief the forwarding table for multicast.
      */
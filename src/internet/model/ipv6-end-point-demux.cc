@@ -12,6 +12,8 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -40,20 +42,38 @@ bool
 Ipv6EndPointDemux::LookupPortLocal(uint16_t port)
 {
     NS_LOG_FUNCTION(this << port);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
-    {
-        if ((*i)->GetLocalPort() == port)
-        {
-            return true;
-        }
-    }
-    return false;
+    return m_portUsage.contains(port);
 }
 
 bool
 Ipv6EndPointDemux::LookupLocal(Ptr<NetDevice> boundNetDevice, Ipv6Address addr, uint16_t port)
 {
     NS_LOG_FUNCTION(this << addr << port);
+    auto usage = m_portUsage.find(port);
+    if (usage == m_portUsage.end())
+    {
+        return false;
+    }
+    uint32_t nUnconnected = 0;
+    auto unconnected = m_unconnected.find(port);
+    if (unconnected != m_unconnected.end())
+    {
+        nUnconnected = unconnected->second.size();
+    }
+    for (uint32_t j = 0; j < nUnconnected; j++)
+    {
+        Ipv6EndPoint* endPoint = unconnected->second[j];
+        if (endPoint->GetLocalPort() == port && endPoint->GetLocalAddress() == addr &&
+            endPoint->GetBoundNetDevice() == boundNetDevice)
+        {
+            return true;
+        }
+    }
+    if (usage->second == nUnconnected)
+    {
+        return false;
+    }
+    // some connected end points use the port, look for them in the whole list
     for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
     {
         if ((*i)->GetLocalPort() == port && (*i)->GetLocalAddress() == addr &&
@@ -76,7 +96,7 @@ Ipv6EndPointDemux::Allocate()
         return nullptr;
     }
     auto endPoint = new Ipv6EndPoint(Ipv6Address::GetAny(), port);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
     return endPoint;
 }
@@ -92,7 +112,7 @@ Ipv6EndPointDemux::Allocate(Ipv6Address address)
         return nullptr;
     }
     auto endPoint = new Ipv6EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
     return endPoint;
 }
@@ -115,7 +135,7 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice, Ipv6Address address,
         return nullptr;
     }
     auto endPoint = new Ipv6EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
     return endPoint;
 }
@@ -128,11 +148,11 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
                             uint16_t peerPort)
 {
     NS_LOG_FUNCTION(this << boundNetDevice << localAddress << localPort << peerAddress << peerPort);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    for (auto endPoint : GetBucket(localPort, peerAddress, peerPort))
     {
-        if ((*i)->GetLocalPort() == localPort && (*i)->GetLocalAddress() == localAddress &&
-            (*i)->GetPeerPort() == peerPort && (*i)->GetPeerAddress() == peerAddress &&
-            ((*i)->GetBoundNetDevice() == boundNetDevice || !(*i)->GetBoundNetDevice()))
+        if (endPoint->GetLocalPort() == localPort && endPoint->GetLocalAddress() == localAddress &&
+            endPoint->GetPeerPort() == peerPort && endPoint->GetPeerAddress() == peerAddress &&
+            (endPoint->GetBoundNetDevice() == boundNetDevice || !endPoint->GetBoundNetDevice()))
         {
             NS_LOG_WARN("Duplicated endpoint.");
             return nullptr;
@@ -140,7 +160,7 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
     }
     auto endPoint = new Ipv6EndPoint(localAddress, localPort);
     endPoint->SetPeer(peerAddress, peerPort);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
 
     NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
 
@@ -151,14 +171,13 @@ void
 Ipv6EndPointDemux::DeAllocate(Ipv6EndPoint* endPoint)
 {
     NS_LOG_FUNCTION(this);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    auto position = m_positions.find(endPoint);
+    if (position != m_positions.end())
     {
-        if (*i == endPoint)
-        {
-            delete endPoint;
-            m_endPoints.erase(i);
-            break;
-        }
+        RemoveFromIndex(endPoint);
+        m_endPoints.erase(position->second);
+        m_positions.erase(position);
+        delete endPoint;
     }
 }
 
@@ -182,7 +201,24 @@ Ipv6EndPointDemux::Lookup(Ipv6Address daddr,
     EndPoints retval4; /* Exact match on all 4 */
 
     NS_LOG_DEBUG("Looking up endpoint for destination address " << daddr);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    // only the end points using the port, and connected to the source if
+    // they have a peer, can match
+    std::vector<Ipv6EndPoint*> candidates;
+    if (saddr != Ipv6Address::GetAny() && sport != 0)
+    {
+        auto connected = m_connected.find({dport, saddr, sport});
+        if (connected != m_connected.end())
+        {
+            candidates = connected->second;
+        }
+    }
+    auto unconnected = m_unconnected.find(dport);
+    if (unconnected != m_unconnected.end())
+    {
+        candidates.insert(candidates.end(), unconnected->second.begin(), unconnected->second.end());
+    }
+
+    for (auto i = candidates.begin(); i != candidates.end(); i++)
     {
         Ipv6EndPoint* endP = *i;
 
@@ -337,6 +373,67 @@ Ipv6EndPointDemux::SimpleLookup(Ipv6Address dst, uint16_t dport, Ipv6Address src
     return generic;
 }
 
+std::size_t
+Ipv6EndPointDemux::ConnectionKeyHash::operator()(const ConnectionKey& key) const
+{
+    return Ipv6AddressHash()(key.peerAddress) ^
+           std::hash<uint32_t>()((static_cast<uint32_t>(key.localPort) << 16) | key.peerPort);
+}
+
+void
+Ipv6EndPointDemux::Insert(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    m_positions[endPoint] = m_endPoints.insert(m_endPoints.end(), endPoint);
+    endPoint->m_demux = this;
+    AddToIndex(endPoint);
+}
+
+std::vector<Ipv6EndPoint*>&
+Ipv6EndPointDemux::GetBucket(uint16_t localPort, Ipv6Address peerAddress, uint16_t peerPort)
+{
+    if (peerAddress != Ipv6Address::GetAny() && peerPort != 0)
+    {
+        return m_connected[{localPort, peerAddress, peerPort}];
+    }
+    return m_unconnected[localPort];
+}
+
+void
+Ipv6EndPointDemux::AddToIndex(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    GetBucket(endPoint->GetLocalPort(), endPoint->GetPeerAddress(), endPoint->GetPeerPort())
+        .push_back(endPoint);
+    m_portUsage[endPoint->GetLocalPort()]++;
+}
+
+void
+Ipv6EndPointDemux::RemoveFromIndex(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    uint16_t localPort = endPoint->GetLocalPort();
+    Ipv6Address peerAddress = endPoint->GetPeerAddress();
+    uint16_t peerPort = endPoint->GetPeerPort();
+    auto& bucket = GetBucket(localPort, peerAddress, peerPort);
+    bucket.erase(std::find(bucket.begin(), bucket.end(), endPoint));
+    if (bucket.empty())
+    {
+        if (peerAddress != Ipv6Address::GetAny() && peerPort != 0)
+        {
+            m_connected.erase({localPort, peerAddress, peerPort});
+        }
+        else
+        {
+            m_unconnected.erase(localPort);
+        }
+    }
+    if (--m_portUsage[localPort] == 0)
+    {
+        m_portUsage.erase(localPort);
+    }
+}
+
 uint16_t
 Ipv6EndPointDemux::AllocateEphemeralPort()
 {
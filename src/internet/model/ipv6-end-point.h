@@ -23,6 +23,7 @@ namespace ns3
 
 class Header;
 class Packet;
+class Ipv6EndPointDemux;
 
 /**
  * \ingroup ipv6
@@ -228,6 +229,13 @@ class Ipv6EndPoint
      * \brief true if the endpoint can receive packets.
      */
     bool m_rxEnabled;
+
+    /**
+     * \brief The demux indexing this endpoint, if any.
+     */
+    Ipv6EndPointDemux* m_demux;
+
+    friend class Ipv6EndPointDemux;
 };
 
 } /* namespace ns3 */
@@ -10,6 +10,7 @@
 
 #include "ipv6-route.h"
 #include "ipv6-routing-table-entry.h"
+#include "prefix-trie.h"
 
 #include "ns3/log.h"
 #include "ns3/names.h"
@@ -19,6 +20,7 @@
 #include "ns3/simulator.h"
 
 #include <iomanip>
+#include <vector>
 
 namespace ns3
 {
@@ -38,7 +40,8 @@ Ipv6StaticRouting::GetTypeId()
 }
 
 Ipv6StaticRouting::Ipv6StaticRouting()
-    : m_ipv6(nullptr)
+    : m_fibValid(false),
+      m_ipv6(nullptr)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -172,6 +175,7 @@ Ipv6StaticRouting::AddNetworkRouteTo(Ipv6Address network,
     {
         auto routePtr = new Ipv6RoutingTableEntry(route);
         m_networkRoutes.emplace_back(routePtr, metric);
+        m_fibValid = false;
     }
 }
 
@@ -199,6 +203,7 @@ Ipv6StaticRouting::AddNetworkRouteTo(Ipv6Address network,
     {
         auto routePtr = new Ipv6RoutingTableEntry(route);
         m_networkRoutes.emplace_back(routePtr, metric);
+        m_fibValid = false;
     }
 }
 
@@ -216,6 +221,7 @@ Ipv6StaticRouting::AddNetworkRouteTo(Ipv6Address network,
     {
         auto routePtr = new Ipv6RoutingTableEntry(route);
         m_networkRoutes.emplace_back(routePtr, metric);
+        m_fibValid = false;
     }
 }
 
@@ -258,6 +264,7 @@ Ipv6StaticRouting::SetDefaultMulticastRoute(uint32_t outputInterface)
     Ipv6Prefix networkMask = Ipv6Prefix(8);
     *route = Ipv6RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, outputInterface);
     m_networkRoutes.emplace_back(route, 0);
+    m_fibValid = false;
 }
 
 uint32_t
@@ -368,6 +375,22 @@ Ipv6StaticRouting::LookupRoute(const Ipv6RoutingTableEntry& route, uint32_t metr
     return false;
 }
 
+void
+Ipv6StaticRouting::UpdateFib()
+{
+    NS_LOG_FUNCTION(this);
+    m_fib.Clear();
+    for (const auto& route : m_networkRoutes)
+    {
+        std::array<uint8_t, 16> network;
+        std::array<uint8_t, 16> prefix;
+        route.first->GetDestNetwork().GetBytes(network.data());
+        route.first->GetDestNetworkPrefix().GetBytes(prefix.data());
+        m_fib.Insert(network, Fib::GetLeadingOnes(prefix), route);
+    }
+    m_fibValid = true;
+}
+
 Ptr<Ipv6Route>
 Ipv6StaticRouting::LookupStatic(Ipv6Address dst, Ptr<NetDevice> interface)
 {
@@ -391,7 +414,19 @@ Ipv6StaticRouting::LookupStatic(Ipv6Address dst, Ptr<NetDevice> interface)
         return rtentry;
     }
 
-    for (auto it = m_networkRoutes.begin(); it != m_networkRoutes.end(); it++)
+    if (!m_fibValid)
+    {
+        UpdateFib();
+    }
+    // The FIB returns the routes whose (contiguous part of the) prefix
+    // contains the destination, in routing table order; the prefixes are
+    // still checked below to support non-contiguous masks.
+    std::array<uint8_t, 16> key;
+    dst.GetBytes(key.data());
+    std::vector<NetworkRoutes::value_type> candidates;
+    m_fib.Lookup(key, candidates);
+
+    for (auto it = candidates.begin(); it != candidates.end(); it++)
     {
         Ipv6RoutingTableEntry* j = it->first;
         uint32_t metric = it->second;
@@ -475,6 +510,8 @@ Ipv6StaticRouting::DoDispose()
         delete j->first;
     }
     m_networkRoutes.clear();
+    m_fibValid = false;
+    m_fib.Clear();
 
     for (auto i = m_multicastRoutes.begin(); i != m_multicastRoutes.end();
          i = m_multicastRoutes.erase(i))
@@ -634,6 +671,7 @@ Ipv6StaticRouting::RemoveRoute(uint32_t index)
         {
             delete it->first;
             m_networkRoutes.erase(it);
+            m_fibValid = false;
             return;
         }
         tmp++;
@@ -657,6 +695,7 @@ Ipv6StaticRouting::RemoveRoute(Ipv6Address network,
         {
             delete it->first;
             m_networkRoutes.erase(it);
+            m_fibValid = false;
             return;
         }
     }
@@ -799,6 +838,7 @@ Ipv6StaticRouting::NotifyInterfaceDown(uint32_t i)
         {
             delete it->first;
             it = m_networkRoutes.erase(it);
+            m_fibValid = false;
         }
         else
         {
@@ -837,6 +877,7 @@ Ipv6StaticRouting::NotifyRemoveAddress(uint32_t interface, Ipv6InterfaceAddress
         {
             delete it->first;
             it = m_networkRoutes.erase(it);
+            m_fibValid = false;
         }
         else
         {
@@ -895,6 +936,7 @@ Ipv6StaticRouting::NotifyRemoveRoute(Ipv6Address dst,
             {
                 delete j->first;
                 j = m_networkRoutes.erase(j);
+                m_fibValid = false;
             }
             else
             {
@@ -12,6 +12,7 @@
 #include "ipv6-header.h"
 #include "ipv6-routing-protocol.h"
 #include "ipv6.h"
+#include "prefix-trie.h"
 
 #include "ns3/ipv6-address.h"
 #include "ns3/ptr.h"
@@ -325,6 +326,24 @@ class Ipv6StaticRouting : public Ipv6RoutingProtocol
      */
     NetworkRoutes m_networkRoutes;
 
+    /// Index of the network routes by destination prefix
+    typedef PrefixTrie<16, NetworkRoutes::value_type> Fib;
+
+    /**
+     * \brief Rebuild the prefix index from the network routes.
+     */
+    void UpdateFib();
+
+    /**
+     * \brief the network routes indexed by destination prefix.
+     */
+    Fib m_fib;
+
+    /**
+     * \brief whether m_fib matches m_networkRoutes.
+     */
+    bool m_fibValid;
+
     /**
      * \brief the forwarding table for multicast.
      */
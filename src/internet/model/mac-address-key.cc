@@ -0,0 +1,18 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "mac-address-key.h"
+
+namespace ns3
+{
+
+std::string
+GetMacKey(const Address& address)
+{
+    uint8_t buffer[Address::MAX_SIZE];
+    uint32_t length = address.CopyTo(buffer);
+    return std::string(reinterpret_cast<const char*>(buffer), length);
+}
+
+} // namespace ns3
@@ -0,0 +1,31 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef MAC_ADDRESS_KEY_H
+#define MAC_ADDRESS_KEY_H
+
+#include "ns3/address.h"
+
+#include <string>
+
+namespace ns3
+{
+
+/**
+ * \ingroup internet
+ *
+ * Get the key indexing the entries of the ARP and NDISC caches by MAC address.
+ *
+ * The key is made of the bytes of the address only, so that the addresses
+ * which compare equal despite different types (e.g., the addresses learnt
+ * from ARP headers, which have no type) share the same key.
+ *
+ * \param address a MAC address
+ * \returns the bytes of the address
+ */
+std::string GetMacKey(const Address& address);
+
+} // namespace ns3
+
+#endif /* MAC_ADDRESS_KEY_H */
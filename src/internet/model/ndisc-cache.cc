@@ -11,12 +11,16 @@
 #include "icmpv6-l4-protocol.h"
 #include "ipv6-interface.h"
 #include "ipv6-l3-protocol.h"
+#include "mac-address-key.h"
 
 #include "ns3/log.h"
 #include "ns3/names.h"
 #include "ns3/node.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+#include <map>
+
 namespace ns3
 {
 
@@ -90,9 +94,10 @@ NdiscCache::Lookup(Ipv6Address dst)
 {
     NS_LOG_FUNCTION(this << dst);
 
-    if (m_ndCache.find(dst) != m_ndCache.end())
+    auto it = m_ndCache.find(dst);
+    if (it != m_ndCache.end())
     {
-        NdiscCache::Entry* entry = m_ndCache[dst];
+        NdiscCache::Entry* entry = it->second;
         NS_LOG_LOGIC("Found an entry: " << *entry);
 
         return entry;
@@ -107,15 +112,19 @@ NdiscCache::LookupInverse(Address dst)
     NS_LOG_FUNCTION(this << dst);
 
     std::list<NdiscCache::Entry*> entryList;
-    for (auto i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    auto [begin, end] = m_macIndex.equal_range(GetMacKey(dst));
+    for (auto i = begin; i != end; i++)
     {
-        NdiscCache::Entry* entry = (*i).second;
+        NdiscCache::Entry* entry = i->second;
         if (entry->GetMacAddress() == dst)
         {
             NS_LOG_LOGIC("Found an entry:" << (*entry));
             entryList.push_back(entry);
         }
     }
+    entryList.sort([](NdiscCache::Entry* a, NdiscCache::Entry* b) {
+        return a->GetIpv6Address() < b->GetIpv6Address();
+    });
     return entryList;
 }
 
@@ -128,6 +137,7 @@ NdiscCache::Add(Ipv6Address to)
     auto entry = new NdiscCache::Entry(this);
     entry->SetIpv6Address(to);
     m_ndCache[to] = entry;
+    AddToMacIndex(entry);
     return entry;
 }
 
@@ -136,13 +146,40 @@ NdiscCache::Remove(NdiscCache::Entry* entry)
 {
     NS_LOG_FUNCTION(this << entry);
 
-    for (auto i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    auto i = m_ndCache.find(entry->GetIpv6Address());
+    if (i == m_ndCache.end() || i->second != entry)
     {
-        if ((*i).second == entry)
+        // the address of the entry has been changed after its insertion
+        i = std::find_if(m_ndCache.begin(), m_ndCache.end(), [entry](const auto& item) {
+            return item.second == entry;
+        });
+    }
+    if (i != m_ndCache.end())
+    {
+        m_ndCache.erase(i);
+        RemoveFromMacIndex(entry);
+        entry->ClearWaitingPacket();
+        delete entry;
+    }
+}
+
+void
+NdiscCache::AddToMacIndex(NdiscCache::Entry* entry)
+{
+    NS_LOG_FUNCTION(this << entry);
+    m_macIndex.emplace(GetMacKey(entry->GetMacAddress()), entry);
+}
+
+void
+NdiscCache::RemoveFromMacIndex(NdiscCache::Entry* entry)
+{
+    NS_LOG_FUNCTION(this << entry);
+    auto [begin, end] = m_macIndex.equal_range(GetMacKey(entry->GetMacAddress()));
+    for (auto i = begin; i != end; i++)
+    {
+        if (i->second == entry)
         {
-            m_ndCache.erase(i);
-            entry->ClearWaitingPacket();
-            delete entry;
+            m_macIndex.erase(i);
             return;
         }
     }
@@ -159,6 +196,7 @@ NdiscCache::Flush()
     }
 
     m_ndCache.erase(m_ndCache.begin(), m_ndCache.end());
+    m_macIndex.clear();
 }
 
 void
@@ -181,7 +219,9 @@ NdiscCache::PrintNdiscCache(Ptr<OutputStreamWrapper> stream)
     NS_LOG_FUNCTION(this << stream);
     std::ostream* os = stream->GetStream();
 
-    for (auto i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    // print the entries in address order
+    std::map<Ipv6Address, NdiscCache::Entry*> sorted(m_ndCache.begin(), m_ndCache.end());
+    for (auto i = sorted.begin(); i != sorted.end(); i++)
     {
         *os << i->first << " dev ";
         std::string found = Names::FindName(m_device);
@@ -283,6 +323,13 @@ void
 NdiscCache::Entry::FunctionReachableTimeout()
 {
     NS_LOG_FUNCTION(this);
+    Time expiry = m_lastReachabilityConfirmation + m_nudTimer.GetDelay();
+    if (expiry > Simulator::Now())
+    {
+        // the reachability has been confirmed since the timer was scheduled
+        m_nudTimer.Schedule(expiry - Simulator::Now());
+        return;
+    }
     this->MarkStale();
 }
 
@@ -477,11 +524,10 @@ NdiscCache::Entry::UpdateReachableTimer()
     if (m_state == REACHABLE)
     {
         m_lastReachabilityConfirmation = Simulator::Now();
-        if (m_nudTimer.IsRunning())
+        if (!m_nudTimer.IsRunning())
         {
-            m_nudTimer.Cancel();
+            m_nudTimer.Schedule();
         }
-        m_nudTimer.Schedule();
     }
 }
 
@@ -552,7 +598,7 @@ NdiscCache::Entry::MarkReachable(Address mac)
 {
     NS_LOG_FUNCTION(this << mac);
     m_state = REACHABLE;
-    m_macAddress = mac;
+    SetMacAddress(mac);
     return m_waiting;
 }
 
@@ -582,7 +628,7 @@ NdiscCache::Entry::MarkStale(Address mac)
 {
     NS_LOG_FUNCTION(this << mac);
     m_state = STALE;
-    m_macAddress = mac;
+    SetMacAddress(mac);
     return m_waiting;
 }
 
@@ -669,7 +715,9 @@ void
 NdiscCache::Entry::SetMacAddress(Address mac)
 {
     NS_LOG_FUNCTION(this << mac << int(m_state));
+    m_ndCache->RemoveFromMacIndex(this);
     m_macAddress = mac;
+    m_ndCache->AddToMacIndex(this);
 }
 
 void
@@ -711,6 +759,7 @@ NdiscCache::RemoveAutoGeneratedEntries()
         if (i->second->IsAutoGenerated())
         {
             i->second->ClearWaitingPacket();
+            RemoveFromMacIndex(i->second);
             delete i->second;
             m_ndCache.erase(i++);
             continue;
@@ -18,8 +18,9 @@
 #include "ns3/timer.h"
 
 #include <list>
-#include <map>
 #include <stdint.h>
+#include <string>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -33,6 +34,9 @@ class Icmpv6L4Protocol;
  * \ingroup ipv6
  *
  * \brief IPv6 Neighbor Discovery cache.
+ *
+ * The entries are hashed by IPv6 address and indexed by MAC address, as
+ * both lookups are done for every received packet.
  */
 class NdiscCache : public Object
 {
@@ -324,6 +328,10 @@ class NdiscCache : public Object
 
         /**
          * \brief Update the reachable timer.
+         *
+         * Only the time of the reachability confirmation is updated while the
+         * reachable timer is running: the timer postpones itself when it
+         * expires, instead of being rescheduled for every received packet.
          */
         void UpdateReachableTimer();
 
@@ -446,11 +454,11 @@ class NdiscCache : public Object
     /**
      * \brief Neighbor Discovery Cache container
      */
-    typedef std::map<Ipv6Address, NdiscCache::Entry*> Cache;
+    typedef std::unordered_map<Ipv6Address, NdiscCache::Entry*, Ipv6AddressHash> Cache;
     /**
      * \brief Neighbor Discovery Cache container iterator
      */
-    typedef std::map<Ipv6Address, NdiscCache::Entry*>::iterator CacheI;
+    typedef Cache::iterator CacheI;
 
     /**
      * \brief A list of Entry.
@@ -458,6 +466,23 @@ class NdiscCache : public Object
     Cache m_ndCache;
 
   private:
+    /**
+     * \brief Index an entry by its MAC address.
+     * \param entry the entry
+     */
+    void AddToMacIndex(NdiscCache::Entry* entry);
+
+    /**
+     * \brief Remove an entry from the MAC address index.
+     * \param entry the entry
+     */
+    void RemoveFromMacIndex(NdiscCache::Entry* entry);
+
+    /**
+     * \brief The entries, indexed by the bytes of their MAC address.
+     */
+    std::unordered_multimap<std::string, NdiscCache::Entry*> m_macIndex;
+
     /**
      * \brief The NetDevice.
      */
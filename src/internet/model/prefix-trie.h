@@ -0,0 +1,293 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef PREFIX_TRIE_H
+#define PREFIX_TRIE_H
+
+#include "ns3/assert.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup internet
+ * ns3::PrefixTrie declaration and implementation.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup internet
+ *
+ * \brief Path-compressed binary radix trie indexing values by address prefix.
+ *
+ * The trie is the forwarding information base used by Ipv4GlobalRouting,
+ * Ipv4StaticRouting and Ipv6StaticRouting to find the routes matching a
+ * destination in time proportional to the address length, rather than to
+ * the number of routes.  Keys are addresses in network byte order, i.e.,
+ * N = 4 for IPv4 and N = 16 for IPv6.
+ *
+ * The trie does not select a route: Lookup() returns every value whose
+ * prefix contains the address, in insertion order, so that the routing
+ * protocols can apply their own metric and ECMP rules to the candidates
+ * exactly as they would when scanning their whole routing table.
+ *
+ * \tparam N The key length in bytes.
+ * \tparam T The type of the values.
+ */
+template <std::size_t N, typename T>
+class PrefixTrie
+{
+  public:
+    /** The key type, an address in network byte order. */
+    using Key = std::array<uint8_t, N>;
+
+    PrefixTrie();
+
+    /**
+     * Insert a value.  Several values can be stored with the same prefix.
+     *
+     * \param [in] prefix The prefix; the bits after \pname{length} are ignored.
+     * \param [in] length The prefix length in bits.
+     * \param [in] value The value.
+     */
+    void Insert(const Key& prefix, uint8_t length, T value);
+
+    /**
+     * Append to \pname{matches} the values whose prefix contains
+     * \pname{address}, in the order they have been inserted.
+     *
+     * \param [in] address The address.
+     * \param [out] matches The matching values.
+     */
+    void Lookup(const Key& address, std::vector<T>& matches) const;
+
+    /** Remove all the values. */
+    void Clear();
+
+    /** \returns the number of values stored. */
+    std::size_t GetSize() const;
+
+    /**
+     * Get the number of leading one bits of a mask, i.e., the length of the
+     * longest contiguous prefix it covers.
+     *
+     * \param [in] mask The mask in network byte order.
+     * \returns The number of leading one bits.
+     */
+    static uint8_t GetLeadingOnes(const Key& mask);
+
+  private:
+    /** A trie node, holding the values whose prefix is exactly the node prefix. */
+    struct Node
+    {
+        Key prefix{};                                 //!< Node prefix (trailing bits zeroed)
+        uint8_t length{0};                            //!< Node prefix length in bits
+        std::vector<std::pair<uint64_t, T>> values;   //!< Values and their insertion number
+        std::array<std::unique_ptr<Node>, 2> child{}; //!< Children, indexed by the next bit
+    };
+
+    /**
+     * \param [in] key The key.
+     * \param [in] bit The bit index, 0 being the most significant bit.
+     * \returns The value of the bit.
+     */
+    static uint8_t GetBit(const Key& key, uint8_t bit);
+
+    /**
+     * \param [in] key The key.
+     * \param [in] length The number of bits to keep.
+     * \returns The key with the bits after \pname{length} zeroed.
+     */
+    static Key Truncate(const Key& key, uint8_t length);
+
+    /**
+     * \param [in] a The first key.
+     * \param [in] b The second key.
+     * \param [in] max The maximum number of bits to compare.
+     * \returns The length of the common prefix of the keys, up to \pname{max}.
+     */
+    static uint8_t CommonLength(const Key& a, const Key& b, uint8_t max);
+
+    std::unique_ptr<Node> m_root; //!< The root node, holding the zero length prefix
+    uint64_t m_inserted;          //!< Number of insertions since the last Clear()
+};
+
+/***************************************************************
+ *  Implementation of the templates declared above.
+ ***************************************************************/
+
+template <std::size_t N, typename T>
+PrefixTrie<N, T>::PrefixTrie()
+    : m_root(std::make_unique<Node>()),
+      m_inserted(0)
+{
+}
+
+template <std::size_t N, typename T>
+uint8_t
+PrefixTrie<N, T>::GetBit(const Key& key, uint8_t bit)
+{
+    return (key[bit / 8] >> (7 - bit % 8)) & 1;
+}
+
+template <std::size_t N, typename T>
+typename PrefixTrie<N, T>::Key
+PrefixTrie<N, T>::Truncate(const Key& key, uint8_t length)
+{
+    Key truncated{};
+    for (std::size_t i = 0; i < N && length > 0; ++i)
+    {
+        uint8_t bits = std::min<uint8_t>(length, 8);
+        truncated[i] = key[i] & static_cast<uint8_t>(0xff << (8 - bits));
+        length -= bits;
+    }
+    return truncated;
+}
+
+template <std::size_t N, typename T>
+uint8_t
+PrefixTrie<N, T>::CommonLength(const Key& a, const Key& b, uint8_t max)
+{
+    uint8_t length = 0;
+    for (std::size_t i = 0; i < N && length < max; ++i)
+    {
+        uint8_t diff = a[i] ^ b[i];
+        if (diff == 0)
+        {
+            length += 8;
+            continue;
+        }
+        while ((diff & 0x80) == 0)
+        {
+            diff <<= 1;
+            ++length;
+        }
+        break;
+    }
+    return std::min(length, max);
+}
+
+template <std::size_t N, typename T>
+uint8_t
+PrefixTrie<N, T>::GetLeadingOnes(const Key& mask)
+{
+    uint8_t length = 0;
+    for (auto byte : mask)
+    {
+        if (byte == 0xff)
+        {
+            length += 8;
+            continue;
+        }
+        while (byte & 0x80)
+        {
+            byte <<= 1;
+            ++length;
+        }
+        break;
+    }
+    return length;
+}
+
+template <std::size_t N, typename T>
+void
+PrefixTrie<N, T>::Insert(const Key& prefix, uint8_t length, T value)
+{
+    NS_ASSERT_MSG(length <= 8 * N, "Prefix length " << +length << " too long");
+    Key key = Truncate(prefix, length);
+    Node* node = m_root.get();
+    while (node->length < length)
+    {
+        auto& next = node->child[GetBit(key, node->length)];
+        if (!next)
+        {
+            next = std::make_unique<Node>();
+            next->prefix = key;
+            next->length = length;
+            node = next.get();
+            break;
+        }
+        uint8_t common = CommonLength(key, next->prefix, std::min(length, next->length));
+        if (common < next->length)
+        {
+            // split the edge with an intermediate node holding the common prefix
+            auto split = std::make_unique<Node>();
+            split->prefix = Truncate(key, common);
+            split->length = common;
+            split->child[GetBit(next->prefix, common)] = std::move(next);
+            next = std::move(split);
+        }
+        node = next.get();
+    }
+    node->values.emplace_back(m_inserted++, std::move(value));
+}
+
+template <std::size_t N, typename T>
+void
+PrefixTrie<N, T>::Lookup(const Key& address, std::vector<T>& matches) const
+{
+    std::vector<std::pair<uint64_t, T>> found;
+    const Node* node = m_root.get();
+    while (node)
+    {
+        if (CommonLength(address, node->prefix, node->length) < node->length)
+        {
+            break;
+        }
+        found.insert(found.end(), node->values.begin(), node->values.end());
+        if (node->length == 8 * N)
+        {
+            break;
+        }
+        node = node->child[GetBit(address, node->length)].get();
+    }
+    std::sort(found.begin(), found.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+    for (auto& [inserted, value] : found)
+    {
+        matches.push_back(std::move(value));
+    }
+}
+
+template <std::size_t N, typename T>
+void
+PrefixTrie<N, T>::Clear()
+{
+    m_root = std::make_unique<Node>();
+    m_inserted = 0;
+}
+
+template <std::size_t N, typename T>
+std::size_t
+PrefixTrie<N, T>::GetSize() const
+{
+    std::size_t size = 0;
+    std::vector<const Node*> stack{m_root.get()};
+    while (!stack.empty())
+    {
+        const Node* node = stack.back();
+        stack.pop_back();
+        size += node->values.size();
+        for (const auto& child : node->child)
+        {
+            if (child)
+            {
+                stack.push_back(child.get());
+            }
+        }
+    }
+    return size;
+}
+
+} // namespace ns3
+
+#endif /* PREFIX_TRIE_H */
@@ -0,0 +1,251 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "tcp-fluid-model.h"
+
+#include "ns3/log.h"
+#include "ns3/object-factory.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TcpFluidModel");
+
+NS_OBJECT_ENSURE_REGISTERED(TcpFluidModel);
+
+TypeId
+TcpFluidModel::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::TcpFluidModel")
+            .SetParent<Object>()
+            .SetGroupName("Internet")
+            .AddConstructor<TcpFluidModel>()
+            .AddAttribute("TimeStep",
+                          "Time step of the model; it should be much shorter than the RTTs",
+                          TimeValue(MilliSeconds(1)),
+                          MakeTimeAccessor(&TcpFluidModel::m_timeStep),
+                          MakeTimeChecker(TimeStep(1)))
+            .AddAttribute("SegmentSize",
+                          "Segment size of the flows, in bytes",
+                          UintegerValue(1448),
+                          MakeUintegerAccessor(&TcpFluidModel::m_segmentSize),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("InitialCwnd",
+                          "Initial congestion window of the flows, in segments",
+                          UintegerValue(10),
+                          MakeUintegerAccessor(&TcpFluidModel::m_initialCwnd),
+                          MakeUintegerChecker<uint32_t>(1));
+    return tid;
+}
+
+TcpFluidModel::TcpFluidModel()
+    : m_fluidOffered(0),
+      m_fluidDropped(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TcpFluidModel::~TcpFluidModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+TcpFluidModel::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_stepEvent.Cancel();
+    m_queueDisc = nullptr;
+    m_classes.clear();
+    Object::DoDispose();
+}
+
+void
+TcpFluidModel::SetQueueDisc(Ptr<FluidFifoQueueDisc> queueDisc)
+{
+    NS_LOG_FUNCTION(this << queueDisc);
+    m_queueDisc = queueDisc;
+}
+
+uint32_t
+TcpFluidModel::AddFlows(uint32_t nFlows, Time baseRtt, TypeId congestionTypeId)
+{
+    NS_LOG_FUNCTION(this << nFlows << baseRtt << congestionTypeId);
+    NS_ABORT_MSG_IF(baseRtt.IsNegative() || baseRtt.IsZero(), "The base RTT must be positive");
+
+    ObjectFactory factory(congestionTypeId.GetName());
+    FlowClass flows;
+    flows.nFlows = nFlows;
+    flows.baseRtt = baseRtt;
+    flows.rtt = baseRtt;
+    flows.tcb = CreateObject<TcpSocketState>();
+    flows.congestion = factory.Create<TcpCongestionOps>();
+    NS_ABORT_MSG_IF(flows.congestion->HasCongControl(),
+                    flows.congestion->GetName() << " cannot be modeled as a fluid");
+    m_classes.push_back(std::move(flows));
+    return m_classes.size() - 1;
+}
+
+void
+TcpFluidModel::Start()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ABORT_MSG_IF(!m_queueDisc, "The queue disc of the bottleneck has not been set");
+    NS_ABORT_MSG_IF(m_stepEvent.IsPending(), "The flows are already started");
+
+    Time queueingDelay = m_queueDisc->GetQueueingDelay();
+    for (auto& flows : m_classes)
+    {
+        // bulk senders, always limited by their congestion window
+        auto tcb = flows.tcb;
+        tcb->m_segmentSize = m_segmentSize;
+        tcb->m_initialCWnd = m_initialCwnd;
+        tcb->m_cWnd = m_initialCwnd * m_segmentSize;
+        tcb->m_ssThresh = UINT32_MAX;
+        tcb->m_isCwndLimited = true;
+        tcb->m_congState = TcpSocketState::CA_OPEN;
+        tcb->m_lastAckedSeq = SequenceNumber32(0);
+        tcb->m_highTxMark = tcb->m_lastAckedSeq + tcb->m_cWnd;
+        flows.feedback.clear();
+        flows.acked = 0;
+        flows.lost = 0;
+        flows.rtt = flows.baseRtt + queueingDelay;
+        flows.congestion->Init(tcb);
+    }
+    m_fluidOffered = m_queueDisc->GetFluidOffered();
+    m_fluidDropped = m_queueDisc->GetFluidDropped();
+    m_queueDisc->SetFluidRate(GetRate());
+    m_stepEvent = Simulator::Schedule(m_timeStep, &TcpFluidModel::Step, this);
+}
+
+void
+TcpFluidModel::Stop()
+{
+    NS_LOG_FUNCTION(this);
+    m_stepEvent.Cancel();
+    if (m_queueDisc)
+    {
+        m_queueDisc->SetFluidRate(DataRate(0));
+    }
+}
+
+uint32_t
+TcpFluidModel::GetCwnd(uint32_t index) const
+{
+    NS_ASSERT(index < m_classes.size());
+    return m_classes[index].tcb->m_cWnd;
+}
+
+DataRate
+TcpFluidModel::GetRate(uint32_t index) const
+{
+    NS_ASSERT(index < m_classes.size());
+    const auto& flows = m_classes[index];
+    return DataRate(
+        static_cast<uint64_t>(flows.nFlows * 8.0 * flows.tcb->m_cWnd / flows.rtt.GetSeconds()));
+}
+
+DataRate
+TcpFluidModel::GetRate() const
+{
+    DataRate rate(0);
+    for (uint32_t index = 0; index < m_classes.size(); index++)
+    {
+        rate += GetRate(index);
+    }
+    return rate;
+}
+
+void
+TcpFluidModel::Step()
+{
+    NS_LOG_FUNCTION(this);
+
+    Time now = Simulator::Now();
+    Time queueingDelay = m_queueDisc->GetQueueingDelay();
+    // the fraction of the fluid sent during the last step that was dropped
+    double offered = m_queueDisc->GetFluidOffered() - m_fluidOffered;
+    double dropped = m_queueDisc->GetFluidDropped() - m_fluidDropped;
+    double lossRatio = (offered > 0 ? dropped / offered : 0);
+    m_fluidOffered += offered;
+    m_fluidDropped += dropped;
+
+    for (auto& flows : m_classes)
+    {
+        // the window and the RTT have not changed during the last step
+        double sent = flows.tcb->m_cWnd * m_timeStep.GetSeconds() / flows.rtt.GetSeconds() /
+                      m_segmentSize;
+        flows.feedback.push_back({now + flows.rtt, sent * (1 - lossRatio), sent * lossRatio});
+        flows.rtt = flows.baseRtt + queueingDelay;
+        ProcessFeedback(flows);
+    }
+
+    m_queueDisc->SetFluidRate(GetRate());
+    m_stepEvent = Simulator::Schedule(m_timeStep, &TcpFluidModel::Step, this);
+}
+
+void
+TcpFluidModel::ProcessFeedback(FlowClass& flows)
+{
+    Time now = Simulator::Now();
+    while (!flows.feedback.empty() && flows.feedback.front().due <= now)
+    {
+        flows.acked += flows.feedback.front().acked;
+        flows.lost += flows.feedback.front().lost;
+        flows.feedback.pop_front();
+    }
+
+    auto tcb = flows.tcb;
+    auto congestion = flows.congestion;
+
+    if (tcb->m_congState == TcpSocketState::CA_RECOVERY && now >= flows.recoveryEnd)
+    {
+        NS_LOG_DEBUG("Exiting CA_RECOVERY, cwnd " << tcb->m_cWnd);
+        congestion->CongestionStateSet(tcb, TcpSocketState::CA_OPEN);
+        tcb->m_congState = TcpSocketState::CA_OPEN;
+        tcb->m_cWnd = tcb->m_ssThresh.Get();
+    }
+
+    if (flows.lost >= 1)
+    {
+        // the losses of a window are recovered with a single reduction
+        if (tcb->m_congState != TcpSocketState::CA_RECOVERY)
+        {
+            tcb->m_ssThresh = congestion->GetSsThresh(tcb, tcb->m_cWnd);
+            congestion->CongestionStateSet(tcb, TcpSocketState::CA_RECOVERY);
+            tcb->m_congState = TcpSocketState::CA_RECOVERY;
+            tcb->m_cWnd = tcb->m_ssThresh.Get();
+            flows.recoveryEnd = now + flows.rtt;
+            NS_LOG_DEBUG("Entering CA_RECOVERY, cwnd " << tcb->m_cWnd);
+        }
+        flows.lost = 0;
+    }
+
+    auto segmentsAcked = static_cast<uint32_t>(std::floor(flows.acked));
+    if (segmentsAcked == 0)
+    {
+        return;
+    }
+    flows.acked -= segmentsAcked;
+
+    tcb->m_lastAckedSeq += segmentsAcked * m_segmentSize;
+    tcb->m_highTxMark = tcb->m_lastAckedSeq + tcb->m_cWnd;
+    tcb->m_lastRtt = flows.rtt;
+    tcb->m_srtt = flows.rtt;
+    tcb->m_minRtt = std::min(tcb->m_minRtt, flows.rtt);
+
+    congestion->PktsAcked(tcb, segmentsAcked, flows.rtt);
+    if (tcb->m_congState == TcpSocketState::CA_OPEN)
+    {
+        congestion->IncreaseWindow(tcb, segmentsAcked);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,158 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef TCP_FLUID_MODEL_H
+#define TCP_FLUID_MODEL_H
+
+#include "tcp-congestion-ops.h"
+#include "tcp-socket-state.h"
+
+#include "ns3/data-rate.h"
+#include "ns3/event-id.h"
+#include "ns3/fluid-fifo-queue-disc.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+
+#include <deque>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup tcp
+ *
+ * \brief Fluid model of long-lived background TCP flows.
+ *
+ * Simulating thousands of bulk TCP flows packet by packet only to load a
+ * bottleneck is expensive.  This model replaces them with their aggregate
+ * rate, which feeds a FluidFifoQueueDisc installed on the bottleneck device
+ * next to the foreground packet flows.  The time is advanced in steps of
+ * TimeStep: at every step, each flow sends a window of data per round trip
+ * time, made of the base RTT of the flow and of the current queueing delay
+ * of the queue disc, and the fraction of the data the queue disc drops is
+ * reported to the flow one RTT later, as losses, while the rest is reported
+ * as acknowledged segments.
+ *
+ * The congestion windows are computed by the same TcpCongestionOps as the
+ * packet-level sockets (e.g., TcpNewReno, TcpCubic), driven through a
+ * TcpSocketState as TcpSocketBase does: PktsAcked() and IncreaseWindow()
+ * for the acknowledged segments, and GetSsThresh() with a transition through
+ * CA_RECOVERY, at most once per RTT, for the losses.  Congestion controls
+ * replacing the window update through CongControl() are not supported.
+ *
+ * The flows sharing a base RTT and a congestion control are added as a
+ * single class with AddFlows(), and are represented by a single congestion
+ * window: they are fully synchronized.  Adding the flows as several classes,
+ * e.g., with slightly different RTTs, desynchronizes them.
+ */
+class TcpFluidModel : public Object
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    TcpFluidModel();
+    ~TcpFluidModel() override;
+
+    /**
+     * \brief Set the queue disc of the bottleneck the flows are sent through.
+     *
+     * \param queueDisc The queue disc.
+     */
+    void SetQueueDisc(Ptr<FluidFifoQueueDisc> queueDisc);
+
+    /**
+     * \brief Add a class of synchronized flows.
+     *
+     * \param nFlows The number of flows.
+     * \param baseRtt The RTT of the flows, excluding the bottleneck queueing delay.
+     * \param congestionTypeId The type of the congestion control of the flows.
+     * \returns The index of the class.
+     */
+    uint32_t AddFlows(uint32_t nFlows,
+                      Time baseRtt,
+                      TypeId congestionTypeId = TcpNewReno::GetTypeId());
+
+    /**
+     * \brief Start the flows, in slow start.
+     */
+    void Start();
+
+    /**
+     * \brief Stop the flows.
+     */
+    void Stop();
+
+    /**
+     * \param index The index of a class.
+     * \returns The congestion window of each flow of the class, in bytes.
+     */
+    uint32_t GetCwnd(uint32_t index) const;
+
+    /**
+     * \param index The index of a class.
+     * \returns The aggregate sending rate of the flows of the class.
+     */
+    DataRate GetRate(uint32_t index) const;
+
+    /**
+     * \returns The aggregate sending rate of all the flows.
+     */
+    DataRate GetRate() const;
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /** The loss feedback of a step, reaching the senders one RTT later. */
+    struct Feedback
+    {
+        Time due;     //!< Time the feedback reaches the senders
+        double acked; //!< Segments acknowledged per flow
+        double lost;  //!< Segments lost per flow
+    };
+
+    /** A class of synchronized flows. */
+    struct FlowClass
+    {
+        uint32_t nFlows;                  //!< Number of flows
+        Time baseRtt;                     //!< RTT excluding the bottleneck queueing delay
+        Time rtt;                         //!< Current RTT
+        Ptr<TcpSocketState> tcb;          //!< State of the representative flow
+        Ptr<TcpCongestionOps> congestion; //!< Congestion control of the representative flow
+        std::deque<Feedback> feedback;    //!< Feedback in flight
+        double acked{0};                  //!< Acknowledged segments not reported yet
+        double lost{0};                   //!< Lost segments not reported yet
+        Time recoveryEnd;                 //!< End of the current loss recovery
+    };
+
+    /**
+     * \brief Advance the flows by one step.
+     */
+    void Step();
+
+    /**
+     * \brief Report the feedback due to the senders of a class.
+     *
+     * \param flows The class.
+     */
+    void ProcessFeedback(FlowClass& flows);
+
+    Time m_timeStep;                     //!< Time step of the model
+    uint32_t m_segmentSize;              //!< Segment size of the flows
+    uint32_t m_initialCwnd;              //!< Initial congestion window, in segments
+    Ptr<FluidFifoQueueDisc> m_queueDisc; //!< Bottleneck queue disc
+    std::vector<FlowClass> m_classes;    //!< Classes of flows
+    EventId m_stepEvent;                 //!< Next step
+    double m_fluidOffered;               //!< Fluid offered to the queue disc at the last step
+    double m_fluidDropped;               //!< Fluid dropped by the queue disc at the last step
+};
+
+} // namespace ns3
+
+#endif /* TCP_FLUID_MODEL_H */
@@ -21,6 +21,7 @@
 #include "tcp-congestion-ops.h"
 #include "tcp-cubic.h"
 #include "tcp-header.h"
+#include "tcp-option-ts.h"
 #include "tcp-prr-recovery.h"
 #include "tcp-recovery-ops.h"
 #include "tcp-socket-base.h"
@@ -34,6 +35,7 @@
 #include "ns3/object-map.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
+#include "ns3/uinteger.h"
 
 #include <iomanip>
 #include <sstream>
@@ -88,7 +90,20 @@ TcpL4Protocol::GetTypeId()
                           "is kept for backward compatibility.",
                           ObjectMapValue(),
                           MakeObjectMapAccessor(&TcpL4Protocol::m_sockets),
-                          MakeObjectMapChecker<TcpSocketBase>());
+                          MakeObjectMapChecker<TcpSocketBase>())
+            .AddAttribute("GroTimeout",
+                          "Maximum time an in-order data segment is held to be coalesced with "
+                          "the following segments of the same connection before being "
+                          "forwarded to the socket (Generic Receive Offload). "
+                          "Zero disables the coalescing.",
+                          TimeValue(Time(0)),
+                          MakeTimeAccessor(&TcpL4Protocol::m_groTimeout),
+                          MakeTimeChecker(Time(0)))
+            .AddAttribute("GroMaxSize",
+                          "Maximum payload size of the segments coalesced together, in bytes.",
+                          UintegerValue(65535),
+                          MakeUintegerAccessor(&TcpL4Protocol::m_groMaxSize),
+                          MakeUintegerChecker<uint32_t>());
     return tid;
 }
 
@@ -160,6 +175,12 @@ TcpL4Protocol::DoDispose()
     NS_LOG_FUNCTION(this);
     m_sockets.clear();
 
+    for (auto& [endPoint, batch] : m_groBatches)
+    {
+        batch.flushEvent.Cancel();
+    }
+    m_groBatches.clear();
+
     if (m_endPoints != nullptr)
     {
         delete m_endPoints;
@@ -259,6 +280,7 @@ void
 TcpL4Protocol::DeAllocate(Ipv4EndPoint* endPoint)
 {
     NS_LOG_FUNCTION(this << endPoint);
+    DiscardGro(endPoint);
     m_endPoints->DeAllocate(endPoint);
 }
 
@@ -305,6 +327,7 @@ void
 TcpL4Protocol::DeAllocate(Ipv6EndPoint* endPoint)
 {
     NS_LOG_FUNCTION(this << endPoint);
+    DiscardGro(endPoint);
     m_endPoints6->DeAllocate(endPoint);
 }
 
@@ -506,8 +529,28 @@ TcpL4Protocol::Receive(Ptr<Packet> packet,
                                   << " received a packet and"
                                      " now forwarding it up to endpoint/socket");
 
-    (*endPoints.begin())
-        ->ForwardUp(packet, incomingIpHeader, incomingTcpHeader.GetSourcePort(), incomingInterface);
+    Ipv4EndPoint* endPoint = *endPoints.begin();
+    uint16_t sport = incomingTcpHeader.GetSourcePort();
+    if (!m_groTimeout.IsZero())
+    {
+        auto forwardUp = [endPoint, incomingIpHeader, sport, incomingInterface](Ptr<Packet> p) {
+            endPoint->ForwardUp(p, incomingIpHeader, sport, incomingInterface);
+        };
+        switch (Coalesce(endPoint,
+                         packet,
+                         incomingTcpHeader,
+                         incomingIpHeader.GetTos(),
+                         forwardUp))
+        {
+        case GRO_HELD:
+            return IpL4Protocol::RX_OK;
+        case GRO_FLUSHED:
+            return Receive(packet, incomingIpHeader, incomingInterface);
+        case GRO_NONE:
+            break;
+        }
+    }
+    endPoint->ForwardUp(packet, incomingIpHeader, sport, incomingInterface);
 
     return IpL4Protocol::RX_OK;
 }
@@ -566,12 +609,158 @@ TcpL4Protocol::Receive(Ptr<Packet> packet,
                                   << " received a packet and"
                                      " now forwarding it up to endpoint/socket");
 
-    (*endPoints.begin())
-        ->ForwardUp(packet, incomingIpHeader, incomingTcpHeader.GetSourcePort(), interface);
+    Ipv6EndPoint* endPoint = *endPoints.begin();
+    uint16_t sport = incomingTcpHeader.GetSourcePort();
+    if (!m_groTimeout.IsZero())
+    {
+        auto forwardUp = [endPoint, incomingIpHeader, sport, interface](Ptr<Packet> p) {
+            endPoint->ForwardUp(p, incomingIpHeader, sport, interface);
+        };
+        switch (Coalesce(endPoint,
+                         packet,
+                         incomingTcpHeader,
+                         incomingIpHeader.GetTrafficClass(),
+                         forwardUp))
+        {
+        case GRO_HELD:
+            return IpL4Protocol::RX_OK;
+        case GRO_FLUSHED:
+            return Receive(packet, incomingIpHeader, interface);
+        case GRO_NONE:
+            break;
+        }
+    }
+    endPoint->ForwardUp(packet, incomingIpHeader, sport, interface);
 
     return IpL4Protocol::RX_OK;
 }
 
+/**
+ * \brief Check whether a segment can be coalesced with other segments
+ * \param header The TCP header of the segment
+ * \param payloadSize The payload size of the segment
+ * \return true if the segment carries data, only the ACK flag and no option but timestamps
+ */
+static bool
+IsCoalescable(const TcpHeader& header, uint32_t payloadSize)
+{
+    if (payloadSize == 0 || header.GetFlags() != TcpHeader::ACK)
+    {
+        return false;
+    }
+    for (const auto& option : header.GetOptionList())
+    {
+        uint8_t kind = option->GetKind();
+        if (kind != TcpOption::TS && kind != TcpOption::NOP && kind != TcpOption::END)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * \brief Check whether two segments carry the same timestamps, if any
+ * \param a The TCP header of the first segment
+ * \param b The TCP header of the second segment
+ * \return true if both segments have no timestamps or the same timestamps
+ */
+static bool
+HaveSameTimestamps(const TcpHeader& a, const TcpHeader& b)
+{
+    auto tsA = DynamicCast<const TcpOptionTS>(a.GetOption(TcpOption::TS));
+    auto tsB = DynamicCast<const TcpOptionTS>(b.GetOption(TcpOption::TS));
+    if (!tsA || !tsB)
+    {
+        return !tsA && !tsB;
+    }
+    return tsA->GetTimestamp() == tsB->GetTimestamp() && tsA->GetEcho() == tsB->GetEcho();
+}
+
+TcpL4Protocol::GroResult
+TcpL4Protocol::Coalesce(const void* endPoint,
+                        Ptr<Packet> packet,
+                        const TcpHeader& header,
+                        uint8_t tos,
+                        std::function<void(Ptr<Packet>)> forwardUp)
+{
+    NS_LOG_FUNCTION(this << endPoint << packet << header << +tos);
+
+    uint32_t payloadSize = packet->GetSize() - header.GetSerializedSize();
+    bool coalescable = IsCoalescable(header, payloadSize);
+
+    auto it = m_groBatches.find(endPoint);
+    if (it != m_groBatches.end())
+    {
+        GroBatch& batch = it->second;
+        if (coalescable && header.GetSequenceNumber() == batch.nextSeq && tos == batch.tos &&
+            header.GetAckNumber() == batch.header.GetAckNumber() &&
+            header.GetWindowSize() == batch.header.GetWindowSize() &&
+            HaveSameTimestamps(header, batch.header) &&
+            batch.size + payloadSize <= m_groMaxSize)
+        {
+            NS_LOG_LOGIC("Coalescing seq " << header.GetSequenceNumber() << " data size "
+                                           << payloadSize << " with " << batch.size
+                                           << " bytes from seq "
+                                           << batch.header.GetSequenceNumber());
+            packet->RemoveAtStart(header.GetSerializedSize());
+            batch.packet->AddAtEnd(packet);
+            batch.nextSeq += payloadSize;
+            batch.size += payloadSize;
+            return GRO_HELD;
+        }
+        FlushGro(endPoint);
+        return GRO_FLUSHED;
+    }
+
+    if (!coalescable)
+    {
+        return GRO_NONE;
+    }
+    NS_LOG_LOGIC("Holding seq " << header.GetSequenceNumber() << " data size " << payloadSize);
+    GroBatch& batch = m_groBatches[endPoint];
+    batch.packet = packet;
+    batch.header = header;
+    batch.tos = tos;
+    batch.nextSeq = header.GetSequenceNumber() + SequenceNumber32(payloadSize);
+    batch.size = payloadSize;
+    batch.forwardUp = std::move(forwardUp);
+    batch.flushEvent = Simulator::Schedule(m_groTimeout, &TcpL4Protocol::FlushGro, this, endPoint);
+    return GRO_HELD;
+}
+
+void
+TcpL4Protocol::FlushGro(const void* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+
+    auto it = m_groBatches.find(endPoint);
+    if (it == m_groBatches.end())
+    {
+        return;
+    }
+    // remove the batch first, the socket may receive other segments meanwhile
+    GroBatch batch = std::move(it->second);
+    m_groBatches.erase(it);
+    batch.flushEvent.Cancel();
+    NS_LOG_LOGIC("Forwarding up " << batch.size << " bytes from seq "
+                                  << batch.header.GetSequenceNumber());
+    batch.forwardUp(batch.packet);
+}
+
+void
+TcpL4Protocol::DiscardGro(const void* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+
+    auto it = m_groBatches.find(endPoint);
+    if (it != m_groBatches.end())
+    {
+        it->second.flushEvent.Cancel();
+        m_groBatches.erase(it);
+    }
+}
+
 void
 TcpL4Protocol::SendPacketV4(Ptr<Packet> packet,
                             const TcpHeader& outgoing,
@@ -687,9 +876,33 @@ TcpL4Protocol::SendPacket(Ptr<Packet> pkt,
                           const TcpHeader& outgoing,
                           const Address& saddr,
                           const Address& daddr,
-                          Ptr<NetDevice> oif) const
+                          Ptr<NetDevice> oif,
+                          uint32_t segmentSize) const
 {
-    NS_LOG_FUNCTION(this << pkt << outgoing << saddr << daddr << oif);
+    NS_LOG_FUNCTION(this << pkt << outgoing << saddr << daddr << oif << segmentSize);
+    if (segmentSize > 0 && pkt->GetSize() > segmentSize)
+    {
+        // Segmentation offload: split the super-segment right before IP
+        uint32_t size = pkt->GetSize();
+        for (uint32_t offset = 0; offset < size; offset += segmentSize)
+        {
+            uint32_t length = std::min(segmentSize, size - offset);
+            uint8_t flags = outgoing.GetFlags();
+            if (offset > 0)
+            {
+                flags &= ~TcpHeader::CWR;
+            }
+            if (offset + length < size)
+            {
+                flags &= ~TcpHeader::FIN;
+            }
+            TcpHeader header = outgoing;
+            header.SetFlags(flags);
+            header.SetSequenceNumber(outgoing.GetSequenceNumber() + SequenceNumber32(offset));
+            SendPacket(pkt->CreateFragment(offset, length), header, saddr, daddr, oif);
+        }
+        return;
+    }
     if (Ipv4Address::IsMatchingType(saddr))
     {
         NS_ASSERT(Ipv4Address::IsMatchingType(daddr));
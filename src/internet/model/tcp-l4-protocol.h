@@ -10,11 +10,15 @@
 #define TCP_L4_PROTOCOL_H
 
 #include "ip-l4-protocol.h"
+#include "tcp-header.h"
 
+#include "ns3/event-id.h"
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv6-address.h"
+#include "ns3/nstime.h"
 #include "ns3/sequence-number.h"
 
+#include <functional>
 #include <stdint.h>
 #include <unordered_map>
 
@@ -23,7 +27,6 @@ namespace ns3
 
 class Node;
 class Socket;
-class TcpHeader;
 class Ipv4EndPointDemux;
 class Ipv6EndPointDemux;
 class Ipv4Interface;
@@ -61,6 +64,16 @@ class NetDevice;
  * and SHOULD checksum packets its receives from the socket layer going down
  * the stack, but currently checksumming is disabled.
  *
+ * This class also implements the segmentation offloads found in real stacks.
+ * SendPacket can split a super-segment built by a socket into segments of a
+ * given size (see the TcpSocketBase TsoMaxSegments attribute), and, when the
+ * GroTimeout attribute is not zero, the in-order data segments received by a
+ * connection are held for up to GroTimeout and coalesced into a single
+ * segment before being forwarded to the socket, as done by Generic Receive
+ * Offload. Segments are only coalesced if they carry data, no flag other
+ * than ACK and no option other than timestamps, and if they have the same
+ * acknowledgment number, window, timestamps and IP TOS or traffic class.
+ *
  * \see CreateSocket
  * \see NotifyNewAggregate
  * \see SendPacket
@@ -211,12 +224,17 @@ class TcpL4Protocol : public IpL4Protocol
      * \param saddr The source Ipv4Address
      * \param daddr The destination Ipv4Address
      * \param oif The output interface bound. Defaults to null (unspecified).
+     * \param segmentSize If not zero, the packet is a super-segment which is
+     *        split into segments of at most segmentSize bytes, each with a copy of
+     *        the header with the sequence number advanced. FIN is only set in the
+     *        last segment, and CWR in the first one.
      */
     void SendPacket(Ptr<Packet> pkt,
                     const TcpHeader& outgoing,
                     const Address& saddr,
                     const Address& daddr,
-                    Ptr<NetDevice> oif = nullptr) const;
+                    Ptr<NetDevice> oif = nullptr,
+                    uint32_t segmentSize = 0) const;
 
     /**
      * \brief Make a socket fully operational
@@ -324,6 +342,58 @@ class TcpL4Protocol : public IpL4Protocol
                           const Address& incomingDAddr);
 
   private:
+    /// Result of the coalescing of a received segment
+    enum GroResult
+    {
+        GRO_HELD,    //!< The segment is held to be coalesced
+        GRO_FLUSHED, //!< The segments held for the endpoint have been forwarded up
+        GRO_NONE,    //!< The segment must be forwarded up
+    };
+
+    /// Segments of a connection held to be coalesced
+    struct GroBatch
+    {
+        Ptr<Packet> packet;                         //!< First segment with the coalesced payloads
+        TcpHeader header;                           //!< TCP header of the first segment
+        uint8_t tos{0};                             //!< IP TOS or traffic class of the segments
+        SequenceNumber32 nextSeq;                   //!< Sequence number extending the batch
+        uint32_t size{0};                           //!< Payload size
+        std::function<void(Ptr<Packet>)> forwardUp; //!< Forward a packet up to the endpoint
+        EventId flushEvent;                         //!< Flush timeout
+    };
+
+    /**
+     * \brief Coalesce a received segment with the segments held for its endpoint
+     *
+     * If the segment cannot extend the batch held for the endpoint, the batch is
+     * forwarded up, and the segment has to be demultiplexed again because the
+     * socket may have been closed in the meantime.
+     *
+     * \param endPoint The endpoint of the segment
+     * \param packet The segment, with its TCP header
+     * \param header The TCP header
+     * \param tos The IP TOS or traffic class
+     * \param forwardUp Forward a packet up to the endpoint
+     * \return what has been done with the segment
+     */
+    GroResult Coalesce(const void* endPoint,
+                       Ptr<Packet> packet,
+                       const TcpHeader& header,
+                       uint8_t tos,
+                       std::function<void(Ptr<Packet>)> forwardUp);
+
+    /**
+     * \brief Forward up the segments held for an endpoint, if any
+     * \param endPoint The endpoint
+     */
+    void FlushGro(const void* endPoint);
+
+    /**
+     * \brief Discard the segments held for an endpoint which is deallocated
+     * \param endPoint The endpoint
+     */
+    void DiscardGro(const void* endPoint);
+
     Ptr<Node> m_node;                //!< the node this stack is associated with
     Ipv4EndPointDemux* m_endPoints;  //!< A list of IPv4 end points.
     Ipv6EndPointDemux* m_endPoints6; //!< A list of IPv6 end points.
@@ -335,6 +405,9 @@ class TcpL4Protocol : public IpL4Protocol
     uint64_t m_socketIndex{0}; //!< index of the next socket to be created
     IpL4Protocol::DownTargetCallback m_downTarget;   //!< Callback to send packets over IPv4
     IpL4Protocol::DownTargetCallback6 m_downTarget6; //!< Callback to send packets over IPv6
+    Time m_groTimeout;     //!< Maximum time a segment is held to be coalesced
+    uint32_t m_groMaxSize; //!< Maximum payload size of coalesced segments
+    std::unordered_map<const void*, GroBatch> m_groBatches; //!< Held segments by endpoint
 
     /**
      * \brief Send a packet via TCP (IPv4)
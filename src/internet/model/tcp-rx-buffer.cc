@@ -160,68 +160,77 @@ TcpRxBuffer::Add(Ptr<Packet> p, const TcpHeader& tcph)
             headSeq = tailSeq;
         }
     }
-    // Remove overlapped bytes from packet
-    auto i = m_data.begin();
-    while (i != m_data.end() && i->first <= tailSeq)
-    {
-        SequenceNumber32 lastByteSeq = i->first + SequenceNumber32(i->second->GetSize());
-        if (lastByteSeq > headSeq)
-        {
-            if (i->first > headSeq && lastByteSeq < tailSeq)
-            { // Rare case: Existing packet is embedded fully in the new packet
-                m_size -= i->second->GetSize();
-                m_data.erase(i++);
-                continue;
-            }
-            if (i->first <= headSeq)
-            { // Incoming head is overlapped
-                headSeq = lastByteSeq;
-            }
-            if (lastByteSeq >= tailSeq)
-            { // Incoming tail is overlapped
-                tailSeq = i->first;
-            }
-        }
-        ++i;
-    }
-    // We now know how much we are going to store, trim the packet
     if (headSeq >= tailSeq)
     {
         NS_LOG_LOGIC("Nothing to buffer");
         return false; // Nothing to buffer anyway
     }
-    else
+
+    // Find the first block overlapping or touching the packet, i.e., the last
+    // block starting before the packet if it reaches the packet head
+    BufIterator i = m_data.upper_bound(headSeq);
+    if (i != m_data.begin() &&
+        std::prev(i)->first + SequenceNumber32(std::prev(i)->second.size) >= headSeq)
     {
-        uint32_t start = static_cast<uint32_t>(headSeq - tcph.GetSequenceNumber());
-        auto length = static_cast<uint32_t>(tailSeq - headSeq);
-        p = p->CreateFragment(start, length);
-        NS_ASSERT(length == p->GetSize());
+        --i;
     }
-    // Insert packet into buffer
-    NS_ASSERT(m_data.find(headSeq) == m_data.end()); // Shouldn't be there yet
-    m_data[headSeq] = p;
-
-    if (headSeq > m_nextRxSeq)
+    if (i != m_data.end() && i->first <= headSeq &&
+        i->first + SequenceNumber32(i->second.size) >= tailSeq)
     {
-        // Generate a new SACK block
-        UpdateSackList(headSeq, tailSeq);
+        NS_LOG_LOGIC("Nothing to buffer");
+        return false; // The whole packet is already buffered
     }
 
-    NS_LOG_LOGIC("Buffered packet of seqno=" << headSeq << " len=" << p->GetSize());
-    // Update variables
-    m_size += p->GetSize(); // Occupancy
-    for (i = m_data.begin(); i != m_data.end(); ++i)
+    // Coalesce the blocks overlapping or touching the packet into a single
+    // block, filling the gaps between them with fragments of the packet
+    DataBlock block;
+    SequenceNumber32 blockHead = headSeq;
+    SequenceNumber32 blockTail = headSeq;
+    uint32_t added = 0;
+    auto fill = [&](const SequenceNumber32& from, const SequenceNumber32& to) {
+        auto start = static_cast<uint32_t>(from - tcph.GetSequenceNumber());
+        auto length = static_cast<uint32_t>(to - from);
+        block.packets.push_back(p->CreateFragment(start, length));
+        NS_ASSERT(length == block.packets.back()->GetSize());
+        block.size += length;
+        added += length;
+    };
+    while (i != m_data.end() && i->first <= tailSeq)
     {
-        if (i->first < m_nextRxSeq)
+        if (i->first > blockTail)
         {
-            continue;
+            fill(blockTail, i->first);
         }
-        else if (i->first > m_nextRxSeq)
-        {
-            break;
-        };
-        m_nextRxSeq = i->first + SequenceNumber32(i->second->GetSize());
-        m_availBytes += i->second->GetSize();
+        else if (i->first < blockHead)
+        { // Incoming head is overlapped
+            blockHead = i->first;
+        }
+        block.size += i->second.size;
+        block.packets.splice(block.packets.end(), i->second.packets);
+        blockTail = i->first + SequenceNumber32(i->second.size);
+        i = m_data.erase(i);
+    }
+    if (blockTail < tailSeq)
+    {
+        fill(blockTail, tailSeq);
+        blockTail = tailSeq;
+    }
+    NS_ASSERT(block.size == static_cast<uint32_t>(blockTail - blockHead));
+    m_data.emplace(blockHead, std::move(block));
+
+    NS_LOG_LOGIC("Buffered " << added << " bytes in block seqno=" << blockHead
+                             << " len=" << blockTail - blockHead);
+    // Update variables
+    m_size += added; // Occupancy
+    if (blockHead > m_nextRxSeq)
+    {
+        // Generate a new SACK block
+        UpdateSackList(blockHead, blockTail);
+    }
+    else if (blockTail > m_nextRxSeq)
+    {
+        m_availBytes += static_cast<uint32_t>(blockTail - m_nextRxSeq);
+        m_nextRxSeq = blockTail;
         ClearSackList(m_nextRxSeq);
     }
     NS_LOG_LOGIC("Updated buffer occupancy=" << m_size << " nextRxSeq=" << m_nextRxSeq);
@@ -276,54 +285,13 @@ TcpRxBuffer::UpdateSackList(const SequenceNumber32& head, const SequenceNumber32
     //     following SACK blocks in the SACK option may be listed in
     //     arbitrary order.
 
+    // The block contains all the data contiguous to the segment, hence any
+    // reported block that it overlaps is a subset of it and has to be removed.
+    m_sackList.remove_if([&current](const TcpOptionSack::SackBlock& block) {
+        return current.first <= block.first && block.second <= current.second;
+    });
     m_sackList.push_front(current);
 
-    // We have inserted the block at the beginning of the list. Now, we should
-    // check if any existing blocks overlap with that.
-    bool updated = false;
-    auto it = m_sackList.begin();
-    TcpOptionSack::SackBlock begin = *it;
-    TcpOptionSack::SackBlock merged;
-    ++it;
-
-    // Iterates until we examined all blocks in the list (maximum 4)
-    while (it != m_sackList.end())
-    {
-        current = *it;
-
-        // This is a left merge:
-        // [current_first; current_second] [beg_first; beg_second]
-        if (begin.first == current.second)
-        {
-            NS_ASSERT(current.first < begin.second);
-            merged = TcpOptionSack::SackBlock(current.first, begin.second);
-            updated = true;
-        }
-        // while this is a right merge
-        // [begin_first; begin_second] [current_first; current_second]
-        else if (begin.second == current.first)
-        {
-            NS_ASSERT(begin.first < current.second);
-            merged = TcpOptionSack::SackBlock(begin.first, current.second);
-            updated = true;
-        }
-
-        // If we have merged the blocks (and the result is in merged) we should
-        // delete the current block (it), the first block, and insert the merged
-        // one at the beginning.
-        if (updated)
-        {
-            m_sackList.erase(it);
-            m_sackList.pop_front();
-            m_sackList.push_front(merged);
-            it = m_sackList.begin();
-            begin = *it;
-            updated = false;
-        }
-
-        ++it;
-    }
-
     // Since the maximum blocks that fits into a TCP header are 4, there's no
     // point on maintaining the others.
     if (m_sackList.size() > 4)
@@ -332,9 +300,8 @@ TcpRxBuffer::UpdateSackList(const SequenceNumber32& head, const SequenceNumber32
     }
 
     // Please note that, if a block b is discarded and then a block contiguous
-    // to b is received, only that new block (without the b part) is reported.
-    // This is perfectly fine for the RFC point (a), given that we do not report any
-    // overlapping blocks shortly after.
+    // to b is received, the reported block includes b, since it is built from
+    // the buffered data rather than from the blocks previously reported.
 }
 
 void
@@ -378,39 +345,49 @@ TcpRxBuffer::Extract(uint32_t maxSize)
     }
     NS_ASSERT(!m_data.empty());            // At least we have something to extract
     Ptr<Packet> outPkt = Create<Packet>(); // The packet that contains all the data to return
-    BufIterator i;
-    while (extractSize)
+    BufIterator i = m_data.begin();
+    NS_ASSERT(i->first <= m_nextRxSeq); // in-sequence data expected
+    DataBlock& block = i->second;
+    NS_ASSERT(extractSize <= block.size); // the available data is the first block
+    m_size -= extractSize;
+    m_availBytes -= extractSize;
+    block.size -= extractSize;
+    uint32_t remaining = extractSize;
+    while (remaining)
     { // Check the buffered data for delivery
-        i = m_data.begin();
-        NS_ASSERT(i->first <= m_nextRxSeq); // in-sequence data expected
+        Ptr<Packet>& pkt = block.packets.front();
         // Check if we send the whole pkt or just a partial
-        uint32_t pktSize = i->second->GetSize();
-        if (pktSize <= extractSize)
+        uint32_t pktSize = pkt->GetSize();
+        if (pktSize <= remaining)
         { // Whole packet is extracted
-            outPkt->AddAtEnd(i->second);
-            m_data.erase(i);
-            m_size -= pktSize;
-            m_availBytes -= pktSize;
-            extractSize -= pktSize;
+            outPkt->AddAtEnd(pkt);
+            block.packets.pop_front();
+            remaining -= pktSize;
         }
         else
         { // Partial is extracted and done
-            outPkt->AddAtEnd(i->second->CreateFragment(0, extractSize));
-            m_data[i->first + SequenceNumber32(extractSize)] =
-                i->second->CreateFragment(extractSize, pktSize - extractSize);
-            m_data.erase(i);
-            m_size -= extractSize;
-            m_availBytes -= extractSize;
-            extractSize = 0;
+            outPkt->AddAtEnd(pkt->CreateFragment(0, remaining));
+            pkt = pkt->CreateFragment(remaining, pktSize - remaining);
+            remaining = 0;
         }
     }
+    if (block.size == 0)
+    {
+        m_data.erase(i);
+    }
+    else
+    { // Move the rest of the block to its new first sequence number
+        auto node = m_data.extract(i);
+        node.key() = node.key() + SequenceNumber32(extractSize);
+        m_data.insert(std::move(node));
+    }
     if (outPkt->GetSize() == 0)
     {
         NS_LOG_LOGIC("Nothing extracted.");
         return nullptr;
     }
     NS_LOG_LOGIC("Extracted " << outPkt->GetSize() << " bytes, bufsize=" << m_size
-                              << ", num pkts in buffer=" << m_data.size());
+                              << ", num blocks in buffer=" << m_data.size());
     return outPkt;
 }
 
@@ -17,6 +17,7 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/traced-value.h"
 
+#include <list>
 #include <map>
 
 namespace ns3
@@ -44,6 +45,13 @@ class Packet;
  * To store data, use Add; for retrieving a certain amount of ordered data, use
  * the method Extract.
  *
+ * The buffered data is kept as a set of disjoint, non-adjacent blocks indexed
+ * by their first sequence number. When a segment is added, it is coalesced
+ * with the blocks it overlaps or touches: only the bytes filling the gaps
+ * between them are stored, and the packets of the blocks are spliced into a
+ * single chain without copying their data. The in-order data is therefore
+ * always the first block, and each out-of-order block is exactly a SACK block.
+ *
  * SACK list
  * ---------
  *
@@ -179,6 +187,9 @@ class TcpRxBuffer : public Object
     /**
      * \brief Update the sack list, with the block seq starting at the beginning
      *
+     * The block is the buffered block containing the segment which triggered
+     * the update, and replaces the blocks of the list it covers.
+     *
      * Note: the maximum size of the block list is 4. Caller is free to
      * drop blocks at the end to accommodate header size; from RFC 2018:
      *
@@ -211,8 +222,15 @@ class TcpRxBuffer : public Object
 
     TcpOptionSack::SackList m_sackList; //!< Sack list (updated constantly)
 
+    /// A block of contiguous data, stored as the chain of the packets carrying it
+    struct DataBlock
+    {
+        uint32_t size{0};               //!< Number of bytes in the block
+        std::list<Ptr<Packet>> packets; //!< Packets carrying the data, in sequence order
+    };
+
     /// container for data stored in the buffer
-    typedef std::map<SequenceNumber32, Ptr<Packet>>::iterator BufIterator;
+    typedef std::map<SequenceNumber32, DataBlock>::iterator BufIterator;
     TracedValue<SequenceNumber32>
         m_nextRxSeq;           //!< Seqnum of the first missing byte in data (RCV.NXT)
     SequenceNumber32 m_finSeq; //!< Seqnum of the FIN packet
@@ -220,7 +238,7 @@ class TcpRxBuffer : public Object
     uint32_t m_size;       //!< Number of total data bytes in the buffer, not necessarily contiguous
     uint32_t m_maxBuffer;  //!< Upper bound of the number of data bytes in buffer (RCV.WND)
     uint32_t m_availBytes; //!< Number of bytes available to read, i.e. contiguous block at head
-    std::map<SequenceNumber32, Ptr<Packet>> m_data; //!< Corresponding data (may be null)
+    std::map<SequenceNumber32, DataBlock> m_data; //!< Data blocks by first sequence number
 };
 
 } // namespace ns3
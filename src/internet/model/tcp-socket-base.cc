@@ -184,6 +184,14 @@ TcpSocketBase::GetTypeId()
                           BooleanValue(true),
                           MakeBooleanAccessor(&TcpSocketBase::m_limitedTx),
                           MakeBooleanChecker())
+            .AddAttribute("TsoMaxSegments",
+                          "Maximum number of full-sized segments of new data sent as a single "
+                          "super-segment, which TcpL4Protocol splits into segments "
+                          "(segmentation offload). 1 disables the offload, which is also not "
+                          "used when pacing is enabled.",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&TcpSocketBase::m_tsoMaxSegments),
+                          MakeUintegerChecker<uint32_t>(1))
             .AddAttribute("UseEcn",
                           "Parameter to set ECN functionality",
                           EnumValue(TcpSocketState::Off),
@@ -403,6 +411,7 @@ TcpSocketBase::TcpSocketBase(const TcpSocketBase& sock)
       m_recoverActive(sock.m_recoverActive),
       m_retxThresh(sock.m_retxThresh),
       m_limitedTx(sock.m_limitedTx),
+      m_tsoMaxSegments(sock.m_tsoMaxSegments),
       m_isFirstPartialAck(sock.m_isFirstPartialAck),
       m_txTrace(sock.m_txTrace),
       m_rxTrace(sock.m_rxTrace),
@@ -3189,12 +3198,29 @@ TcpSocketBase::SendDataPacket(SequenceNumber32 seq, uint32_t maxSize, bool withA
     NS_LOG_FUNCTION(this << seq << maxSize << withAck);
 
     bool isStartOfTransmission = BytesInFlight() == 0U;
-    TcpTxItem* outItem = m_txBuffer->CopyFromSequence(maxSize, seq);
+    TcpTxItem* outItem =
+        m_txBuffer->CopyFromSequence(std::min(maxSize, m_tcb->m_segmentSize), seq);
 
     m_rateOps->SkbSent(outItem, isStartOfTransmission);
 
     bool isRetransmission = outItem->IsRetrans();
     Ptr<Packet> p = outItem->GetPacketCopy();
+
+    // A super-segment (of new data only) is stored in the Tx buffer as one item
+    // per segment, so that the SACK blocks covering only some of its segments
+    // can be mapped. Other transmissions send the single item returned above.
+    while (maxSize > m_tcb->m_segmentSize && p->GetSize() < maxSize)
+    {
+        outItem =
+            m_txBuffer->CopyFromSequence(std::min(maxSize - p->GetSize(), m_tcb->m_segmentSize),
+                                         seq + SequenceNumber32(p->GetSize()));
+        if (outItem == nullptr)
+        {
+            break;
+        }
+        m_rateOps->SkbSent(outItem, false);
+        p->AddAtEnd(outItem->GetPacketCopy());
+    }
     uint32_t sz = p->GetSize(); // Size of packet
     uint8_t flags = withAck ? TcpHeader::ACK : 0;
     uint32_t remainingData = m_txBuffer->SizeFromSequence(seq + SequenceNumber32(sz));
@@ -3311,7 +3337,8 @@ TcpSocketBase::SendDataPacket(SequenceNumber32 seq, uint32_t maxSize, bool withA
                           header,
                           m_endPoint->GetLocalAddress(),
                           m_endPoint->GetPeerAddress(),
-                          m_boundnetdevice);
+                          m_boundnetdevice,
+                          m_tcb->m_segmentSize);
         NS_LOG_DEBUG("Send segment of size "
                      << sz << " with remaining data " << remainingData << " via TcpL4Protocol to "
                      << m_endPoint->GetPeerAddress() << ". Header " << header);
@@ -3322,7 +3349,8 @@ TcpSocketBase::SendDataPacket(SequenceNumber32 seq, uint32_t maxSize, bool withA
                           header,
                           m_endPoint6->GetLocalAddress(),
                           m_endPoint6->GetPeerAddress(),
-                          m_boundnetdevice);
+                          m_boundnetdevice,
+                          m_tcb->m_segmentSize);
         NS_LOG_DEBUG("Send segment of size "
                      << sz << " with remaining data " << remainingData << " via TcpL4Protocol to "
                      << m_endPoint6->GetPeerAddress() << ". Header " << header);
@@ -3469,6 +3497,19 @@ TcpSocketBase::SendPendingData(bool withAck)
             auto maxSizeToSend = static_cast<uint32_t>(nextHigh - next);
             s = std::min(s, maxSizeToSend);
 
+            // Segmentation offload: send as many full segments of new data as
+            // allowed by the windows in a single super-segment
+            if (m_tsoMaxSegments > 1 && !IsPacingEnabled() && s == m_tcb->m_segmentSize &&
+                next == m_tcb->m_highTxMark)
+            {
+                int32_t rWndLeft = (m_highRxAckMark.Get() + SequenceNumber32(m_rWnd.Get())) - next;
+                uint32_t segments = std::min({m_tsoMaxSegments,
+                                              availableWindow / m_tcb->m_segmentSize,
+                                              availableData / m_tcb->m_segmentSize,
+                                              std::max(rWndLeft, 0) / m_tcb->m_segmentSize});
+                s = std::max(segments, 1U) * m_tcb->m_segmentSize;
+            }
+
             // (C.2) If any of the data octets sent in (C.1) are below HighData,
             //       HighRxt MUST be set to the highest sequence number of the
             //       retransmitted segment unless NextSeg () rule (4) was
@@ -852,6 +852,11 @@ class TcpSocketBase : public TcpSocket
      * \brief Extract at most maxSize bytes from the TxBuffer at sequence seq, add the
      *        TCP header, and send to TcpL4Protocol
      *
+     * With segmentation offload, maxSize may be several times the segment size:
+     * the data is then sent and traced as a single super-segment, which
+     * TcpL4Protocol splits into segments, and stored in the Tx buffer as
+     * one item per segment.
+     *
      * \param seq the sequence number
      * \param maxSize the maximum data block to be transmitted (in bytes)
      * \param withAck forces an ACK to be sent
@@ -1430,6 +1435,8 @@ class TcpSocketBase : public TcpSocket
     uint32_t m_retxThresh{3};    //!< Fast Retransmit threshold
     bool m_limitedTx{true};      //!< perform limited transmit
 
+    uint32_t m_tsoMaxSegments{1}; //!< Maximum number of segments sent as a super-segment
+
     // Transmission Control Block
     Ptr<TcpSocketState> m_tcb;                 //!< Congestion control information
     Ptr<TcpCongestionOps> m_congestionControl; //!< Congestion control
@@ -285,7 +285,7 @@ TcpTxBuffer::GetNewSegment(uint32_t numBytes)
     NS_ASSERT(it != m_appList.end());
 
     m_appList.erase(it);
-    m_sentList.insert(m_sentList.end(), item);
+    AddToScoreboard(m_sentList.insert(m_sentList.end(), item));
     m_sentSize += item->m_packet->GetSize();
 
     return item;
@@ -299,37 +299,34 @@ TcpTxBuffer::GetTransmittedSegment(uint32_t numBytes, const SequenceNumber32& se
     NS_ASSERT(numBytes <= m_sentSize);
     NS_ASSERT(!m_sentList.empty());
 
-    auto it = m_sentList.begin();
     bool listEdited = false;
     uint32_t s = numBytes;
 
     // Avoid to merge different packet for this retransmission if flags are
     // different.
-    for (; it != m_sentList.end(); ++it)
+    auto index = m_sentIndex.find(seq);
+    if (index != m_sentIndex.end())
     {
-        if ((*it)->m_startSeq == seq)
+        auto it = index->second;
+        auto next = it;
+        next++;
+        if (next != m_sentList.end())
         {
-            auto next = it;
-            next++;
-            if (next != m_sentList.end())
+            // Next is not sacked and have the same value for m_lost ... there is the
+            // possibility to merge
+            if ((!(*next)->m_sacked) && ((*it)->m_lost == (*next)->m_lost))
             {
-                // Next is not sacked and have the same value for m_lost ... there is the
-                // possibility to merge
-                if ((!(*next)->m_sacked) && ((*it)->m_lost == (*next)->m_lost))
-                {
-                    s = std::min(s, (*it)->m_packet->GetSize() + (*next)->m_packet->GetSize());
-                }
-                else
-                {
-                    // Next is sacked... better to retransmit only the first segment
-                    s = std::min(s, (*it)->m_packet->GetSize());
-                }
+                s = std::min(s, (*it)->m_packet->GetSize() + (*next)->m_packet->GetSize());
             }
             else
             {
+                // Next is sacked... better to retransmit only the first segment
                 s = std::min(s, (*it)->m_packet->GetSize());
             }
-            break;
+        }
+        else
+        {
+            s = std::min(s, (*it)->m_packet->GetSize());
         }
     }
 
@@ -339,6 +336,7 @@ TcpTxBuffer::GetTransmittedSegment(uint32_t numBytes, const SequenceNumber32& se
     {
         m_retrans += item->m_packet->GetSize();
         item->m_retrans = true;
+        UpdateScoreboard(item);
     }
 
     return item;
@@ -391,7 +389,7 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                                const SequenceNumber32& listStartFrom,
                                uint32_t numBytes,
                                const SequenceNumber32& seq,
-                               bool* listEdited) const
+                               bool* listEdited)
 {
     NS_LOG_FUNCTION(this << numBytes << seq);
 
@@ -427,12 +425,24 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
     TcpTxItem* outItem = nullptr;
     auto it = list.begin();
     SequenceNumber32 beginOfCurrentPacket = listStartFrom;
+    bool isSentList = (&list == &m_sentList);
+
+    if (isSentList)
+    {
+        // start from the item containing seq, instead of walking the list
+        auto index = FindSentItem(seq);
+        if (index != m_sentIndex.end())
+        {
+            it = index->second;
+            beginOfCurrentPacket = index->first;
+        }
+    }
 
     while (it != list.end())
     {
         currentItem = *it;
         currentPacket = currentItem->m_packet;
-        NS_ASSERT_MSG(list != m_sentList || currentItem->m_startSeq >= m_firstByteSeq,
+        NS_ASSERT_MSG(!isSentList || currentItem->m_startSeq >= m_firstByteSeq,
                       "start: " << m_firstByteSeq
                                 << " currentItem start: " << currentItem->m_startSeq);
 
@@ -458,10 +468,19 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                                          << " and now we recurse because packet ends at "
                                          << beginOfCurrentPacket + currentPacket->GetSize());
                 auto firstPart = new TcpTxItem();
+                if (isSentList)
+                {
+                    RemoveFromScoreboard(currentItem);
+                }
                 SplitItems(firstPart, currentItem, seq - beginOfCurrentPacket);
 
                 // insert firstPart before currentItem
-                list.insert(it, firstPart);
+                auto firstPartIt = list.insert(it, firstPart);
+                if (isSentList)
+                {
+                    AddToScoreboard(firstPartIt);
+                    AddToScoreboard(it);
+                }
                 if (listEdited)
                 {
                     *listEdited = true;
@@ -524,10 +543,19 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                 // the end is inside the current packet, but it isn't exactly
                 // the packet end. Just fragment, fix the list, and return.
                 auto firstPart = new TcpTxItem();
+                if (isSentList)
+                {
+                    RemoveFromScoreboard(currentItem);
+                }
                 SplitItems(firstPart, currentItem, numBytes);
 
                 // insert firstPart before currentItem
-                list.insert(it, firstPart);
+                auto firstPartIt = list.insert(it, firstPart);
+                if (isSentList)
+                {
+                    AddToScoreboard(firstPartIt);
+                    AddToScoreboard(it);
+                }
                 if (listEdited)
                 {
                     *listEdited = true;
@@ -555,8 +583,17 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
             TcpTxItem* next = (*it); // Please remember we have incremented it
                                      // in the previous if
 
+            if (isSentList)
+            {
+                RemoveFromScoreboard(currentItem);
+                RemoveFromScoreboard(next);
+            }
             MergeItems(currentItem, next);
-            list.erase(it);
+            it = list.erase(it);
+            if (isSentList)
+            {
+                AddToScoreboard(std::prev(it));
+            }
 
             delete next;
 
@@ -640,9 +677,11 @@ bool
 TcpTxBuffer::IsRetransmittedDataAcked(const SequenceNumber32& ack) const
 {
     NS_LOG_FUNCTION(this);
-    for (const auto& it : m_sentList)
+    // only the item containing the byte before ack can end at ack
+    auto index = FindSentItem(ack - 1);
+    if (index != m_sentIndex.end())
     {
-        TcpTxItem* item = it;
+        TcpTxItem* item = *index->second;
         Ptr<Packet> p = item->m_packet;
         if (item->m_startSeq + p->GetSize() == ack && !item->m_sacked && item->m_retrans)
         {
@@ -696,6 +735,7 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
             m_firstByteSeq += pktSize;
 
             RemoveFromCounts(item, pktSize);
+            RemoveFromScoreboard(item);
 
             i = m_sentList.erase(i);
             NS_LOG_INFO("Removed " << *item << " lost: " << m_lostOut << " retrans: " << m_retrans
@@ -713,9 +753,11 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
         { // Part of the packet is behind the seqnum. Fragment
             pktSize -= offset;
             NS_LOG_INFO(*item);
+            RemoveFromScoreboard(item);
             // PacketTags are preserved when fragmenting
             item->m_packet = item->m_packet->CreateFragment(offset, pktSize);
             item->m_startSeq += offset;
+            AddToScoreboard(i);
             m_size -= offset;
             m_sentSize -= offset;
             m_firstByteSeq += offset;
@@ -745,6 +787,7 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
             // when adding Reno dupacks in the count.
             head->m_sacked = false;
             m_sackedOut -= head->m_packet->GetSize();
+            UpdateScoreboard(head);
             NS_LOG_INFO("Moving the SACK flag from the HEAD to another segment");
             AddRenoSack();
             MarkHeadAsLost();
@@ -779,15 +822,24 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
 
     for (auto option_it = list.begin(); option_it != list.end(); ++option_it)
     {
-        auto item_it = m_sentList.begin();
-        SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-
         if (m_firstByteSeq + m_sentSize < (*option_it).first)
         {
             NS_LOG_INFO("Not updating scoreboard, the option block is outside the sent list");
             return bytesSacked;
         }
 
+        // Start from the first item beginning inside the block: an item
+        // beginning before the block cannot be sacked by it and, if it ends
+        // after the block, the items that follow also do.
+        auto index = m_sentIndex.lower_bound((*option_it).first);
+        auto item_it = m_sentList.end();
+        SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
+        if (index != m_sentIndex.end())
+        {
+            item_it = index->second;
+            beginOfCurrentPacket = index->first;
+        }
+
         while (item_it != m_sentList.end())
         {
             uint32_t pktSize = (*item_it)->m_packet->GetSize();
@@ -818,6 +870,7 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
                     (*item_it)->m_sacked = true;
                     m_sackedOut += (*item_it)->m_packet->GetSize();
                     bytesSacked += (*item_it)->m_packet->GetSize();
+                    UpdateScoreboard(*item_it);
 
                     if (m_highestSack.first == m_sentList.end() ||
                         m_highestSack.second <= beginOfCurrentPacket + pktSize)
@@ -868,8 +921,6 @@ void
 TcpTxBuffer::UpdateLostCount()
 {
     NS_LOG_FUNCTION(this);
-    uint32_t sacked = 0;
-    SequenceNumber32 beginOfCurrentPacket = m_highestSack.second;
     if (m_highestSack.first == m_sentList.end())
     {
         NS_LOG_INFO("Status before the update: " << *this
@@ -881,32 +932,45 @@ TcpTxBuffer::UpdateLostCount()
                                                  << *(*m_highestSack.first));
     }
 
-    for (auto it = m_highestSack.first; it != m_sentList.begin(); --it)
-    {
-        TcpTxItem* item = *it;
-        if (item->m_sacked)
-        {
-            sacked++;
-        }
+    // Walking down from the highest sacked item, the items neither sacked nor
+    // lost are marked lost once m_dupAckThresh sacked items have been seen
+    // (the head is not counted). Find where the threshold is reached in the
+    // set of the sacked items, then mark the items that start before.
+    SequenceNumber32 head = m_sentList.front()->m_startSeq;
+    SequenceNumber32 highest = (*m_highestSack.first)->m_startSeq;
+    SequenceNumber32 limit;
+    bool thresholdReached = false;
 
-        if (sacked >= m_dupAckThresh)
+    if (m_dupAckThresh == 0)
+    {
+        limit = highest + 1;
+        thresholdReached = true;
+    }
+    else
+    {
+        uint32_t sacked = 0;
+        auto it = m_sackedItems.upper_bound(highest);
+        while (it != m_sackedItems.begin() && *(--it) != head)
         {
-            if (!item->m_sacked && !item->m_lost)
+            if (++sacked >= m_dupAckThresh)
             {
-                item->m_lost = true;
-                m_lostOut += item->m_packet->GetSize();
+                limit = *it;
+                thresholdReached = true;
+                break;
             }
         }
-        beginOfCurrentPacket -= item->m_packet->GetSize();
     }
 
-    if (sacked >= m_dupAckThresh)
+    if (thresholdReached)
     {
-        TcpTxItem* item = *m_sentList.begin();
-        if (!item->m_lost)
+        auto it = m_unmarkedItems.begin();
+        while (it != m_unmarkedItems.end() && *it < limit)
         {
+            TcpTxItem* item = *m_sentIndex.at(*it);
+            ++it; // the update of the scoreboard removes the item from the set
             item->m_lost = true;
             m_lostOut += item->m_packet->GetSize();
+            UpdateScoreboard(item);
         }
     }
     NS_LOG_INFO("Status after the update: " << *this);
@@ -923,24 +987,20 @@ TcpTxBuffer::IsLost(const SequenceNumber32& seq) const
         return false;
     }
 
-    // In theory, using a map and hints when inserting elements can improve
-    // performance
-    for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
+    auto index = FindSentItem(seq);
+    if (index != m_sentIndex.end())
     {
-        // Search for the right iterator before calling IsLost()
-        if ((*it)->m_startSeq <= seq && seq < (*it)->m_startSeq + (*it)->m_packet->GetSize())
+        const TcpTxItem* item = *index->second;
+        if (item->m_lost)
         {
-            if ((*it)->m_lost)
-            {
-                NS_LOG_INFO("seq=" << seq << " is lost because of lost flag");
-                return true;
-            }
+            NS_LOG_INFO("seq=" << seq << " is lost because of lost flag");
+            return true;
+        }
 
-            if ((*it)->m_sacked)
-            {
-                NS_LOG_INFO("seq=" << seq << " is not lost because of sacked flag");
-                return false;
-            }
+        if (item->m_sacked)
+        {
+            NS_LOG_INFO("seq=" << seq << " is not lost because of sacked flag");
+            return false;
         }
     }
 
@@ -965,36 +1025,35 @@ TcpTxBuffer::NextSeg(SequenceNumber32* seq, SequenceNumber32* seqHigh, bool isRe
      *
      *     (1.c) IsLost (S2) returns true.
      */
-    TcpTxItem* item;
     SequenceNumber32 seqPerRule3;
     bool isSeqPerRule3Valid = false;
-    SequenceNumber32 beginOfCurrentPkt = m_firstByteSeq;
 
-    for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
+    // Condition 1.a , 1.b , and 1.c: the first lost item, neither
+    // retransmitted nor sacked, below the highest sacked byte
+    if (!m_lostItems.empty() &&
+        ((m_sackSeen && *m_lostItems.begin() < m_highestSack.second) || !m_sackSeen))
     {
-        item = *it;
+        NS_LOG_INFO("IsLost, returning" << *m_lostItems.begin());
+        *seq = *m_lostItems.begin();
+        *seqHigh = *seq + m_segmentSize;
+        return true;
+    }
 
-        // Condition 1.a , 1.b , and 1.c
-        if (!item->m_retrans && !item->m_sacked &&
-            ((m_sackSeen && item->m_startSeq < m_highestSack.second) || !m_sackSeen))
+    // Conditions 1.a and 1.b only, for rule 3. A candidate starting at
+    // sequence number 0 is replaced by the next one, if any.
+    for (auto it = m_retransmittable.begin(); isRecovery && it != m_retransmittable.end(); ++it)
+    {
+        if (m_sackSeen && *it >= m_highestSack.second)
         {
-            if (item->m_lost)
-            {
-                NS_LOG_INFO("IsLost, returning" << beginOfCurrentPkt);
-                *seq = beginOfCurrentPkt;
-                *seqHigh = *seq + m_segmentSize;
-                return true;
-            }
-            else if (seqPerRule3.GetValue() == 0 && isRecovery)
-            {
-                NS_LOG_INFO("Saving for rule 3 the seq " << beginOfCurrentPkt);
-                isSeqPerRule3Valid = true;
-                seqPerRule3 = beginOfCurrentPkt;
-            }
+            break;
+        }
+        NS_LOG_INFO("Saving for rule 3 the seq " << *it);
+        isSeqPerRule3Valid = true;
+        seqPerRule3 = *it;
+        if (seqPerRule3.GetValue() != 0)
+        {
+            break;
         }
-
-        // Nothing found, iterate
-        beginOfCurrentPkt += item->m_packet->GetSize();
     }
 
     /* (2) If no sequence number 'S2' per rule (1) exists but there
@@ -1203,6 +1262,7 @@ TcpTxBuffer::ResetRenoSack()
     for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
     {
         (*it)->m_sacked = false;
+        UpdateScoreboard(*it);
     }
 
     m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
@@ -1231,6 +1291,12 @@ TcpTxBuffer::ResetSentList()
         m_sentList.pop_back();
     }
 
+    m_sentIndex.clear();
+    m_sackedItems.clear();
+    m_unmarkedItems.clear();
+    m_lostItems.clear();
+    m_retransmittable.clear();
+
     m_sentSize = 0;
     m_lostOut = 0;
     m_retrans = 0;
@@ -1247,6 +1313,7 @@ TcpTxBuffer::ResetLastSegmentSent()
     {
         TcpTxItem* item = m_sentList.back();
 
+        RemoveFromScoreboard(item);
         m_sentList.pop_back();
         m_sentSize -= item->m_packet->GetSize();
         if (item->m_retrans)
@@ -1299,6 +1366,7 @@ TcpTxBuffer::SetSentListLost(bool resetSack)
         }
 
         (*it)->m_retrans = false;
+        UpdateScoreboard(*it);
     }
 
     NS_LOG_INFO("Set sent list lost, status: " << *this);
@@ -1333,6 +1401,7 @@ TcpTxBuffer::DeleteRetransmittedFlagFromHead()
     {
         m_sentList.front()->m_retrans = false;
         m_retrans -= m_sentList.front()->m_packet->GetSize();
+        UpdateScoreboard(m_sentList.front());
     }
     ConsistencyCheck();
 }
@@ -1362,6 +1431,7 @@ TcpTxBuffer::MarkHeadAsLost()
             m_sentList.front()->m_lost = true;
             m_lostOut += m_sentList.front()->m_packet->GetSize();
         }
+        UpdateScoreboard(m_sentList.front());
     }
     ConsistencyCheck();
 }
@@ -1396,6 +1466,7 @@ TcpTxBuffer::AddRenoSack()
     {
         (*it)->m_sacked = true;
         m_sackedOut += (*it)->m_packet->GetSize();
+        UpdateScoreboard(*it);
         m_sackSeen = true;
         m_highestSack = std::make_pair(it, (*it)->m_startSeq);
         NS_LOG_INFO("Added a Reno SACK, status: " << *this);
@@ -1444,6 +1515,76 @@ TcpTxBuffer::ConsistencyCheck() const
     NS_ASSERT_MSG(lost == m_lostOut, " Counted lost: " << lost << " stored lost: " << m_lostOut);
     NS_ASSERT_MSG(retrans == m_retrans,
                   " Counted retrans: " << retrans << " stored retrans: " << m_retrans);
+
+    NS_ASSERT_MSG(m_sentIndex.size() == m_sentList.size(),
+                  "Indexed items: " << m_sentIndex.size() << " sent items: " << m_sentList.size());
+    for (const auto& [seq, it] : m_sentIndex)
+    {
+        const TcpTxItem* item = *it;
+        NS_ASSERT_MSG(item->m_startSeq == seq, "Item " << *item << " indexed at " << seq);
+        NS_ASSERT(m_sackedItems.contains(seq) == item->m_sacked);
+        NS_ASSERT(m_unmarkedItems.contains(seq) == (!item->m_sacked && !item->m_lost));
+        NS_ASSERT(m_lostItems.contains(seq) ==
+                  (item->m_lost && !item->m_retrans && !item->m_sacked));
+        NS_ASSERT(m_retransmittable.contains(seq) == (!item->m_sacked && !item->m_retrans));
+    }
+}
+
+void
+TcpTxBuffer::AddToScoreboard(PacketList::iterator it)
+{
+    NS_LOG_FUNCTION(this << **it);
+    m_sentIndex[(*it)->m_startSeq] = it;
+    UpdateScoreboard(*it);
+}
+
+void
+TcpTxBuffer::RemoveFromScoreboard(const TcpTxItem* item)
+{
+    NS_LOG_FUNCTION(this << *item);
+    const SequenceNumber32& seq = item->m_startSeq;
+    m_sentIndex.erase(seq);
+    m_sackedItems.erase(seq);
+    m_unmarkedItems.erase(seq);
+    m_lostItems.erase(seq);
+    m_retransmittable.erase(seq);
+}
+
+void
+TcpTxBuffer::UpdateScoreboard(const TcpTxItem* item)
+{
+    const SequenceNumber32& seq = item->m_startSeq;
+    auto update = [&seq](SeqSet& set, bool member) {
+        if (member)
+        {
+            set.insert(seq);
+        }
+        else
+        {
+            set.erase(seq);
+        }
+    };
+    update(m_sackedItems, item->m_sacked);
+    update(m_unmarkedItems, !item->m_sacked && !item->m_lost);
+    update(m_lostItems, item->m_lost && !item->m_retrans && !item->m_sacked);
+    update(m_retransmittable, !item->m_sacked && !item->m_retrans);
+}
+
+TcpTxBuffer::SentIndex::const_iterator
+TcpTxBuffer::FindSentItem(const SequenceNumber32& seq) const
+{
+    auto index = m_sentIndex.upper_bound(seq);
+    if (index == m_sentIndex.begin())
+    {
+        return m_sentIndex.end();
+    }
+    --index;
+    const TcpTxItem* item = *index->second;
+    if (seq < item->m_startSeq + item->m_packet->GetSize())
+    {
+        return index;
+    }
+    return m_sentIndex.end();
 }
 
 std::ostream&
@@ -17,6 +17,10 @@
 #include "ns3/sequence-number.h"
 #include "ns3/traced-value.h"
 
+#include <list>
+#include <map>
+#include <set>
+
 namespace ns3
 {
 class Packet;
@@ -60,8 +64,16 @@ class Packet;
  * associated with every segment sent. This is done through the use of the
  * class TcpTxItem: instead of storing a list of packets, we store a list of
  * TcpTxItem. Each item has different flags (check the corresponding
- * documentation) and maintaining the scoreboard is a matter of travelling the
- * list and set the SACK flag on the corresponding segment sent.
+ * documentation) and maintaining the scoreboard is a matter of finding the
+ * items covered by the SACK blocks and set the SACK flag on them.
+ *
+ * The items of the SentList are indexed by their first sequence number, and
+ * the sequence numbers of the items are also kept in ordered sets according
+ * to their flags (e.g., the lost items not retransmitted yet). Therefore,
+ * finding the item covering a sequence, processing a SACK block, marking the
+ * lost items, and selecting the next segment to retransmit take a time
+ * logarithmic in the number of segments in flight, instead of a walk of the
+ * SentList, which matters for windows of thousands of segments.
  *
  * Item properties
  * ---------------
@@ -401,6 +413,39 @@ class TcpTxBuffer : public Object
     friend std::ostream& operator<<(std::ostream& os, const TcpTxBuffer& tcpTxBuf);
 
     typedef std::list<TcpTxItem*> PacketList; //!< container for data stored in the buffer
+    /// SentList items by first sequence number
+    typedef std::map<SequenceNumber32, PacketList::iterator> SentIndex;
+    /// First sequence numbers of some SentList items
+    typedef std::set<SequenceNumber32> SeqSet;
+
+    /**
+     * \brief Index an item of the SentList in the scoreboard
+     * \param it iterator to the item in the SentList
+     */
+    void AddToScoreboard(PacketList::iterator it);
+
+    /**
+     * \brief Remove an item of the SentList from the scoreboard
+     *
+     * It must be called before changing the first sequence number of the
+     * item, or removing it from the SentList.
+     *
+     * \param item the item
+     */
+    void RemoveFromScoreboard(const TcpTxItem* item);
+
+    /**
+     * \brief Update the scoreboard after a change of the flags of an item
+     * \param item the item, which is in the SentList
+     */
+    void UpdateScoreboard(const TcpTxItem* item);
+
+    /**
+     * \brief Find the item of the SentList containing a sequence
+     * \param seq the sequence
+     * \return the index entry of the item, or the end of the index
+     */
+    SentIndex::const_iterator FindSentItem(const SequenceNumber32& seq) const;
 
     /**
      * \brief Update the lost count
@@ -417,8 +462,9 @@ class TcpTxBuffer : public Object
      * The {New}Reno cases, for now, are managed in TcpSocketBase through the
      * call to MarkHeadAsLost.
      * This function is, therefore, called after a SACK option has been received,
-     * and updates the lost count. It can be probably optimized by not walking
-     * the entire list, but a subset.
+     * and updates the lost count. The item reaching the threshold is found in
+     * the set of the sacked items, and only the items that are neither sacked
+     * nor lost below it are visited.
      *
      */
     void UpdateLostCount();
@@ -553,7 +599,7 @@ class TcpTxBuffer : public Object
                                  const SequenceNumber32& startingSeq,
                                  uint32_t numBytes,
                                  const SequenceNumber32& requestedSeq,
-                                 bool* listEdited = nullptr) const;
+                                 bool* listEdited = nullptr);
 
     /**
      * \brief Merge two TcpTxItem
@@ -602,6 +648,12 @@ class TcpTxBuffer : public Object
         m_firstByteSeq; //!< Sequence number of the first byte in data (SND.UNA)
     std::pair<PacketList::const_iterator, SequenceNumber32> m_highestSack; //!< Highest SACK byte
 
+    SentIndex m_sentIndex;    //!< Items of the SentList by first sequence number
+    SeqSet m_sackedItems;     //!< Sacked items
+    SeqSet m_unmarkedItems;   //!< Items neither sacked nor lost
+    SeqSet m_lostItems;       //!< Lost items, not retransmitted
+    SeqSet m_retransmittable; //!< Items neither sacked nor retransmitted
+
     uint32_t m_lostOut{0};   //!< Number of lost bytes
     uint32_t m_sackedOut{0}; //!< Number of sacked bytes
     uint32_t m_retrans{0};   //!< Number of retransmitted bytes
@@ -0,0 +1,170 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/ipv4-end-point-demux.h"
+#include "ns3/ipv4-end-point.h"
+#include "ns3/ipv4-interface.h"
+#include "ns3/ipv6-end-point-demux.h"
+#include "ns3/ipv6-end-point.h"
+#include "ns3/ipv6-interface.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief Check that the endpoint demuxes find the right endpoints through
+ * their indexes, also when the peer of an endpoint changes.
+ *
+ * \tparam Demux The demux class.
+ * \tparam EndPoint The endpoint class.
+ * \tparam Address The address class.
+ * \tparam Interface The interface class.
+ */
+template <typename Demux, typename EndPoint, typename Address, typename Interface>
+class EndPointDemuxTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param name The test name.
+     * \param local The local address.
+     * \param peer The address of the first peer.
+     * \param otherPeer The address of the second peer.
+     */
+    EndPointDemuxTestCase(std::string name, Address local, Address peer, Address otherPeer);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \param demux The demux.
+     * \param dport The destination port of the packet.
+     * \param saddr The source address of the packet.
+     * \param sport The source port of the packet.
+     * \returns the single endpoint found, or nullptr.
+     */
+    EndPoint* Lookup(Demux& demux, uint16_t dport, Address saddr, uint16_t sport);
+
+    Address m_local;            //!< The local address.
+    Address m_peer;             //!< The address of the first peer.
+    Address m_otherPeer;        //!< The address of the second peer.
+    Ptr<Interface> m_interface; //!< The incoming interface.
+};
+
+template <typename Demux, typename EndPoint, typename Address, typename Interface>
+EndPointDemuxTestCase<Demux, EndPoint, Address, Interface>::EndPointDemuxTestCase(
+    std::string name,
+    Address local,
+    Address peer,
+    Address otherPeer)
+    : TestCase(name),
+      m_local(local),
+      m_peer(peer),
+      m_otherPeer(otherPeer)
+{
+}
+
+template <typename Demux, typename EndPoint, typename Address, typename Interface>
+EndPoint*
+EndPointDemuxTestCase<Demux, EndPoint, Address, Interface>::Lookup(Demux& demux,
+                                                                   uint16_t dport,
+                                                                   Address saddr,
+                                                                   uint16_t sport)
+{
+    auto endPoints = demux.Lookup(m_local, dport, saddr, sport, m_interface);
+    return endPoints.empty() ? nullptr : endPoints.front();
+}
+
+template <typename Demux, typename EndPoint, typename Address, typename Interface>
+void
+EndPointDemuxTestCase<Demux, EndPoint, Address, Interface>::DoRun()
+{
+    m_interface = CreateObject<Interface>();
+    Demux demux;
+
+    // a listener and many connections accepted on the same port
+    EndPoint* listener = demux.Allocate(nullptr, m_local, 80);
+    NS_TEST_ASSERT_MSG_NE(listener, nullptr, "Listener not allocated");
+    NS_TEST_EXPECT_MSG_EQ(demux.Allocate(nullptr, m_local, 80),
+                          nullptr,
+                          "Duplicated listener allocated");
+    std::vector<EndPoint*> connections;
+    for (uint16_t port = 1000; port < 1100; port++)
+    {
+        connections.push_back(demux.Allocate(nullptr, m_local, 80, m_peer, port));
+        NS_TEST_ASSERT_MSG_NE(connections.back(), nullptr, "Connection not allocated");
+    }
+    NS_TEST_EXPECT_MSG_EQ(demux.Allocate(nullptr, m_local, 80, m_peer, 1000),
+                          nullptr,
+                          "Duplicated connection allocated");
+
+    for (uint16_t port = 1000; port < 1100; port++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(Lookup(demux, 80, m_peer, port),
+                              connections[port - 1000],
+                              "Wrong endpoint for connection " << port);
+    }
+    NS_TEST_EXPECT_MSG_EQ(Lookup(demux, 80, m_peer, 2000), listener, "Listener not found");
+    NS_TEST_EXPECT_MSG_EQ(Lookup(demux, 80, m_otherPeer, 1000), listener, "Listener not found");
+    NS_TEST_EXPECT_MSG_EQ(Lookup(demux, 81, m_peer, 1000), nullptr, "Unexpected endpoint");
+
+    // an ephemeral endpoint which connects later, as done by TCP sockets
+    EndPoint* client = demux.Allocate();
+    uint16_t ephemeral = client->GetLocalPort();
+    NS_TEST_EXPECT_MSG_EQ(demux.LookupPortLocal(ephemeral), true, "Ephemeral port not used");
+    NS_TEST_EXPECT_MSG_EQ(Lookup(demux, ephemeral, m_otherPeer, 443), client, "Client not found");
+    client->SetPeer(m_peer, 443);
+    NS_TEST_EXPECT_MSG_EQ(Lookup(demux, ephemeral, m_peer, 443), client, "Client not found");
+    NS_TEST_EXPECT_MSG_EQ(Lookup(demux, ephemeral, m_otherPeer, 443),
+                          nullptr,
+                          "Connected client still receives packets from other peers");
+    NS_TEST_EXPECT_MSG_EQ(demux.LookupLocal(nullptr, Address::GetAny(), ephemeral),
+                          true,
+                          "Connected client not found by local address and port");
+
+    // deallocation
+    demux.DeAllocate(connections[10]);
+    NS_TEST_EXPECT_MSG_EQ(Lookup(demux, 80, m_peer, 1010), listener, "Connection not removed");
+    NS_TEST_EXPECT_MSG_EQ(Lookup(demux, 80, m_peer, 1011), connections[11], "Wrong endpoint");
+    demux.DeAllocate(client);
+    NS_TEST_EXPECT_MSG_EQ(demux.LookupPortLocal(ephemeral), false, "Ephemeral port still used");
+    NS_TEST_EXPECT_MSG_EQ(Lookup(demux, ephemeral, m_peer, 443), nullptr, "Client not removed");
+    demux.DeAllocate(listener);
+    NS_TEST_EXPECT_MSG_EQ(Lookup(demux, 80, m_peer, 2000), nullptr, "Listener not removed");
+    NS_TEST_EXPECT_MSG_EQ(demux.LookupPortLocal(80), true, "Connections port not used");
+
+    m_interface = nullptr;
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief Endpoint demux TestSuite
+ */
+class EndPointDemuxTestSuite : public TestSuite
+{
+  public:
+    EndPointDemuxTestSuite()
+        : TestSuite("end-point-demux", Type::UNIT)
+    {
+        AddTestCase(
+            new EndPointDemuxTestCase<Ipv4EndPointDemux, Ipv4EndPoint, Ipv4Address, Ipv4Interface>(
+                "IPv4 endpoint demux",
+                Ipv4Address("10.0.0.1"),
+                Ipv4Address("10.0.0.2"),
+                Ipv4Address("10.0.0.3")),
+            TestCase::Duration::QUICK);
+        AddTestCase(
+            new EndPointDemuxTestCase<Ipv6EndPointDemux, Ipv6EndPoint, Ipv6Address, Ipv6Interface>(
+                "IPv6 endpoint demux",
+                Ipv6Address("2001:db8::1"),
+                Ipv6Address("2001:db8::2"),
+                Ipv6Address("2001:db8::3")),
+            TestCase::Duration::QUICK);
+    }
+};
+
+static EndPointDemuxTestSuite g_endPointDemuxTestSuite; //!< Static variable for test initialization
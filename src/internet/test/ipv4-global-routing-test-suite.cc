@@ -27,9 +27,12 @@
 #include "ns3/socket-factory.h"
 #include "ns3/string.h"
 #include "ns3/test.h"
+#include "ns3/udp-header.h"
+#include "ns3/udp-l4-protocol.h"
 #include "ns3/udp-socket-factory.h"
 #include "ns3/uinteger.h"
 
+#include <sstream>
 #include <vector>
 
 using namespace ns3;
@@ -1300,6 +1303,326 @@ Ipv4GlobalRoutingSlash32TestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ *
+ * \brief IPv4 GlobalRouting test of the parallel and incremental route computations
+ *
+ * A chain of routers, each with a host attached by a point-to-point link, and
+ * a LAN between the first two routers:
+ *
+ *     h0      h1      h2      h3      h4
+ *     |       |       |       |       |
+ *     r0 ==== r1 ---- r2 ---- r3 ---- r4
+ *        LAN
+ *
+ * The routing tables computed with several threads, and incrementally after
+ * the r3-r4 link goes down, must be identical to those computed from scratch
+ * by a single thread.  The routes of the hosts h0 to h2, which are stubs
+ * whose neighbor is not affected by the change, must not be recomputed.
+ */
+class Ipv4GlobalRoutingParallelIncrementalTestCase : public TestCase
+{
+  public:
+    Ipv4GlobalRoutingParallelIncrementalTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Get the global routing protocol of a node.
+     * \param node The node.
+     * \returns The routing protocol.
+     */
+    static Ptr<Ipv4GlobalRouting> GetRouting(Ptr<Node> node);
+
+    /**
+     * \brief Describe the routing tables of all the nodes.
+     * \returns one line per route
+     */
+    std::string GetRoutingTables() const;
+
+    NodeContainer m_routers; //!< The routers.
+    NodeContainer m_hosts;   //!< The hosts.
+};
+
+Ipv4GlobalRoutingParallelIncrementalTestCase::Ipv4GlobalRoutingParallelIncrementalTestCase()
+    : TestCase("Parallel and incremental global route computation")
+{
+}
+
+Ptr<Ipv4GlobalRouting>
+Ipv4GlobalRoutingParallelIncrementalTestCase::GetRouting(Ptr<Node> node)
+{
+    return DynamicCast<Ipv4GlobalRouting>(node->GetObject<Ipv4>()->GetRoutingProtocol());
+}
+
+std::string
+Ipv4GlobalRoutingParallelIncrementalTestCase::GetRoutingTables() const
+{
+    std::ostringstream oss;
+    for (auto container : {m_routers, m_hosts})
+    {
+        for (auto node = container.Begin(); node != container.End(); node++)
+        {
+            auto routing = GetRouting(*node);
+            for (uint32_t i = 0; i < routing->GetNRoutes(); i++)
+            {
+                oss << (*node)->GetId() << ": " << *routing->GetRoute(i) << std::endl;
+            }
+        }
+    }
+    return oss.str();
+}
+
+void
+Ipv4GlobalRoutingParallelIncrementalTestCase::DoRun()
+{
+    const uint32_t n = 5;
+    m_routers.Create(n);
+    m_hosts.Create(n);
+
+    InternetStackHelper internet;
+    Ipv4GlobalRoutingHelper ipv4RoutingHelper;
+    internet.SetRoutingHelper(ipv4RoutingHelper);
+    internet.Install(m_routers);
+    internet.Install(m_hosts);
+
+    SimpleNetDeviceHelper p2pHelper;
+    p2pHelper.SetNetDevicePointToPointMode(true);
+    SimpleNetDeviceHelper lanHelper;
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.0.0", "255.255.255.0");
+
+    NetDeviceContainer lan = lanHelper.Install(NodeContainer(m_routers.Get(0), m_routers.Get(1)));
+    ipv4.Assign(lan);
+    ipv4.NewNetwork();
+    Ptr<NetDevice> lastLink;
+    for (uint32_t i = 1; i + 1 < n; i++)
+    {
+        auto link = p2pHelper.Install(NodeContainer(m_routers.Get(i), m_routers.Get(i + 1)));
+        ipv4.Assign(link);
+        ipv4.NewNetwork();
+        lastLink = link.Get(0);
+    }
+    for (uint32_t i = 0; i < n; i++)
+    {
+        ipv4.Assign(p2pHelper.Install(NodeContainer(m_hosts.Get(i), m_routers.Get(i))));
+        ipv4.NewNetwork();
+    }
+
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+    std::string expected = GetRoutingTables();
+
+    Config::SetGlobal("GlobalRoutingThreads", UintegerValue(3));
+    Ipv4GlobalRoutingHelper::RecomputeRoutingTables();
+    NS_TEST_EXPECT_MSG_EQ(GetRoutingTables(), expected, "Parallel computation differs");
+
+    // the routes are left unchanged if the topology did not change
+    Config::SetGlobal("GlobalRoutingIncremental", BooleanValue(true));
+    std::vector<Ipv4RoutingTableEntry*> routes;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        routes.push_back(GetRouting(m_hosts.Get(i))->GetRoute(0));
+    }
+    routes.push_back(GetRouting(m_routers.Get(1))->GetRoute(0));
+    Ipv4GlobalRoutingHelper::RecomputeRoutingTables();
+    NS_TEST_EXPECT_MSG_EQ(GetRoutingTables(), expected, "Incremental computation differs");
+    NS_TEST_EXPECT_MSG_EQ(GetRouting(m_routers.Get(1))->GetRoute(0),
+                          routes[n],
+                          "Route recomputed without any change");
+
+    // take the link between r3 and r4 down
+    auto ipv4r3 = m_routers.Get(3)->GetObject<Ipv4>();
+    ipv4r3->SetDown(ipv4r3->GetInterfaceForDevice(lastLink));
+    Ipv4GlobalRoutingHelper::RecomputeRoutingTables();
+    std::string incremental = GetRoutingTables();
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(GetRouting(m_hosts.Get(i))->GetRoute(0),
+                              routes[i],
+                              "Unaffected stub route " << i << " recomputed");
+    }
+
+    Config::SetGlobal("GlobalRoutingThreads", UintegerValue(1));
+    Config::SetGlobal("GlobalRoutingIncremental", BooleanValue(false));
+    Ipv4GlobalRoutingHelper::RecomputeRoutingTables();
+    NS_TEST_EXPECT_MSG_EQ(incremental, GetRoutingTables(), "Incremental computation differs");
+    NS_TEST_EXPECT_MSG_NE(incremental, expected, "Topology change not taken into account");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief IPv4 GlobalRouting test of the flow based ECMP routing and route cache
+ *
+ * A router has four equal cost routes to a network, through four interfaces.
+ * The packets of a flow must always be forwarded through the same interface,
+ * the flows must be spread over all the interfaces, and the route cache
+ * must not change the selected routes.
+ */
+class Ipv4GlobalRoutingFlowEcmpTestCase : public TestCase
+{
+  public:
+    Ipv4GlobalRoutingFlowEcmpTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Get the output interface of a forwarded UDP packet.
+     * \param source The source address.
+     * \param sport The source port.
+     * \param dport The destination port.
+     * \param fragment Whether the packet is a fragment.
+     * \returns The output interface, or 0 if no route was found.
+     */
+    uint32_t Forward(Ipv4Address source, uint16_t sport, uint16_t dport, bool fragment = false);
+
+    Ptr<Ipv4> m_ipv4;                 //!< The IPv4 stack of the router.
+    Ptr<Ipv4GlobalRouting> m_routing; //!< The global routing protocol of the router.
+};
+
+Ipv4GlobalRoutingFlowEcmpTestCase::Ipv4GlobalRoutingFlowEcmpTestCase()
+    : TestCase("Flow based ECMP global routing and route cache")
+{
+}
+
+uint32_t
+Ipv4GlobalRoutingFlowEcmpTestCase::Forward(Ipv4Address source,
+                                           uint16_t sport,
+                                           uint16_t dport,
+                                           bool fragment)
+{
+    Ipv4Header header;
+    header.SetSource(source);
+    header.SetDestination(Ipv4Address("10.9.1.1"));
+    header.SetProtocol(UdpL4Protocol::PROT_NUMBER);
+    if (fragment)
+    {
+        header.SetMoreFragments();
+    }
+    UdpHeader udpHeader;
+    udpHeader.SetSourcePort(sport);
+    udpHeader.SetDestinationPort(dport);
+    Ptr<Packet> packet = Create<Packet>(100);
+    packet->AddHeader(udpHeader);
+
+    uint32_t interface = 0;
+    Ipv4RoutingProtocol::UnicastForwardCallback ucb =
+        [&](Ptr<Ipv4Route> route, Ptr<const Packet>, const Ipv4Header&) {
+            interface = m_ipv4->GetInterfaceForDevice(route->GetOutputDevice());
+        };
+    m_routing->RouteInput(packet,
+                          header,
+                          m_ipv4->GetNetDevice(1),
+                          ucb,
+                          MakeNullCallback<void,
+                                           Ptr<Ipv4MulticastRoute>,
+                                           Ptr<const Packet>,
+                                           const Ipv4Header&>(),
+                          MakeNullCallback<void, Ptr<const Packet>, const Ipv4Header&, uint32_t>(),
+                          MakeNullCallback<void,
+                                           Ptr<const Packet>,
+                                           const Ipv4Header&,
+                                           Socket::SocketErrno>());
+    return interface;
+}
+
+void
+Ipv4GlobalRoutingFlowEcmpTestCase::DoRun()
+{
+    const uint32_t nRoutes = 4;
+    const uint32_t nFlows = 200;
+
+    Ptr<Node> router = CreateObject<Node>();
+    InternetStackHelper internet;
+    Ipv4GlobalRoutingHelper ipv4RoutingHelper;
+    internet.SetRoutingHelper(ipv4RoutingHelper);
+    internet.Install(router);
+    m_ipv4 = router->GetObject<Ipv4>();
+    m_routing = DynamicCast<Ipv4GlobalRouting>(m_ipv4->GetRoutingProtocol());
+
+    for (uint32_t i = 1; i <= nRoutes; i++)
+    {
+        Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice>();
+        device->SetAddress(Mac48Address::Allocate());
+        router->AddDevice(device);
+        uint32_t interface = m_ipv4->AddInterface(device);
+        m_ipv4->AddAddress(interface,
+                           Ipv4InterfaceAddress(Ipv4Address(0x0a000001 | (i << 8)),
+                                                Ipv4Mask("255.255.255.0")));
+        m_ipv4->SetUp(interface);
+        m_routing->AddNetworkRouteTo(Ipv4Address("10.9.0.0"),
+                                     Ipv4Mask("255.255.0.0"),
+                                     Ipv4Address(0x0a000002 | (i << 8)),
+                                     interface);
+    }
+
+    auto getSource = [](uint32_t flow) { return Ipv4Address(0x0a010000 + flow); };
+    auto getPort = [](uint32_t flow) { return static_cast<uint16_t>(49152 + 7 * flow); };
+
+    // without flow based ECMP, all the flows take the first route
+    for (uint32_t flow = 0; flow < nFlows; flow++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(Forward(getSource(flow), getPort(flow), 80),
+                              1,
+                              "Flow " << flow << " not routed through the first route");
+    }
+
+    m_routing->SetAttribute("FlowEcmpRouting", BooleanValue(true));
+    std::vector<uint32_t> interfaces;
+    std::vector<uint32_t> counts(nRoutes + 1);
+    for (uint32_t flow = 0; flow < nFlows; flow++)
+    {
+        interfaces.push_back(Forward(getSource(flow), getPort(flow), 80));
+        counts[interfaces.back()]++;
+    }
+    NS_TEST_EXPECT_MSG_EQ(counts[0], 0, "Flows without route");
+    for (uint32_t i = 1; i <= nRoutes; i++)
+    {
+        NS_TEST_EXPECT_MSG_GT(counts[i], nFlows / nRoutes / 2, "Unbalanced route " << i);
+    }
+
+    // the ports are part of the flow, unless the packet is a fragment
+    bool portsHashed = false;
+    for (uint16_t port = 1; port < 100; port++)
+    {
+        portsHashed |= (Forward(getSource(0), port, 80) != interfaces[0]);
+        NS_TEST_EXPECT_MSG_EQ(Forward(getSource(0), port, 80, true),
+                              Forward(getSource(0), 1, 80, true),
+                              "Fragments of a packet routed differently");
+    }
+    NS_TEST_EXPECT_MSG_EQ(portsHashed, true, "Ports not used to select the routes");
+
+    // the cache, smaller than the number of flows, returns the same routes
+    m_routing->SetAttribute("FlowCacheSize", UintegerValue(64));
+    for (uint32_t round = 0; round < 2; round++)
+    {
+        for (uint32_t flow = 0; flow < nFlows; flow++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(Forward(getSource(flow), getPort(flow), 80),
+                                  interfaces[flow],
+                                  "Flow " << flow << " changed route with the cache");
+        }
+    }
+
+    // the cached routes are flushed when a route is removed
+    m_routing->RemoveRoute(m_routing->GetNRoutes() - 1);
+    for (uint32_t flow = 0; flow < nFlows; flow++)
+    {
+        uint32_t interface = Forward(getSource(flow), getPort(flow), 80);
+        NS_TEST_EXPECT_MSG_NE(interface, nRoutes, "Flow " << flow << " uses a removed route");
+        NS_TEST_EXPECT_MSG_NE(interface, 0, "Flow " << flow << " without route");
+    }
+
+    m_ipv4 = nullptr;
+    m_routing = nullptr;
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup internet-test
  *
@@ -1322,6 +1645,8 @@ Ipv4GlobalRoutingTestSuite::Ipv4GlobalRoutingTestSuite()
     AddTestCase(new TwoBridgeTest, TestCase::Duration::QUICK);
     AddTestCase(new Ipv4DynamicGlobalRoutingTestCase, TestCase::Duration::QUICK);
     AddTestCase(new Ipv4GlobalRoutingSlash32TestCase, TestCase::Duration::QUICK);
+    AddTestCase(new Ipv4GlobalRoutingParallelIncrementalTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new Ipv4GlobalRoutingFlowEcmpTestCase, TestCase::Duration::QUICK);
 }
 
 static Ipv4GlobalRoutingTestSuite
@@ -6,6 +6,7 @@
  * Author: Zhiheng Dong <dzh2077@gmail.com>
  */
 
+#include "ns3/arp-cache.h"
 #include "ns3/icmpv4-l4-protocol.h"
 #include "ns3/icmpv6-l4-protocol.h"
 #include "ns3/internet-stack-helper.h"
@@ -15,6 +16,7 @@
 #include "ns3/ipv6-address-helper.h"
 #include "ns3/ipv6-l3-protocol.h"
 #include "ns3/ipv6-routing-helper.h"
+#include "ns3/ndisc-cache.h"
 #include "ns3/neighbor-cache-helper.h"
 #include "ns3/simple-channel.h"
 #include "ns3/simple-net-device-helper.h"
@@ -1210,6 +1212,69 @@ DynamicPartialTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ *
+ * \brief Neighbor Cache Inverse Lookup Test
+ */
+class LookupInverseTest : public TestCase
+{
+  public:
+    void DoRun() override;
+    LookupInverseTest();
+};
+
+LookupInverseTest::LookupInverseTest()
+    : TestCase("The LookupInverseTest checks that the entries are found by MAC address "
+               "when their MAC address changes and after removals.")
+{
+}
+
+void
+LookupInverseTest::DoRun()
+{
+    Mac48Address mac1("00:00:00:00:00:01");
+    Mac48Address mac2("00:00:00:00:00:02");
+    // the addresses learnt from ARP headers have no type
+    uint8_t buffer[6];
+    mac1.CopyTo(buffer);
+    Address untypedMac1;
+    untypedMac1.CopyFrom(buffer, 6);
+
+    Ptr<ArpCache> arpCache = CreateObject<ArpCache>();
+    ArpCache::Entry* arpEntry1 = arpCache->Add(Ipv4Address("10.1.1.2"));
+    ArpCache::Entry* arpEntry2 = arpCache->Add(Ipv4Address("10.1.1.1"));
+    arpEntry1->SetMacAddress(untypedMac1);
+    arpEntry2->SetMacAddress(mac1);
+    auto arpEntries = arpCache->LookupInverse(mac1);
+    NS_TEST_ASSERT_MSG_EQ(arpEntries.size(), 2, "Wrong number of ARP entries for MAC 1");
+    NS_TEST_EXPECT_MSG_EQ(arpEntries.front(), arpEntry2, "ARP entries not in address order");
+    arpEntry2->SetMacAddress(mac2);
+    NS_TEST_EXPECT_MSG_EQ(arpCache->LookupInverse(mac1).size(), 1, "Wrong ARP entries for MAC 1");
+    NS_TEST_EXPECT_MSG_EQ(arpCache->LookupInverse(mac2).front(), arpEntry2, "Wrong ARP entry");
+    arpCache->Remove(arpEntry2);
+    NS_TEST_EXPECT_MSG_EQ(arpCache->LookupInverse(mac2).empty(), true, "ARP entry not removed");
+    NS_TEST_EXPECT_MSG_EQ(arpCache->Lookup(Ipv4Address("10.1.1.1")), nullptr, "Entry not removed");
+    NS_TEST_EXPECT_MSG_EQ(arpCache->Lookup(Ipv4Address("10.1.1.2")), arpEntry1, "Entry removed");
+    arpCache->Dispose();
+
+    Ptr<NdiscCache> ndiscCache = CreateObject<NdiscCache>();
+    NdiscCache::Entry* ndiscEntry1 = ndiscCache->Add(Ipv6Address("2001::2"));
+    NdiscCache::Entry* ndiscEntry2 = ndiscCache->Add(Ipv6Address("2001::1"));
+    ndiscEntry1->MarkStale(mac1);
+    ndiscEntry2->SetMacAddress(mac1);
+    auto ndiscEntries = ndiscCache->LookupInverse(mac1);
+    NS_TEST_ASSERT_MSG_EQ(ndiscEntries.size(), 2, "Wrong number of NDISC entries for MAC 1");
+    NS_TEST_EXPECT_MSG_EQ(ndiscEntries.front(), ndiscEntry2, "NDISC entries not in address order");
+    ndiscEntry2->MarkStale(mac2);
+    NS_TEST_EXPECT_MSG_EQ(ndiscCache->LookupInverse(mac1).size(), 1, "Wrong entries for MAC 1");
+    NS_TEST_EXPECT_MSG_EQ(ndiscCache->LookupInverse(mac2).front(), ndiscEntry2, "Wrong entry");
+    ndiscCache->Remove(ndiscEntry2);
+    NS_TEST_EXPECT_MSG_EQ(ndiscCache->LookupInverse(mac2).empty(), true, "Entry not removed");
+    NS_TEST_EXPECT_MSG_EQ(ndiscCache->Lookup(Ipv6Address("2001::2")), ndiscEntry1, "Entry removed");
+    ndiscCache->Dispose();
+}
+
 /**
  * \ingroup internet-test
  *
@@ -1228,6 +1293,7 @@ class NeighborCacheTestSuite : public TestSuite
         AddTestCase(new FlushTest, TestCase::Duration::QUICK);
         AddTestCase(new DuplicateTest, TestCase::Duration::QUICK);
         AddTestCase(new DynamicPartialTest, TestCase::Duration::QUICK);
+        AddTestCase(new LookupInverseTest, TestCase::Duration::QUICK);
     }
 };
 
@@ -0,0 +1,198 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/prefix-trie.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/test.h"
+
+#include <array>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief Check the prefix trie lookups against a linear scan of the prefixes.
+ *
+ * \tparam N The key length in bytes.
+ */
+template <std::size_t N>
+class PrefixTrieLookupTestCase : public TestCase
+{
+  public:
+    PrefixTrieLookupTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// Key type
+    using Key = typename PrefixTrie<N, uint32_t>::Key;
+
+    /**
+     * \param [in] prefix The prefix.
+     * \param [in] length The prefix length.
+     * \param [in] address The address.
+     * \returns whether the prefix contains the address.
+     */
+    static bool IsMatch(const Key& prefix, uint8_t length, const Key& address);
+
+    /**
+     * \param [in] rng The random number generator.
+     * \param [in] base An address that the random key shares a random prefix with.
+     * \returns a random key.
+     */
+    static Key GetRandomKey(Ptr<UniformRandomVariable> rng, const Key& base);
+};
+
+template <std::size_t N>
+PrefixTrieLookupTestCase<N>::PrefixTrieLookupTestCase()
+    : TestCase("Prefix trie lookups with " + std::to_string(8 * N) + "-bit keys")
+{
+}
+
+template <std::size_t N>
+bool
+PrefixTrieLookupTestCase<N>::IsMatch(const Key& prefix, uint8_t length, const Key& address)
+{
+    for (uint8_t bit = 0; bit < length; ++bit)
+    {
+        uint8_t shift = 7 - bit % 8;
+        if (((prefix[bit / 8] ^ address[bit / 8]) >> shift) & 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::size_t N>
+typename PrefixTrieLookupTestCase<N>::Key
+PrefixTrieLookupTestCase<N>::GetRandomKey(Ptr<UniformRandomVariable> rng, const Key& base)
+{
+    // share a random number of leading bytes with the base address, so that
+    // the keys have long common prefixes like the addresses of a real network
+    Key key = base;
+    for (std::size_t i = rng->GetInteger(0, N); i < N; ++i)
+    {
+        key[i] = rng->GetInteger(0, 255);
+    }
+    return key;
+}
+
+template <std::size_t N>
+void
+PrefixTrieLookupTestCase<N>::DoRun()
+{
+    struct Entry
+    {
+        Key prefix;
+        uint8_t length;
+    };
+
+    auto rng = CreateObject<UniformRandomVariable>();
+    rng->SetStream(1);
+    Key base{};
+    for (auto& byte : base)
+    {
+        byte = rng->GetInteger(0, 255);
+    }
+
+    PrefixTrie<N, uint32_t> trie;
+    std::vector<Entry> entries;
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        Entry entry{GetRandomKey(rng, base), static_cast<uint8_t>(rng->GetInteger(0, 8 * N))};
+        if (i % 10 == 0 && !entries.empty())
+        {
+            // duplicate prefixes must be returned in insertion order
+            entry = entries[rng->GetInteger(0, entries.size() - 1)];
+        }
+        trie.Insert(entry.prefix, entry.length, i);
+        entries.push_back(entry);
+    }
+    NS_TEST_ASSERT_MSG_EQ(trie.GetSize(), entries.size(), "Unexpected trie size");
+
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        Key address = GetRandomKey(rng, base);
+        if (i % 2 == 0)
+        {
+            // make sure that most lookups match some long prefixes
+            address = entries[rng->GetInteger(0, entries.size() - 1)].prefix;
+            address[N - 1] ^= rng->GetInteger(0, 3);
+        }
+        std::vector<uint32_t> expected;
+        for (uint32_t j = 0; j < entries.size(); ++j)
+        {
+            if (IsMatch(entries[j].prefix, entries[j].length, address))
+            {
+                expected.push_back(j);
+            }
+        }
+        std::vector<uint32_t> matches;
+        trie.Lookup(address, matches);
+        NS_TEST_ASSERT_MSG_EQ(matches.size(), expected.size(), "Unexpected number of matches");
+        for (std::size_t j = 0; j < matches.size(); ++j)
+        {
+            NS_TEST_ASSERT_MSG_EQ(matches[j], expected[j], "Unexpected match " << j);
+        }
+    }
+
+    trie.Clear();
+    NS_TEST_ASSERT_MSG_EQ(trie.GetSize(), 0, "Trie not empty after Clear()");
+    std::vector<uint32_t> matches;
+    trie.Lookup(base, matches);
+    NS_TEST_ASSERT_MSG_EQ(matches.empty(), true, "Match found in an empty trie");
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief Check the length of the contiguous prefix covered by masks.
+ */
+class PrefixTrieLeadingOnesTestCase : public TestCase
+{
+  public:
+    PrefixTrieLeadingOnesTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+PrefixTrieLeadingOnesTestCase::PrefixTrieLeadingOnesTestCase()
+    : TestCase("Prefix trie leading ones of masks")
+{
+}
+
+void
+PrefixTrieLeadingOnesTestCase::DoRun()
+{
+    using Trie = PrefixTrie<4, uint32_t>;
+    NS_TEST_EXPECT_MSG_EQ(+Trie::GetLeadingOnes({0, 0, 0, 0}), 0, "Wrong length of /0");
+    NS_TEST_EXPECT_MSG_EQ(+Trie::GetLeadingOnes({255, 255, 255, 0}), 24, "Wrong length of /24");
+    NS_TEST_EXPECT_MSG_EQ(+Trie::GetLeadingOnes({255, 255, 240, 0}), 20, "Wrong length of /20");
+    NS_TEST_EXPECT_MSG_EQ(+Trie::GetLeadingOnes({255, 255, 255, 255}), 32, "Wrong length of /32");
+    // non-contiguous masks are indexed by their contiguous part
+    NS_TEST_EXPECT_MSG_EQ(+Trie::GetLeadingOnes({255, 0, 255, 0}), 8, "Wrong non-contiguous");
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief Prefix trie TestSuite
+ */
+class PrefixTrieTestSuite : public TestSuite
+{
+  public:
+    PrefixTrieTestSuite()
+        : TestSuite("prefix-trie", Type::UNIT)
+    {
+        AddTestCase(new PrefixTrieLeadingOnesTestCase, TestCase::Duration::QUICK);
+        AddTestCase(new PrefixTrieLookupTestCase<4>, TestCase::Duration::QUICK);
+        AddTestCase(new PrefixTrieLookupTestCase<16>, TestCase::Duration::QUICK);
+    }
+};
+
+static PrefixTrieTestSuite g_prefixTrieTestSuite; //!< Static variable for test initialization
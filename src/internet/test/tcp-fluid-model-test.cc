@@ -0,0 +1,144 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/fluid-fifo-queue-disc.h"
+#include "ns3/simulator.h"
+#include "ns3/tcp-cubic.h"
+#include "ns3/tcp-fluid-model.h"
+#include "ns3/test.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief Check that the fluid TCP flows fill the bottleneck without
+ * overflowing it, and that the classes of flows share it.
+ */
+class TcpFluidModelTestCase : public TestCase
+{
+  public:
+    /// A class of flows: the number of flows and their congestion control
+    using Flows = std::pair<uint32_t, TypeId>;
+
+    /**
+     * Constructor
+     * \param name The test name.
+     * \param classes The classes of flows.
+     */
+    TcpFluidModelTestCase(std::string name, std::vector<Flows> classes);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Sample the state of the bottleneck and of the flows.
+     */
+    void Sample();
+
+    std::vector<Flows> m_classes;        //!< The classes of flows
+    Ptr<FluidFifoQueueDisc> m_queueDisc; //!< The bottleneck queue disc
+    Ptr<TcpFluidModel> m_model;          //!< The fluid model
+    uint32_t m_samples{0};               //!< Number of samples
+    double m_utilization{0};             //!< Sum of the sampled link utilizations
+    std::vector<double> m_shares;        //!< Sum of the sampled rates of each class
+};
+
+TcpFluidModelTestCase::TcpFluidModelTestCase(std::string name, std::vector<Flows> classes)
+    : TestCase(name),
+      m_classes(std::move(classes))
+{
+}
+
+void
+TcpFluidModelTestCase::Sample()
+{
+    m_samples++;
+    DataRate rate = m_model->GetRate();
+    // the link is busy while there is a backlog, otherwise it carries the fluid
+    m_utilization += (m_queueDisc->GetBacklog() > 0
+                          ? 1
+                          : static_cast<double>(rate.GetBitRate()) / 100e6);
+    for (uint32_t i = 0; i < m_classes.size(); i++)
+    {
+        m_shares[i] += static_cast<double>(m_model->GetRate(i).GetBitRate()) / rate.GetBitRate();
+    }
+}
+
+void
+TcpFluidModelTestCase::DoRun()
+{
+    // 100 Mbps bottleneck, 50 ms RTT and a buffer of half a BDP
+    m_queueDisc = CreateObjectWithAttributes<FluidFifoQueueDisc>(
+        "MaxSize",
+        QueueSizeValue(QueueSize("312500B")),
+        "LinkRate",
+        DataRateValue(DataRate("100Mbps")));
+    m_queueDisc->Initialize();
+
+    m_model = CreateObject<TcpFluidModel>();
+    m_model->SetQueueDisc(m_queueDisc);
+    for (uint32_t i = 0; i < m_classes.size(); i++)
+    {
+        // slightly different RTTs to desynchronize the classes
+        m_model->AddFlows(m_classes[i].first, MilliSeconds(50 + i), m_classes[i].second);
+    }
+    m_shares.assign(m_classes.size(), 0);
+
+    Simulator::Schedule(Seconds(0), &TcpFluidModel::Start, m_model);
+    for (Time t = Seconds(10); t < Seconds(30); t += MilliSeconds(10))
+    {
+        Simulator::Schedule(t, &TcpFluidModelTestCase::Sample, this);
+    }
+    Simulator::Stop(Seconds(30));
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_GT(m_utilization / m_samples, 0.9, "The flows do not fill the link");
+    // including the losses at the end of the slow start
+    NS_TEST_EXPECT_MSG_LT(m_queueDisc->GetFluidDropped() / m_queueDisc->GetFluidOffered(),
+                          0.02,
+                          "Too many losses");
+    for (uint32_t i = 0; i < m_classes.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_GT(m_shares[i] / m_samples,
+                              0.5 / m_classes.size(),
+                              "Unfair share of class " << i);
+    }
+
+    m_model->Stop();
+    NS_TEST_EXPECT_MSG_EQ(m_queueDisc->GetFluidRate(), DataRate(0), "The flows are not stopped");
+
+    m_model = nullptr;
+    m_queueDisc = nullptr;
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief TCP fluid model TestSuite
+ */
+class TcpFluidModelTestSuite : public TestSuite
+{
+  public:
+    TcpFluidModelTestSuite()
+        : TestSuite("tcp-fluid-model", Type::UNIT)
+    {
+        AddTestCase(new TcpFluidModelTestCase("NewReno flows", {{20, TcpNewReno::GetTypeId()}}),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new TcpFluidModelTestCase("Cubic flows", {{20, TcpCubic::GetTypeId()}}),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new TcpFluidModelTestCase("NewReno flows in several classes",
+                                              {{10, TcpNewReno::GetTypeId()},
+                                               {10, TcpNewReno::GetTypeId()},
+                                               {10, TcpNewReno::GetTypeId()}}),
+                    TestCase::Duration::QUICK);
+    }
+};
+
+static TcpFluidModelTestSuite g_tcpFluidModelTestSuite; //!< Static variable for test initialization
@@ -31,6 +31,11 @@ class TcpRxBufferTestCase : public TestCase
      * \brief Test the SACK list update.
      */
     void TestUpdateSACKList();
+
+    /**
+     * \brief Test the coalescing of overlapping segments and their extraction.
+     */
+    void TestCoalescing();
 };
 
 TcpRxBufferTestCase::TcpRxBufferTestCase()
@@ -42,6 +47,7 @@ void
 TcpRxBufferTestCase::DoRun()
 {
     TestUpdateSACKList();
+    TestCoalescing();
 }
 
 void
@@ -277,6 +283,72 @@ TcpRxBufferTestCase::TestUpdateSACKList()
     NS_TEST_ASSERT_MSG_EQ(sackList.size(), 0, "SACK list should contain no element");
 }
 
+void
+TcpRxBufferTestCase::TestCoalescing()
+{
+    TcpRxBuffer rxBuf;
+    TcpOptionSack::SackList sackList;
+    TcpHeader h;
+    rxBuf.SetNextRxSequence(SequenceNumber32(1));
+    rxBuf.SetMaxBufferSize(10000);
+
+    // Five out of order blocks, the oldest is not reported anymore
+    for (uint32_t seq = 201; seq <= 1001; seq += 200)
+    {
+        h.SetSequenceNumber(SequenceNumber32(seq));
+        NS_TEST_ASSERT_MSG_EQ(rxBuf.Add(Create<Packet>(100), h), true, "Segment not buffered");
+    }
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.GetSackListSize(), 4, "SACK list should contain four elements");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Size(), 500, "Wrong buffer occupancy");
+
+    // A segment overlapping the first two blocks fills the gap between them,
+    // and the first SACK block covers both, including the one not reported
+    h.SetSequenceNumber(SequenceNumber32(251));
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Add(Create<Packet>(200), h), true, "Segment not buffered");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Size(), 600, "Wrong buffer occupancy");
+    sackList = rxBuf.GetSackList();
+    NS_TEST_ASSERT_MSG_EQ(sackList.size(), 4, "SACK list should contain four elements");
+    NS_TEST_ASSERT_MSG_EQ(sackList.front().first,
+                          SequenceNumber32(201),
+                          "SACK block different than expected");
+    NS_TEST_ASSERT_MSG_EQ(sackList.front().second,
+                          SequenceNumber32(501),
+                          "SACK block different than expected");
+
+    // Segments already buffered are not stored again
+    h.SetSequenceNumber(SequenceNumber32(301));
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Add(Create<Packet>(150), h), false, "Duplicate buffered");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Size(), 600, "Wrong buffer occupancy");
+
+    // A segment covering several blocks and the next expected byte
+    h.SetSequenceNumber(SequenceNumber32(1));
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Add(Create<Packet>(1000), h), true, "Segment not buffered");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.NextRxSequence(),
+                          SequenceNumber32(1101),
+                          "Sequence number differs from expected");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Available(), 1100, "Wrong available bytes");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Size(), 1100, "Wrong buffer occupancy");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.GetSackListSize(), 0, "SACK list should be empty");
+
+    // Extract the data in pieces which do not match the segments
+    uint32_t extracted = 0;
+    for (uint32_t size : {150, 500, 1000})
+    {
+        Ptr<Packet> p = rxBuf.Extract(size);
+        NS_TEST_ASSERT_MSG_NE(p, nullptr, "Nothing extracted");
+        NS_TEST_ASSERT_MSG_EQ(p->GetSize(), std::min(size, 1100 - extracted), "Wrong size");
+        extracted += p->GetSize();
+        NS_TEST_ASSERT_MSG_EQ(rxBuf.Size(), 1100 - extracted, "Wrong buffer occupancy");
+        NS_TEST_ASSERT_MSG_EQ(rxBuf.Available(), 1100 - extracted, "Wrong available bytes");
+    }
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Extract(100), nullptr, "Extracted from an empty buffer");
+
+    // In order data after the extraction
+    h.SetSequenceNumber(SequenceNumber32(1101));
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Add(Create<Packet>(100), h), true, "Segment not buffered");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Available(), 100, "Wrong available bytes");
+}
+
 void
 TcpRxBufferTestCase::DoTeardown()
 {
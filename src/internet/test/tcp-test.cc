@@ -27,6 +27,7 @@
 #include "ns3/simulator.h"
 #include "ns3/socket-factory.h"
 #include "ns3/tcp-l4-protocol.h"
+#include "ns3/tcp-socket-base.h"
 #include "ns3/tcp-socket-factory.h"
 #include "ns3/test.h"
 #include "ns3/traffic-control-layer.h"
@@ -55,13 +56,15 @@ class TcpTestCase : public TestCase
      * \param serverWriteSize Server data size when sending.
      * \param serverReadSize Server data size when receiving.
      * \param useIpv6 Use IPv6 instead of IPv4.
+     * \param useOffload Use segmentation and receive offloads.
      */
     TcpTestCase(uint32_t totalStreamSize,
                 uint32_t sourceWriteSize,
                 uint32_t sourceReadSize,
                 uint32_t serverWriteSize,
                 uint32_t serverReadSize,
-                bool useIpv6);
+                bool useIpv6,
+                bool useOffload);
 
   private:
     void DoRun() override;
@@ -134,6 +137,26 @@ class TcpTestCase : public TestCase
      * \param sock The socket.
      */
     void SourceHandleRecv(Ptr<Socket> sock);
+    /**
+     * \brief Client: Segment sent.
+     * \param p The segment payload.
+     * \param h The TCP header.
+     * \param socket The socket.
+     */
+    void SourceTx(Ptr<const Packet> p, const TcpHeader& h, Ptr<const TcpSocketBase> socket);
+    /**
+     * \brief Server: Segment received.
+     * \param p The segment.
+     * \param h The TCP header.
+     * \param socket The socket.
+     */
+    void ServerRx(Ptr<const Packet> p, const TcpHeader& h, Ptr<const TcpSocketBase> socket);
+    /**
+     * \brief Enable the offloads on a socket and trace its segments.
+     * \param socket The socket.
+     * \param isServer Whether the socket is the server one.
+     */
+    void SetupOffload(Ptr<Socket> socket, bool isServer);
 
     uint32_t m_totalBytes;           //!< Total stream size (in bytes).
     uint32_t m_sourceWriteSize;      //!< Client data size when sending.
@@ -147,8 +170,11 @@ class TcpTestCase : public TestCase
     uint8_t* m_sourceTxPayload;      //!< Client Tx payload.
     uint8_t* m_sourceRxPayload;      //!< Client Rx payload.
     uint8_t* m_serverRxPayload;      //!< Server Rx payload.
+    uint32_t m_maxSourceTxSize;      //!< Largest segment sent by the client.
+    uint32_t m_maxServerRxSize;      //!< Largest segment received by the server.
 
-    bool m_useIpv6; //!< Use IPv6 instead of IPv4.
+    bool m_useIpv6;    //!< Use IPv6 instead of IPv4.
+    bool m_useOffload; //!< Use segmentation and receive offloads.
 };
 
 static std::string
@@ -158,12 +184,17 @@ Name(std::string str,
      uint32_t serverReadSize,
      uint32_t serverWriteSize,
      uint32_t sourceReadSize,
-     bool useIpv6)
+     bool useIpv6,
+     bool useOffload)
 {
     std::ostringstream oss;
     oss << str << " total=" << totalStreamSize << " sourceWrite=" << sourceWriteSize
         << " sourceRead=" << sourceReadSize << " serverRead=" << serverReadSize
         << " serverWrite=" << serverWriteSize << " useIpv6=" << useIpv6;
+    if (useOffload)
+    {
+        oss << " useOffload=" << useOffload;
+    }
     return oss.str();
 }
 
@@ -180,20 +211,23 @@ TcpTestCase::TcpTestCase(uint32_t totalStreamSize,
                          uint32_t sourceReadSize,
                          uint32_t serverWriteSize,
                          uint32_t serverReadSize,
-                         bool useIpv6)
+                         bool useIpv6,
+                         bool useOffload)
     : TestCase(Name("Send string data from client to server and back",
                     totalStreamSize,
                     sourceWriteSize,
                     serverReadSize,
                     serverWriteSize,
                     sourceReadSize,
-                    useIpv6)),
+                    useIpv6,
+                    useOffload)),
       m_totalBytes(totalStreamSize),
       m_sourceWriteSize(sourceWriteSize),
       m_sourceReadSize(sourceReadSize),
       m_serverWriteSize(serverWriteSize),
       m_serverReadSize(serverReadSize),
-      m_useIpv6(useIpv6)
+      m_useIpv6(useIpv6),
+      m_useOffload(useOffload)
 {
 }
 
@@ -204,6 +238,8 @@ TcpTestCase::DoRun()
     m_currentSourceRxBytes = 0;
     m_currentServerRxBytes = 0;
     m_currentServerTxBytes = 0;
+    m_maxSourceTxSize = 0;
+    m_maxServerRxSize = 0;
     m_sourceTxPayload = new uint8_t[m_totalBytes];
     m_sourceRxPayload = new uint8_t[m_totalBytes];
     m_serverRxPayload = new uint8_t[m_totalBytes];
@@ -235,6 +271,11 @@ TcpTestCase::DoRun()
     NS_TEST_EXPECT_MSG_EQ(memcmp(m_sourceTxPayload, m_sourceRxPayload, m_totalBytes),
                           0,
                           "Source received back expected data buffers");
+    if (m_useOffload)
+    {
+        NS_TEST_EXPECT_MSG_GT(m_maxSourceTxSize, 1000, "No super-segment sent");
+        NS_TEST_EXPECT_MSG_GT(m_maxServerRxSize, 1000, "No segments coalesced");
+    }
 }
 
 void
@@ -334,6 +375,33 @@ TcpTestCase::SourceHandleRecv(Ptr<Socket> sock)
     }
 }
 
+void
+TcpTestCase::SourceTx(Ptr<const Packet> p, const TcpHeader& h, Ptr<const TcpSocketBase> socket)
+{
+    m_maxSourceTxSize = std::max(m_maxSourceTxSize, p->GetSize());
+}
+
+void
+TcpTestCase::ServerRx(Ptr<const Packet> p, const TcpHeader& h, Ptr<const TcpSocketBase> socket)
+{
+    m_maxServerRxSize = std::max(m_maxServerRxSize, p->GetSize());
+}
+
+void
+TcpTestCase::SetupOffload(Ptr<Socket> socket, bool isServer)
+{
+    socket->SetAttribute("TsoMaxSegments", UintegerValue(8));
+    if (isServer)
+    {
+        // the accepted sockets inherit the trace from the listening socket
+        socket->TraceConnectWithoutContext("Rx", MakeCallback(&TcpTestCase::ServerRx, this));
+    }
+    else
+    {
+        socket->TraceConnectWithoutContext("Tx", MakeCallback(&TcpTestCase::SourceTx, this));
+    }
+}
+
 Ptr<Node>
 TcpTestCase::CreateInternetNode()
 {
@@ -361,6 +429,10 @@ TcpTestCase::CreateInternetNode()
     node->AggregateObject(udp);
     // TCP
     Ptr<TcpL4Protocol> tcp = CreateObject<TcpL4Protocol>();
+    if (m_useOffload)
+    {
+        tcp->SetAttribute("GroTimeout", TimeValue(MilliSeconds(1)));
+    }
     node->AggregateObject(tcp);
     return node;
 }
@@ -399,6 +471,11 @@ TcpTestCase::SetupDefaultSim()
 
     Ptr<Socket> server = sockFactory0->CreateSocket();
     Ptr<Socket> source = sockFactory1->CreateSocket();
+    if (m_useOffload)
+    {
+        SetupOffload(server, true);
+        SetupOffload(source, false);
+    }
 
     uint16_t port = 50000;
     InetSocketAddress serverlocaladdr(Ipv4Address::GetAny(), port);
@@ -449,6 +526,11 @@ TcpTestCase::SetupDefaultSim6()
 
     Ptr<Socket> server = sockFactory0->CreateSocket();
     Ptr<Socket> source = sockFactory1->CreateSocket();
+    if (m_useOffload)
+    {
+        SetupOffload(server, true);
+        SetupOffload(source, false);
+    }
 
     uint16_t port = 50000;
     Inet6SocketAddress serverlocaladdr(Ipv6Address::GetAny(), port);
@@ -502,6 +584,10 @@ TcpTestCase::CreateInternetNode6()
     node->AggregateObject(udp);
     // TCP
     Ptr<TcpL4Protocol> tcp = CreateObject<TcpL4Protocol>();
+    if (m_useOffload)
+    {
+        tcp->SetAttribute("GroTimeout", TimeValue(MilliSeconds(1)));
+    }
     node->AggregateObject(tcp);
     // Traffic Control
     Ptr<TrafficControlLayer> tc = CreateObject<TrafficControlLayer>();
@@ -538,13 +624,23 @@ class TcpTestSuite : public TestSuite
         // 2) source write size, 3) source read size
         // 4) server write size, and 5) server read size
         // with units of bytes
-        AddTestCase(new TcpTestCase(13, 200, 200, 200, 200, false), TestCase::Duration::QUICK);
-        AddTestCase(new TcpTestCase(13, 1, 1, 1, 1, false), TestCase::Duration::QUICK);
-        AddTestCase(new TcpTestCase(100000, 100, 50, 100, 20, false), TestCase::Duration::QUICK);
-
-        AddTestCase(new TcpTestCase(13, 200, 200, 200, 200, true), TestCase::Duration::QUICK);
-        AddTestCase(new TcpTestCase(13, 1, 1, 1, 1, true), TestCase::Duration::QUICK);
-        AddTestCase(new TcpTestCase(100000, 100, 50, 100, 20, true), TestCase::Duration::QUICK);
+        // 6) IPv6 instead of IPv4, and 7) segmentation and receive offloads
+        AddTestCase(new TcpTestCase(13, 200, 200, 200, 200, false, false),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new TcpTestCase(13, 1, 1, 1, 1, false, false), TestCase::Duration::QUICK);
+        AddTestCase(new TcpTestCase(100000, 100, 50, 100, 20, false, false),
+                    TestCase::Duration::QUICK);
+
+        AddTestCase(new TcpTestCase(13, 200, 200, 200, 200, true, false),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new TcpTestCase(13, 1, 1, 1, 1, true, false), TestCase::Duration::QUICK);
+        AddTestCase(new TcpTestCase(100000, 100, 50, 100, 20, true, false),
+                    TestCase::Duration::QUICK);
+
+        AddTestCase(new TcpTestCase(100000, 100, 50, 100, 20, false, true),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new TcpTestCase(100000, 100, 50, 100, 20, true, true),
+                    TestCase::Duration::QUICK);
     }
 };
 
@@ -0,0 +1,165 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "tcp-error-model.h"
+#include "tcp-general-test.h"
+
+#include "ns3/config.h"
+#include "ns3/log.h"
+#include "ns3/tcp-option-sack.h"
+#include "ns3/tcp-tx-buffer.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("TcpTsoTestSuite");
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief Check the SACK processing of the super-segments sent with
+ * segmentation offload.
+ *
+ * Segments are dropped inside super-segments, so that the receiver SACKs
+ * only some of the segments of a super-segment. After each ACK, the bytes
+ * marked as sacked in the sender Tx buffer must match the bytes covered by
+ * the SACK blocks of the ACK, and the losses must be recovered without RTO.
+ */
+class TcpTsoSackTest : public TcpGeneralTest
+{
+  public:
+    /**
+     * \brief Constructor.
+     * \param desc Description.
+     * \param tsoMaxSegments Maximum number of segments of a super-segment.
+     * \param toDrop Sequence numbers of the segments to drop.
+     */
+    TcpTsoSackTest(const std::string& desc,
+                   uint32_t tsoMaxSegments,
+                   const std::vector<uint32_t>& toDrop);
+
+  protected:
+    void ConfigureEnvironment() override;
+    Ptr<ErrorModel> CreateReceiverErrorModel() override;
+    void Tx(const Ptr<const Packet> p, const TcpHeader& h, SocketWho who) override;
+    void ProcessedAck(const Ptr<const TcpSocketState> tcb,
+                      const TcpHeader& h,
+                      SocketWho who) override;
+    void AfterRTOExpired(const Ptr<const TcpSocketState> tcb, SocketWho who) override;
+    void FinalChecks() override;
+
+  private:
+    uint32_t m_tsoMaxSegments;      //!< Maximum number of segments of a super-segment.
+    std::vector<uint32_t> m_toDrop; //!< Sequence numbers of the segments to drop.
+    uint32_t m_partialLosses{0};    //!< Number of drops inside a super-segment.
+    uint32_t m_sackedAcks{0};       //!< Number of ACKs received with SACK blocks.
+};
+
+TcpTsoSackTest::TcpTsoSackTest(const std::string& desc,
+                               uint32_t tsoMaxSegments,
+                               const std::vector<uint32_t>& toDrop)
+    : TcpGeneralTest(desc),
+      m_tsoMaxSegments(tsoMaxSegments),
+      m_toDrop(toDrop)
+{
+}
+
+void
+TcpTsoSackTest::ConfigureEnvironment()
+{
+    TcpGeneralTest::ConfigureEnvironment();
+    SetAppPktCount(100);
+    SetPropagationDelay(MilliSeconds(50));
+    SetTransmitStart(Seconds(2.0));
+
+    Config::SetDefault("ns3::TcpSocketBase::Sack", BooleanValue(true));
+    Config::SetDefault("ns3::TcpSocketBase::TsoMaxSegments", UintegerValue(m_tsoMaxSegments));
+}
+
+Ptr<ErrorModel>
+TcpTsoSackTest::CreateReceiverErrorModel()
+{
+    Ptr<TcpSeqErrorModel> errorModel = CreateObject<TcpSeqErrorModel>();
+    for (const auto seq : m_toDrop)
+    {
+        errorModel->AddSeqToKill(SequenceNumber32(seq));
+    }
+    return errorModel;
+}
+
+void
+TcpTsoSackTest::Tx(const Ptr<const Packet> p, const TcpHeader& h, SocketWho who)
+{
+    if (who != SENDER || p->GetSize() <= GetSegSize(SENDER))
+    {
+        return;
+    }
+    NS_LOG_DEBUG("Super-segment seq=" << h.GetSequenceNumber() << " size=" << p->GetSize());
+    for (const auto seq : m_toDrop)
+    {
+        if (SequenceNumber32(seq) >= h.GetSequenceNumber() &&
+            SequenceNumber32(seq) < h.GetSequenceNumber() + p->GetSize())
+        {
+            ++m_partialLosses;
+        }
+    }
+}
+
+void
+TcpTsoSackTest::ProcessedAck(const Ptr<const TcpSocketState> tcb,
+                             const TcpHeader& h,
+                             SocketWho who)
+{
+    if (who != SENDER || !h.HasOption(TcpOption::SACK))
+    {
+        return;
+    }
+    auto sack = DynamicCast<const TcpOptionSack>(h.GetOption(TcpOption::SACK));
+    uint32_t sackedBytes = 0;
+    for (const auto& block : sack->GetSackList())
+    {
+        sackedBytes += block.second - std::max(block.first, h.GetAckNumber());
+    }
+    ++m_sackedAcks;
+    NS_TEST_ASSERT_MSG_EQ(GetTxBuffer(SENDER)->GetSacked(),
+                          sackedBytes,
+                          "At time " << Simulator::Now().GetSeconds()
+                                     << "; the sacked bytes do not match the SACK blocks");
+}
+
+void
+TcpTsoSackTest::AfterRTOExpired(const Ptr<const TcpSocketState> tcb, SocketWho who)
+{
+    NS_TEST_ASSERT_MSG_EQ(who, RECEIVER, "The losses should be recovered without RTO");
+}
+
+void
+TcpTsoSackTest::FinalChecks()
+{
+    NS_TEST_ASSERT_MSG_EQ(m_partialLosses,
+                          m_toDrop.size(),
+                          "The dropped segments should be inside super-segments");
+    NS_TEST_ASSERT_MSG_GT(m_sackedAcks, 0, "No ACK with SACK blocks received");
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief TestSuite: Check the SACK processing of the super-segments
+ */
+class TcpTsoTestSuite : public TestSuite
+{
+  public:
+    TcpTsoTestSuite()
+        : TestSuite("tcp-tso", Type::UNIT)
+    {
+        AddTestCase(new TcpTsoSackTest("SACK of super-segments, one drop", 4, {4001}),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new TcpTsoSackTest("SACK of super-segments, two drops", 4, {4001, 10001}),
+                    TestCase::Duration::QUICK);
+    }
+};
+
+static TcpTsoTestSuite g_tcpTsoTestSuite; //!< Static variable for test initialization
@@ -42,6 +42,10 @@ class TcpTxBufferTestCase : public TestCase
     /** \brief Test the logic of merging items in GetTransmittedSegment()
      * which is triggered by CopyFromSequence()*/
     void TestMergeItemsWhenGetTransmittedSegment();
+    /** \brief Test SACK blocks over segments merged or split after their transmission */
+    void TestSackMergedAndSplitSegments();
+    /** \brief Test the removal of the SACK flag from a segment becoming the head */
+    void TestSackedHead();
     /**
      * \brief Callback to provide a value of receiver window
      * \returns the receiver window size
@@ -89,6 +93,22 @@ TcpTxBufferTestCase::DoRun()
                         &TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment,
                         this);
 
+    /*
+     * Cases for SACK blocks over retransmitted segments:
+     * -> a block over a part of merged segments is ignored
+     * -> a block over merged segments sacks them
+     * -> blocks over each part of a split segment sack them
+     * -> the lost segments are found from the merged and split segments
+     */
+    Simulator::Schedule(Seconds(0.0), &TcpTxBufferTestCase::TestSackMergedAndSplitSegments, this);
+
+    /*
+     * Cases for a sacked segment becoming the head:
+     * -> the whole segments before it are acked
+     * -> the segment is fragmented by the ack
+     */
+    Simulator::Schedule(Seconds(0.0), &TcpTxBufferTestCase::TestSackedHead, this);
+
     Simulator::Run();
     Simulator::Destroy();
 }
@@ -409,6 +429,149 @@ TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment()
     txBuf.CopyFromSequence(2000, SequenceNumber32(1));
 }
 
+void
+TcpTxBufferTestCase::TestSackMergedAndSplitSegments()
+{
+    Ptr<TcpTxBuffer> txBuf = CreateObject<TcpTxBuffer>();
+    txBuf->SetRWndCallback(MakeCallback(&TcpTxBufferTestCase::GetRWnd, this));
+    txBuf->SetHeadSequence(SequenceNumber32(1));
+    txBuf->SetSegmentSize(1000);
+    txBuf->SetDupAckThresh(3);
+    txBuf->SetSackEnabled(true);
+
+    txBuf->Add(Create<Packet>(10000));
+    for (uint8_t i = 0; i < 10; ++i)
+    {
+        txBuf->CopyFromSequence(1000, SequenceNumber32((i * 1000) + 1));
+    }
+
+    // merge [3001;4001) and [4001;5001) by retransmitting them at once
+    txBuf->CopyFromSequence(2000, SequenceNumber32(3001));
+    // split [6001;7001) by retransmitting its first half
+    txBuf->CopyFromSequence(500, SequenceNumber32(6001));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetRetransmitsCount(), 2500, "Wrong retransmitted bytes");
+
+    TcpOptionSack::SackList sackList;
+    sackList.emplace_back(SequenceNumber32(4001), SequenceNumber32(5001));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->Update(sackList),
+                          0,
+                          "A block over a part of merged segments has been applied");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), 0, "Wrong sacked bytes");
+
+    sackList.clear();
+    sackList.emplace_back(SequenceNumber32(3001), SequenceNumber32(5001));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->Update(sackList), 2000, "Merged segments have not been sacked");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), 2000, "Wrong sacked bytes");
+
+    sackList.clear();
+    sackList.emplace_back(SequenceNumber32(6501), SequenceNumber32(7001));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->Update(sackList), 500, "Second part of split segment not sacked");
+    sackList.clear();
+    sackList.emplace_back(SequenceNumber32(6001), SequenceNumber32(6501));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->Update(sackList), 500, "First part of split segment not sacked");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), 3000, "Wrong sacked bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetRetransmitsCount(), 2500, "Wrong retransmitted bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(), 0, "Segments lost before three sacked segments");
+
+    // The segments sacked above [5001;6001) are [6001;6501), [6501;7001) and
+    // [7001;8001): it is lost, as well as the segments before the merged ones
+    sackList.clear();
+    sackList.emplace_back(SequenceNumber32(7001), SequenceNumber32(8001));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->Update(sackList), 1000, "Segment not sacked");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), 4000, "Wrong sacked bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(), 4000, "Wrong lost bytes");
+    for (uint32_t seq : {1, 1001, 2001, 5001})
+    {
+        NS_TEST_ASSERT_MSG_EQ(txBuf->IsLost(SequenceNumber32(seq)),
+                              true,
+                              "Segment starting at " << seq << " not lost");
+    }
+    for (uint32_t seq : {3001, 4001, 6001, 6501, 7001})
+    {
+        NS_TEST_ASSERT_MSG_EQ(txBuf->IsLost(SequenceNumber32(seq)),
+                              false,
+                              "Sacked segment starting at " << seq << " lost");
+    }
+    // sent (10000) - sacked (4000) - lost (4000) + retransmitted (2500)
+    NS_TEST_ASSERT_MSG_EQ(txBuf->BytesInFlight(), 4500, "Wrong bytes in flight");
+
+    // Retransmit the lost segments, which are not merged with the sacked ones
+    SequenceNumber32 seq;
+    SequenceNumber32 seqHigh;
+    for (uint32_t expected : {1, 1001, 2001, 5001})
+    {
+        NS_TEST_ASSERT_MSG_EQ(txBuf->NextSeg(&seq, &seqHigh, true), true, "No next segment");
+        NS_TEST_ASSERT_MSG_EQ(seq, SequenceNumber32(expected), "Wrong next segment");
+        NS_TEST_ASSERT_MSG_EQ(txBuf->CopyFromSequence(1000, seq)->GetSeqSize(),
+                              1000,
+                              "Wrong size of the retransmitted segment");
+    }
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetRetransmitsCount(), 6500, "Wrong retransmitted bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->NextSeg(&seq, &seqHigh, true),
+                          false,
+                          "No segment should be left to transmit");
+
+    txBuf->DiscardUpTo(SequenceNumber32(10001));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->Size(), 0, "Data inside the buffer");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), 0, "Wrong sacked bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(), 0, "Wrong lost bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetRetransmitsCount(), 0, "Wrong retransmitted bytes");
+}
+
+void
+TcpTxBufferTestCase::TestSackedHead()
+{
+    Ptr<TcpTxBuffer> txBuf = CreateObject<TcpTxBuffer>();
+    txBuf->SetRWndCallback(MakeCallback(&TcpTxBufferTestCase::GetRWnd, this));
+    txBuf->SetHeadSequence(SequenceNumber32(1));
+    txBuf->SetSegmentSize(1000);
+    txBuf->SetDupAckThresh(3);
+    txBuf->SetSackEnabled(true);
+
+    txBuf->Add(Create<Packet>(6000));
+    for (uint8_t i = 0; i < 6; ++i)
+    {
+        txBuf->CopyFromSequence(1000, SequenceNumber32((i * 1000) + 1));
+    }
+
+    TcpOptionSack::SackList sackList;
+    sackList.emplace_back(SequenceNumber32(1001), SequenceNumber32(2001));
+    sackList.emplace_back(SequenceNumber32(3001), SequenceNumber32(4001));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->Update(sackList), 2000, "Segments not sacked");
+
+    // the sacked segment [1001;2001) becomes the head: it is marked as lost and
+    // its SACK flag moves to the first segment not sacked, [2001;3001)
+    txBuf->DiscardUpTo(SequenceNumber32(1001));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), 2000, "Wrong sacked bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(), 1000, "Head not lost");
+    SequenceNumber32 seq;
+    SequenceNumber32 seqHigh;
+    NS_TEST_ASSERT_MSG_EQ(txBuf->NextSeg(&seq, &seqHigh, true), true, "No next segment");
+    NS_TEST_ASSERT_MSG_EQ(seq, SequenceNumber32(1001), "The head is not the next segment");
+
+    // the sacked segment [3001;4001) is fragmented by the ack and becomes the
+    // head, its SACK flag moves to [4001;5001)
+    txBuf->DiscardUpTo(SequenceNumber32(3501));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), 1000, "Wrong sacked bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(), 500, "Head not lost");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->NextSeg(&seq, &seqHigh, true), true, "No next segment");
+    NS_TEST_ASSERT_MSG_EQ(seq, SequenceNumber32(3501), "The head is not the next segment");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->CopyFromSequence(1000, seq)->GetSeqSize(),
+                          500,
+                          "The fragmented head has been merged with another segment");
+
+    // the segments after the head can still be sacked
+    sackList.clear();
+    sackList.emplace_back(SequenceNumber32(4001), SequenceNumber32(6001));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->Update(sackList), 1000, "Segment not sacked");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), 2000, "Wrong sacked bytes");
+
+    txBuf->DiscardUpTo(SequenceNumber32(6001));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->Size(), 0, "Data inside the buffer");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), 0, "Wrong sacked bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(), 0, "Wrong lost bytes");
+}
+
 void
 TcpTxBufferTestCase::TestTransmittedBlock()
 {
@@ -0,0 +1,201 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "spatial-grid.h"
+
+#include "ns3/abort.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SpatialGrid");
+
+std::size_t
+SpatialGrid::CellHash::operator()(const Cell& cell) const
+{
+    std::size_t hash = 0;
+    for (auto coordinate : cell)
+    {
+        hash = hash * 0x9e3779b97f4a7c15ULL + std::hash<int64_t>{}(coordinate);
+    }
+    return hash;
+}
+
+SpatialGrid::SpatialGrid()
+    : m_cellSize(100)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+SpatialGrid::~SpatialGrid()
+{
+    NS_LOG_FUNCTION(this);
+    Clear();
+}
+
+void
+SpatialGrid::SetCellSize(double size)
+{
+    NS_LOG_FUNCTION(this << size);
+    NS_ASSERT_MSG(size > 0, "The cells must have a positive size");
+    m_cellSize = size;
+    m_cells.clear();
+    m_moving.clear();
+    for (auto& [mobility, entry] : m_entries)
+    {
+        Insert(entry);
+    }
+}
+
+void
+SpatialGrid::Add(Ptr<MobilityModel> mobility, uint32_t id)
+{
+    NS_LOG_FUNCTION(this << mobility << id);
+    NS_ASSERT(mobility);
+    auto [it, inserted] = m_entries.try_emplace(PeekPointer(mobility));
+    it->second.ids.push_back(id);
+    NS_ABORT_MSG_IF(!m_ids.emplace(id, it).second, "Identifier " << id << " already registered");
+    if (inserted)
+    {
+        it->second.mobility = mobility;
+        Insert(it->second);
+        mobility->TraceConnectWithoutContext("CourseChange",
+                                             MakeCallback(&SpatialGrid::CourseChanged, this));
+    }
+}
+
+void
+SpatialGrid::Remove(uint32_t id)
+{
+    NS_LOG_FUNCTION(this << id);
+    auto idIt = m_ids.find(id);
+    if (idIt == m_ids.end())
+    {
+        return;
+    }
+    auto it = idIt->second;
+    m_ids.erase(idIt);
+    auto& ids = it->second.ids;
+    ids.erase(std::find(ids.begin(), ids.end(), id));
+    if (ids.empty())
+    {
+        Extract(it->second);
+        it->second.mobility->TraceDisconnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&SpatialGrid::CourseChanged, this));
+        m_entries.erase(it);
+    }
+}
+
+void
+SpatialGrid::Clear()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto& [mobility, entry] : m_entries)
+    {
+        entry.mobility->TraceDisconnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&SpatialGrid::CourseChanged, this));
+    }
+    m_entries.clear();
+    m_ids.clear();
+    m_cells.clear();
+    m_moving.clear();
+}
+
+void
+SpatialGrid::GetInRange(const Vector& position, double range, std::vector<uint32_t>& ids) const
+{
+    NS_LOG_FUNCTION(this << position << range);
+    ids.clear();
+
+    auto addIfInRange = [&](const Entry* entry, const Vector& entryPosition) {
+        if (CalculateDistance(position, entryPosition) <= range)
+        {
+            ids.insert(ids.end(), entry->ids.begin(), entry->ids.end());
+        }
+    };
+
+    for (const auto entry : m_moving)
+    {
+        addIfInRange(entry, entry->mobility->GetPosition());
+    }
+
+    auto center = GetCell(position);
+    auto span = static_cast<int64_t>(std::ceil(range / m_cellSize));
+    for (auto x = center[0] - span; x <= center[0] + span; x++)
+    {
+        for (auto y = center[1] - span; y <= center[1] + span; y++)
+        {
+            for (auto z = center[2] - span; z <= center[2] + span; z++)
+            {
+                if (auto it = m_cells.find({x, y, z}); it != m_cells.end())
+                {
+                    for (const auto entry : it->second)
+                    {
+                        addIfInRange(entry, entry->position);
+                    }
+                }
+            }
+        }
+    }
+
+    std::sort(ids.begin(), ids.end());
+}
+
+SpatialGrid::Cell
+SpatialGrid::GetCell(const Vector& position) const
+{
+    return {static_cast<int64_t>(std::floor(position.x / m_cellSize)),
+            static_cast<int64_t>(std::floor(position.y / m_cellSize)),
+            static_cast<int64_t>(std::floor(position.z / m_cellSize))};
+}
+
+void
+SpatialGrid::Insert(Entry& entry)
+{
+    entry.moving = (entry.mobility->GetVelocity() != Vector(0, 0, 0));
+    if (entry.moving)
+    {
+        m_moving.push_back(&entry);
+        return;
+    }
+    entry.position = entry.mobility->GetPosition();
+    entry.cell = GetCell(entry.position);
+    m_cells[entry.cell].push_back(&entry);
+}
+
+void
+SpatialGrid::Extract(const Entry& entry)
+{
+    if (entry.moving)
+    {
+        m_moving.erase(std::find(m_moving.begin(), m_moving.end(), &entry));
+        return;
+    }
+    auto it = m_cells.find(entry.cell);
+    NS_ASSERT(it != m_cells.end());
+    it->second.erase(std::find(it->second.begin(), it->second.end(), &entry));
+    if (it->second.empty())
+    {
+        m_cells.erase(it);
+    }
+}
+
+void
+SpatialGrid::CourseChanged(Ptr<const MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << mobility);
+    auto it = m_entries.find(PeekPointer(mobility));
+    NS_ASSERT(it != m_entries.end());
+    Extract(it->second);
+    Insert(it->second);
+}
+
+} // namespace ns3
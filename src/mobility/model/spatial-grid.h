@@ -0,0 +1,158 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include "mobility-model.h"
+
+#include "ns3/ptr.h"
+#include "ns3/vector.h"
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup mobility
+ *
+ * \brief Uniform grid of the positions of a set of mobility models, to find the
+ * models within range of a position without visiting all of them.
+ *
+ * Each model is registered with an identifier chosen by the user of the grid
+ * (e.g., the index of the PHY the model belongs to), and several identifiers
+ * may share the same model.  The grid follows the models through their
+ * CourseChange trace: a model at rest is stored in the cell containing its
+ * position, while a model with a non-zero velocity is kept aside and its
+ * distance is checked at every query, which is cheap compared to what the
+ * users of the grid save (e.g., computing a propagation loss and scheduling
+ * a reception).  Hence, the grid relies on the mobility models notifying a
+ * course change whenever they are moved or start moving, as all the ns-3
+ * models do, except for a ConstantAccelerationMobilityModel set at rest
+ * with a non-zero acceleration.
+ *
+ * With cells as large as the range of the queries, a query visits the 27
+ * cells around the position.
+ */
+class SpatialGrid
+{
+  public:
+    SpatialGrid();
+    ~SpatialGrid();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    SpatialGrid(const SpatialGrid&) = delete;
+    SpatialGrid& operator=(const SpatialGrid&) = delete;
+
+    /**
+     * Set the size of the cells, moving the models already registered to
+     * their new cells.
+     *
+     * \param size the size of the cells in meters, which must be positive
+     */
+    void SetCellSize(double size);
+
+    /**
+     * Register a mobility model.
+     *
+     * \param mobility the mobility model
+     * \param id the identifier the model is reported with, which must not be
+     *        registered already
+     */
+    void Add(Ptr<MobilityModel> mobility, uint32_t id);
+
+    /**
+     * Unregister the mobility model registered with the given identifier, if any.
+     *
+     * \param id the identifier
+     */
+    void Remove(uint32_t id);
+
+    /**
+     * Unregister all the mobility models.
+     */
+    void Clear();
+
+    /**
+     * Find the models within the given range of the given position.
+     *
+     * \param position the position
+     * \param range the range in meters
+     * \param [out] ids the identifiers of the models within range, in
+     *        increasing order
+     */
+    void GetInRange(const Vector& position, double range, std::vector<uint32_t>& ids) const;
+
+  private:
+    /// Coordinates of a cell
+    using Cell = std::array<int64_t, 3>;
+
+    /// Hash of the coordinates of a cell
+    struct CellHash
+    {
+        /**
+         * \param cell the coordinates of a cell
+         * \return the hash of the coordinates
+         */
+        std::size_t operator()(const Cell& cell) const;
+    };
+
+    /// A model registered with the grid
+    struct Entry
+    {
+        Ptr<MobilityModel> mobility; //!< The mobility model
+        std::vector<uint32_t> ids;   //!< Identifiers of the model
+        bool moving{false};          //!< Whether the model is kept out of the cells
+        Vector position;             //!< Position of the model, if at rest
+        Cell cell{};                 //!< Cell of the model, if at rest
+    };
+
+    /**
+     * \param position a position
+     * \return the cell containing the position
+     */
+    Cell GetCell(const Vector& position) const;
+
+    /**
+     * Store the given model in the cell of its position, or with the moving
+     * models if it has a non-zero velocity.
+     *
+     * \param entry the entry of the model
+     */
+    void Insert(Entry& entry);
+
+    /**
+     * Remove the given model from its cell or from the moving models.
+     *
+     * \param entry the entry of the model
+     */
+    void Extract(const Entry& entry);
+
+    /**
+     * Callback connected to the CourseChange trace of the registered models.
+     *
+     * \param mobility the mobility model that changed course
+     */
+    void CourseChanged(Ptr<const MobilityModel> mobility);
+
+    /// Registered models, by address of the model
+    using Entries = std::map<const MobilityModel*, Entry>;
+
+    double m_cellSize; //!< Size of the cells in meters
+    Entries m_entries; //!< Registered models
+    /// Registered models, by identifier
+    std::unordered_map<uint32_t, Entries::iterator> m_ids;
+    /// Models at rest in each non-empty cell
+    std::unordered_map<Cell, std::vector<const Entry*>, CellHash> m_cells;
+    std::vector<const Entry*> m_moving; //!< Models with a non-zero velocity
+};
+
+} // namespace ns3
+
+#endif /* SPATIAL_GRID_H */
@@ -0,0 +1,169 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/double.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+#include "ns3/spatial-grid.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup mobility-test
+ *
+ * \brief Check that the models found by a SpatialGrid are the models within
+ * range, as the models are moved, start moving and are removed.
+ */
+class SpatialGridTestCase : public TestCase
+{
+  public:
+    SpatialGridTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Compare the models found by the grid with the models found by visiting
+     * all of them, for queries around each model.
+     *
+     * \param range the range of the queries
+     */
+    void Check(double range);
+
+    SpatialGrid m_grid;                       //!< The grid
+    std::vector<Ptr<MobilityModel>> m_models; //!< The models, by identifier
+    std::vector<bool> m_registered;           //!< Whether each model is registered
+};
+
+SpatialGridTestCase::SpatialGridTestCase()
+    : TestCase("Check the models found within range by a SpatialGrid")
+{
+}
+
+void
+SpatialGridTestCase::Check(double range)
+{
+    std::vector<uint32_t> found;
+    for (const auto& model : m_models)
+    {
+        auto position = model->GetPosition();
+        m_grid.GetInRange(position, range, found);
+
+        std::vector<uint32_t> expected;
+        for (uint32_t id = 0; id < m_models.size(); id++)
+        {
+            if (m_registered[id] &&
+                CalculateDistance(position, m_models[id]->GetPosition()) <= range)
+            {
+                expected.push_back(id);
+            }
+        }
+        NS_TEST_ASSERT_MSG_EQ((found == expected),
+                              true,
+                              "Wrong models found around " << position << " at "
+                                                           << Simulator::Now().As(Time::S));
+    }
+}
+
+void
+SpatialGridTestCase::DoRun()
+{
+    auto coordinate = CreateObject<UniformRandomVariable>();
+    coordinate->SetStream(1);
+    coordinate->SetAttribute("Min", DoubleValue(-500));
+    coordinate->SetAttribute("Max", DoubleValue(500));
+
+    // static models, half of them with a second identifier sharing the model
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        auto model = CreateObject<ConstantPositionMobilityModel>();
+        model->SetPosition({coordinate->GetValue(), coordinate->GetValue(), 0});
+        m_models.push_back(model);
+    }
+    for (uint32_t i = 0; i < 50; i++)
+    {
+        m_models.push_back(m_models[i]);
+    }
+    // models starting at rest
+    for (uint32_t i = 0; i < 20; i++)
+    {
+        auto model = CreateObject<ConstantVelocityMobilityModel>();
+        model->SetPosition(
+            {coordinate->GetValue(), coordinate->GetValue(), coordinate->GetValue() / 10});
+        m_models.push_back(model);
+    }
+    m_registered.assign(m_models.size(), true);
+    for (uint32_t id = 0; id < m_models.size(); id++)
+    {
+        m_grid.Add(m_models[id], id);
+    }
+
+    m_grid.SetCellSize(150);
+    Check(150);
+    Check(400);
+
+    // move some static models and set some models in motion
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        m_models[i]->SetPosition({coordinate->GetValue(), coordinate->GetValue(), 0});
+    }
+    for (uint32_t i = 150; i < 160; i++)
+    {
+        DynamicCast<ConstantVelocityMobilityModel>(m_models[i])
+            ->SetVelocity({coordinate->GetValue() / 10, coordinate->GetValue() / 10, 0});
+    }
+    Check(150);
+    Simulator::Schedule(Seconds(5), &SpatialGridTestCase::Check, this, 150);
+
+    // stop the moving models, remove some identifiers and register one again
+    Simulator::Schedule(Seconds(6), [this]() {
+        for (uint32_t i = 150; i < 155; i++)
+        {
+            DynamicCast<ConstantVelocityMobilityModel>(m_models[i])->SetVelocity({0, 0, 0});
+        }
+        for (uint32_t id : {0, 1, 100, 120, 169})
+        {
+            m_grid.Remove(id);
+            m_registered[id] = false;
+        }
+        // identifiers not registered are ignored
+        m_grid.Remove(1000);
+        m_grid.Remove(0);
+        // register again an identifier sharing a model with a removed one
+        m_grid.Add(m_models[100], 100);
+        m_registered[100] = true;
+    });
+    Simulator::Schedule(Seconds(10), &SpatialGridTestCase::Check, this, 150);
+    Simulator::Schedule(Seconds(10), &SpatialGridTestCase::Check, this, 50);
+    Simulator::Run();
+
+    m_grid.Clear();
+    std::vector<uint32_t> found;
+    m_grid.GetInRange({0, 0, 0}, 1000, found);
+    NS_TEST_EXPECT_MSG_EQ(found.size(), 0, "The grid is not empty");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup mobility-test
+ *
+ * \brief SpatialGrid TestSuite
+ */
+class SpatialGridTestSuite : public TestSuite
+{
+  public:
+    SpatialGridTestSuite()
+        : TestSuite("spatial-grid", Type::UNIT)
+    {
+        AddTestCase(new SpatialGridTestCase(), TestCase::Duration::QUICK);
+    }
+};
+
+static SpatialGridTestSuite g_spatialGridTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "propagation-loss-cache.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PropagationLossCache");
+
+std::size_t
+PropagationLossCache::PathKeyHash::operator()(const PathKey& key) const
+{
+    auto hash = std::hash<const MobilityModel*>{}(std::get<0>(key));
+    hash = hash * 31 + std::hash<const MobilityModel*>{}(std::get<1>(key));
+    return hash * 31 + std::hash<uint64_t>{}(std::get<2>(key));
+}
+
+PropagationLossCache::PropagationLossCache()
+    : m_tolerance(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+PropagationLossCache::~PropagationLossCache()
+{
+    NS_LOG_FUNCTION(this);
+    Clear();
+}
+
+void
+PropagationLossCache::SetTolerance(double tolerance)
+{
+    NS_LOG_FUNCTION(this << tolerance);
+    NS_ASSERT_MSG(tolerance >= 0, "The tolerance cannot be negative");
+    m_tolerance = tolerance;
+}
+
+double
+PropagationLossCache::GetTolerance() const
+{
+    return m_tolerance;
+}
+
+double
+PropagationLossCache::CalcRxPower(Ptr<const PropagationLossModel> model,
+                                  double txPowerDbm,
+                                  Ptr<MobilityModel> a,
+                                  Ptr<MobilityModel> b,
+                                  uint64_t band)
+{
+    NS_LOG_FUNCTION(this << model << txPowerDbm << a << b << band);
+
+    const auto& nodeA = GetNode(a);
+    const auto& nodeB = GetNode(b);
+    auto [it, inserted] = m_paths.try_emplace({PeekPointer(a), PeekPointer(b), band});
+    auto& path = it->second;
+
+    if (!inserted && path.txPowerDbm == txPowerDbm)
+    {
+        if (path.aVersion == nodeA.version && path.bVersion == nodeB.version && !nodeA.moving &&
+            !nodeB.moving)
+        {
+            return path.rxPowerDbm;
+        }
+        if (CalculateDistance(a->GetPosition(), path.aPosition) <= m_tolerance &&
+            CalculateDistance(b->GetPosition(), path.bPosition) <= m_tolerance)
+        {
+            NS_LOG_LOGIC("Nodes moved within the tolerance");
+            path.aVersion = nodeA.version;
+            path.bVersion = nodeB.version;
+            return path.rxPowerDbm;
+        }
+    }
+
+    path.txPowerDbm = txPowerDbm;
+    path.rxPowerDbm = model->CalcRxPower(txPowerDbm, a, b);
+    path.aVersion = nodeA.version;
+    path.bVersion = nodeB.version;
+    path.aPosition = a->GetPosition();
+    path.bPosition = b->GetPosition();
+    NS_LOG_LOGIC("Computed reception power " << path.rxPowerDbm << " dBm");
+    return path.rxPowerDbm;
+}
+
+void
+PropagationLossCache::Clear()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto& [mobility, node] : m_nodes)
+    {
+        node.mobility->TraceDisconnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&PropagationLossCache::CourseChanged, this));
+    }
+    m_nodes.clear();
+    m_paths.clear();
+}
+
+PropagationLossCache::Node&
+PropagationLossCache::GetNode(Ptr<MobilityModel> mobility)
+{
+    auto [it, inserted] = m_nodes.try_emplace(PeekPointer(mobility));
+    if (inserted)
+    {
+        it->second.mobility = mobility;
+        it->second.moving = (mobility->GetVelocity() != Vector(0, 0, 0));
+        mobility->TraceConnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&PropagationLossCache::CourseChanged, this));
+    }
+    return it->second;
+}
+
+void
+PropagationLossCache::CourseChanged(Ptr<const MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << mobility);
+    auto it = m_nodes.find(PeekPointer(mobility));
+    NS_ASSERT(it != m_nodes.end());
+    it->second.version++;
+    it->second.moving = (mobility->GetVelocity() != Vector(0, 0, 0));
+}
+
+} // namespace ns3
@@ -0,0 +1,142 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef PROPAGATION_LOSS_CACHE_H
+#define PROPAGATION_LOSS_CACHE_H
+
+#include "propagation-loss-model.h"
+
+#include "ns3/mobility-model.h"
+#include "ns3/vector.h"
+
+#include <tuple>
+#include <unordered_map>
+
+namespace ns3
+{
+
+/**
+ * \ingroup propagation
+ *
+ * \brief Cache of the reception powers computed by a PropagationLossModel
+ * for each pair of nodes, invalidated when the nodes move.
+ *
+ * A path is identified by the mobility models of the transmitter and of the
+ * receiver, in this order, and by an identifier of the frequency band chosen
+ * by the user of the cache (e.g., a center frequency or a SpectrumModel UID).
+ * The reception power of a path is computed again when the transmission
+ * power changes or when either node has moved by more than the tolerance
+ * since the power was computed.  The cache follows the mobility models
+ * through their CourseChange trace, so that the positions of the nodes at
+ * rest are not queried until they are notified to have moved.
+ *
+ * The cache is meant for simulations of static or slowly moving nodes with
+ * deterministic loss models, or loss models whose random components are
+ * drawn once per path (e.g., the shadowing of the 3GPP models), as the
+ * power computed for a path is reused as is.  Models drawing a new value
+ * for each signal (e.g., NakagamiPropagationLossModel or
+ * JakesPropagationLossModel) and channel conditions updated over time are
+ * frozen by the cache.
+ */
+class PropagationLossCache
+{
+  public:
+    PropagationLossCache();
+    ~PropagationLossCache();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    PropagationLossCache(const PropagationLossCache&) = delete;
+    PropagationLossCache& operator=(const PropagationLossCache&) = delete;
+
+    /**
+     * \param tolerance the distance in meters a node can move by before the
+     *        reception powers of its paths are computed again
+     */
+    void SetTolerance(double tolerance);
+
+    /**
+     * \return the distance in meters a node can move by before the reception
+     *         powers of its paths are computed again
+     */
+    double GetTolerance() const;
+
+    /**
+     * Get the reception power of the given path from the cache, computing it
+     * with the given loss model if it is not cached or is stale.
+     *
+     * \param model the propagation loss model
+     * \param txPowerDbm the transmission power in dBm
+     * \param a the mobility model of the source
+     * \param b the mobility model of the destination
+     * \param band the identifier of the frequency band
+     * \return the reception power in dBm
+     */
+    double CalcRxPower(Ptr<const PropagationLossModel> model,
+                       double txPowerDbm,
+                       Ptr<MobilityModel> a,
+                       Ptr<MobilityModel> b,
+                       uint64_t band);
+
+    /**
+     * Remove all the paths from the cache, e.g., because the loss model changed.
+     */
+    void Clear();
+
+  private:
+    /// A node the cache follows the course changes of
+    struct Node
+    {
+        Ptr<MobilityModel> mobility; //!< The mobility model of the node
+        uint32_t version{0};         //!< Number of course changes of the node
+        bool moving{false};          //!< Whether the node has a non-zero velocity
+    };
+
+    /// A path cached
+    struct Path
+    {
+        double txPowerDbm{0}; //!< Transmission power the reception power was computed for
+        double rxPowerDbm{0}; //!< Reception power
+        uint32_t aVersion{0}; //!< Version of the source when the path was last validated
+        uint32_t bVersion{0}; //!< Version of the destination when the path was last validated
+        Vector aPosition;     //!< Position of the source when the power was computed
+        Vector bPosition;     //!< Position of the destination when the power was computed
+    };
+
+    /// Identifier of a path
+    using PathKey = std::tuple<const MobilityModel*, const MobilityModel*, uint64_t>;
+
+    /// Hash of the identifier of a path
+    struct PathKeyHash
+    {
+        /**
+         * \param key the identifier of a path
+         * \return the hash of the identifier
+         */
+        std::size_t operator()(const PathKey& key) const;
+    };
+
+    /**
+     * Get the node of the given mobility model, following its course changes
+     * the first time it is seen.
+     *
+     * \param mobility the mobility model
+     * \return the node
+     */
+    Node& GetNode(Ptr<MobilityModel> mobility);
+
+    /**
+     * Callback connected to the CourseChange trace of the nodes.
+     *
+     * \param mobility the mobility model that changed course
+     */
+    void CourseChanged(Ptr<const MobilityModel> mobility);
+
+    double m_tolerance;                                      //!< Tolerance in meters
+    std::unordered_map<const MobilityModel*, Node> m_nodes; //!< Nodes followed
+    std::unordered_map<PathKey, Path, PathKeyHash> m_paths;  //!< Paths cached
+};
+
+} // namespace ns3
+
+#endif /* PROPAGATION_LOSS_CACHE_H */
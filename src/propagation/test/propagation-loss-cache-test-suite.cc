@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/propagation-loss-cache.h"
+#include "ns3/propagation-loss-model.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief Propagation loss model counting its computations, with a loss of
+ * one dB per meter.
+ */
+class CountingPropagationLossModel : public PropagationLossModel
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    mutable uint32_t m_nComputations{0}; //!< Number of losses computed
+
+  private:
+    double DoCalcRxPower(double txPowerDbm,
+                         Ptr<MobilityModel> a,
+                         Ptr<MobilityModel> b) const override;
+    int64_t DoAssignStreams(int64_t stream) override;
+};
+
+TypeId
+CountingPropagationLossModel::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::CountingPropagationLossModel")
+                            .SetParent<PropagationLossModel>()
+                            .SetGroupName("Propagation")
+                            .AddConstructor<CountingPropagationLossModel>();
+    return tid;
+}
+
+double
+CountingPropagationLossModel::DoCalcRxPower(double txPowerDbm,
+                                            Ptr<MobilityModel> a,
+                                            Ptr<MobilityModel> b) const
+{
+    m_nComputations++;
+    return txPowerDbm - a->GetDistanceFrom(b);
+}
+
+int64_t
+CountingPropagationLossModel::DoAssignStreams(int64_t stream)
+{
+    return 0;
+}
+
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief Check that the PropagationLossCache reuses the reception powers of
+ * the paths until the nodes move or the transmission power changes.
+ */
+class PropagationLossCacheTestCase : public TestCase
+{
+  public:
+    PropagationLossCacheTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Get the reception power of a path through the cache and check it and
+     * whether it was computed.
+     *
+     * \param txPowerDbm the transmission power in dBm
+     * \param a the mobility model of the source
+     * \param b the mobility model of the destination
+     * \param band the identifier of the frequency band
+     * \param rxPowerDbm the expected reception power in dBm
+     * \param computed whether the reception power is expected to be computed
+     */
+    void Check(double txPowerDbm,
+               Ptr<MobilityModel> a,
+               Ptr<MobilityModel> b,
+               uint64_t band,
+               double rxPowerDbm,
+               bool computed);
+
+    PropagationLossCache m_cache;              //!< The cache
+    Ptr<CountingPropagationLossModel> m_model; //!< The loss model
+};
+
+PropagationLossCacheTestCase::PropagationLossCacheTestCase()
+    : TestCase("Check the reuse and the invalidation of the paths of a PropagationLossCache")
+{
+}
+
+void
+PropagationLossCacheTestCase::Check(double txPowerDbm,
+                                    Ptr<MobilityModel> a,
+                                    Ptr<MobilityModel> b,
+                                    uint64_t band,
+                                    double rxPowerDbm,
+                                    bool computed)
+{
+    auto nComputations = m_model->m_nComputations;
+    auto rxPower = m_cache.CalcRxPower(m_model, txPowerDbm, a, b, band);
+    NS_TEST_EXPECT_MSG_EQ_TOL(rxPower,
+                              rxPowerDbm,
+                              1e-9,
+                              "Wrong reception power at " << Simulator::Now().As(Time::S));
+    NS_TEST_EXPECT_MSG_EQ((m_model->m_nComputations > nComputations),
+                          computed,
+                          "Unexpected computation at " << Simulator::Now().As(Time::S));
+}
+
+void
+PropagationLossCacheTestCase::DoRun()
+{
+    m_model = CreateObject<CountingPropagationLossModel>();
+
+    Ptr<MobilityModel> a = CreateObject<ConstantPositionMobilityModel>();
+    Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel>();
+    auto c = CreateObject<ConstantVelocityMobilityModel>();
+    a->SetPosition({0, 0, 0});
+    b->SetPosition({10, 0, 0});
+    c->SetPosition({0, 20, 0});
+
+    // each path, band and transmission power is computed once
+    Check(20, a, b, 0, 10, true);
+    Check(20, a, b, 0, 10, false);
+    Check(20, b, a, 0, 10, true);
+    Check(20, a, b, 1, 10, true);
+    Check(15, a, b, 0, 5, true);
+    Check(15, a, b, 0, 5, false);
+    Check(20, a, c, 0, 0, true);
+    Check(20, a, c, 0, 0, false);
+
+    // moving a node invalidates its paths, unlike a course change in place
+    b->SetPosition({15, 0, 0});
+    Check(15, a, b, 0, 0, true);
+    Check(20, a, c, 0, 0, false);
+    b->SetPosition({15, 0, 0});
+    Check(15, a, b, 0, 0, false);
+
+    // within the tolerance, the paths are reused
+    m_cache.SetTolerance(1);
+    b->SetPosition({15.5, 0, 0});
+    Check(15, a, b, 0, 0, false);
+    b->SetPosition({16.5, 0, 0});
+    Check(15, a, b, 0, -1.5, true);
+
+    // the position of a moving node is checked at each use of its paths
+    c->SetVelocity({0, 1, 0});
+    Simulator::Schedule(Seconds(0.5), [=, this]() { Check(20, a, c, 0, 0, false); });
+    Simulator::Schedule(Seconds(2), [=, this]() { Check(20, a, c, 0, -2, true); });
+    Simulator::Run();
+
+    m_cache.Clear();
+    Check(15, a, b, 0, -1.5, true);
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief PropagationLossCache TestSuite
+ */
+class PropagationLossCacheTestSuite : public TestSuite
+{
+  public:
+    PropagationLossCacheTestSuite();
+};
+
+PropagationLossCacheTestSuite::PropagationLossCacheTestSuite()
+    : TestSuite("propagation-loss-cache", Type::UNIT)
+{
+    AddTestCase(new PropagationLossCacheTestCase, TestCase::Duration::QUICK);
+}
+
+/// Static variable for test initialization
+static PropagationLossCacheTestSuite g_propagationLossCacheTestSuite;
@@ -70,7 +70,8 @@ RxSpectrumModelInfo::RxSpectrumModelInfo(Ptr<const SpectrumModel> rxSpectrumMode
 }
 
 MultiModelSpectrumChannel::MultiModelSpectrumChannel()
-    : m_numDevices{0}
+    : m_numDevices{0},
+      m_maxRange{0}
 {
     NS_LOG_FUNCTION(this);
 }
@@ -81,18 +82,30 @@ MultiModelSpectrumChannel::DoDispose()
     NS_LOG_FUNCTION(this);
     m_txSpectrumModelInfoMap.clear();
     m_rxSpectrumModelInfoMap.clear();
+    m_grid.Clear();
+    m_indexedPhys.clear();
+    m_indexedUids.clear();
+    m_unindexed.clear();
     SpectrumChannel::DoDispose();
 }
 
 TypeId
 MultiModelSpectrumChannel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::MultiModelSpectrumChannel")
-                            .SetParent<SpectrumChannel>()
-                            .SetGroupName("Spectrum")
-                            .AddConstructor<MultiModelSpectrumChannel>()
-
-        ;
+    static TypeId tid =
+        TypeId("ns3::MultiModelSpectrumChannel")
+            .SetParent<SpectrumChannel>()
+            .SetGroupName("Spectrum")
+            .AddConstructor<MultiModelSpectrumChannel>()
+            .AddAttribute("MaxRange",
+                          "The maximum distance in meters between a transmitter and the PHYs "
+                          "its signals are passed to, or 0 for no limit. The PHYs in range are "
+                          "found through a spatial index of their positions, instead of "
+                          "visiting all the PHYs attached to this channel.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&MultiModelSpectrumChannel::SetMaxRange,
+                                             &MultiModelSpectrumChannel::GetMaxRange),
+                          MakeDoubleChecker<double>(0));
     return tid;
 }
 
@@ -119,6 +132,16 @@ MultiModelSpectrumChannel::RemoveRx(Ptr<SpectrumPhy> phy)
             break; // there should be at most one entry
         }
     }
+
+    if (auto it = std::find(m_indexedPhys.begin(), m_indexedPhys.end(), phy);
+        it != m_indexedPhys.end())
+    {
+        uint32_t id = it - m_indexedPhys.begin();
+        *it = nullptr;
+        m_grid.Remove(id);
+        m_unindexed.erase(std::remove(m_unindexed.begin(), m_unindexed.end(), id),
+                          m_unindexed.end());
+    }
 }
 
 void
@@ -145,6 +168,19 @@ MultiModelSpectrumChannel::AddRx(Ptr<SpectrumPhy> phy)
     // prevented insertion. In both cases, add the phy to the element pointed to by rxInfoIterator
     rxInfoIterator->second.m_rxPhys.push_back(phy);
 
+    // the PHY is added to m_grid at the next transmission, as its mobility
+    // model may not be known yet; the identifiers of the removed PHYs are reused
+    auto slot = std::find(m_indexedPhys.begin(), m_indexedPhys.end(), nullptr);
+    if (slot == m_indexedPhys.end())
+    {
+        slot = m_indexedPhys.insert(slot, phy);
+        m_indexedUids.push_back(rxSpectrumModelUid);
+    }
+    *slot = phy;
+    const uint32_t id = slot - m_indexedPhys.begin();
+    m_indexedUids[id] = rxSpectrumModelUid;
+    m_unindexed.push_back(id);
+
     if (inserted)
     {
         // create the necessary converters for all the TX spectrum models that we know of
@@ -229,6 +265,31 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
     auto txSpectrumModelUid = txParams->psd->GetSpectrumModelUid();
     NS_LOG_LOGIC("txSpectrumModelUid " << txSpectrumModelUid);
 
+    if (m_maxRange > 0 && txMobility)
+    {
+        for (auto it = m_unindexed.begin(); it != m_unindexed.end();)
+        {
+            if (auto mobility = m_indexedPhys[*it]->GetMobility())
+            {
+                m_grid.Add(mobility, *it);
+                it = m_unindexed.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        // the PHYs without a mobility model are not subject to the range
+        m_grid.GetInRange(txMobility->GetPosition(), m_maxRange, m_inRange);
+        m_inRange.insert(m_inRange.end(), m_unindexed.begin(), m_unindexed.end());
+        std::sort(m_inRange.begin(), m_inRange.end());
+        for (auto index : m_inRange)
+        {
+            ScheduleRx(txParams, m_indexedPhys[index], m_indexedUids[index]);
+        }
+        return;
+    }
+
     for (auto rxInfoIterator = m_rxSpectrumModelInfoMap.begin();
          rxInfoIterator != m_rxSpectrumModelInfoMap.end();
          ++rxInfoIterator)
@@ -240,122 +301,129 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
              rxPhyIterator != rxInfoIterator->second.m_rxPhys.end();
              ++rxPhyIterator)
         {
-            NS_ASSERT_MSG((*rxPhyIterator)->GetRxSpectrumModel()->GetUid() == rxSpectrumModelUid,
-                          "SpectrumModel change was not notified to MultiModelSpectrumChannel "
-                          "(i.e., AddRx should be called again after model is changed)");
+            ScheduleRx(txParams, *rxPhyIterator, rxSpectrumModelUid);
+        }
+    }
+}
+
+void
+MultiModelSpectrumChannel::ScheduleRx(Ptr<SpectrumSignalParameters> txParams,
+                                      Ptr<SpectrumPhy> rxPhy,
+                                      SpectrumModelUid_t rxSpectrumModelUid)
+{
+    NS_ASSERT_MSG(rxPhy->GetRxSpectrumModel()->GetUid() == rxSpectrumModelUid,
+                  "SpectrumModel change was not notified to MultiModelSpectrumChannel "
+                  "(i.e., AddRx should be called again after model is changed)");
+
+    if (rxPhy == txParams->txPhy)
+    {
+        return;
+    }
+
+    auto txMobility = txParams->txPhy->GetMobility();
+    auto rxNetDevice = rxPhy->GetDevice();
+    auto txNetDevice = txParams->txPhy->GetDevice();
+
+    if (rxNetDevice && txNetDevice)
+    {
+        // we assume that devices are attached to a node
+        if (rxNetDevice->GetNode()->GetId() == txNetDevice->GetNode()->GetId())
+        {
+            NS_LOG_DEBUG("Skipping the pathloss calculation among different antennas of the "
+                         "same node, not supported yet by any pathloss model in ns-3.");
+            return;
+        }
+    }
 
-            if ((*rxPhyIterator) != txParams->txPhy)
+    if (m_filter && m_filter->Filter(txParams, rxPhy))
+    {
+        return;
+    }
+
+    NS_LOG_LOGIC("copying signal parameters " << txParams);
+    auto rxParams = txParams->Copy();
+    rxParams->psd = Copy<SpectrumValue>(txParams->psd);
+    Time delay{0};
+
+    auto receiverMobility = rxPhy->GetMobility();
+
+    if (txMobility && receiverMobility)
+    {
+        auto txAntennaGain{0.0};
+        auto rxAntennaGain{0.0};
+        auto propagationGainDb{0.0};
+        auto pathLossDb{0.0};
+        if (rxParams->txAntenna)
+        {
+            Angles txAngles(receiverMobility->GetPosition(), txMobility->GetPosition());
+            txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
+            NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
+            pathLossDb -= txAntennaGain;
+        }
+        auto rxAntenna = DynamicCast<AntennaModel>(rxPhy->GetAntenna());
+        if (rxAntenna)
+        {
+            Angles rxAngles(txMobility->GetPosition(), receiverMobility->GetPosition());
+            rxAntennaGain = rxAntenna->GetGainDb(rxAngles);
+            NS_LOG_LOGIC("rxAntennaGain = " << rxAntennaGain << " dB");
+            pathLossDb -= rxAntennaGain;
+        }
+        if (m_propagationLoss)
+        {
+            if (txMobility->GetPosition() == receiverMobility->GetPosition())
+            {
+                propagationGainDb = 0; // Assume no propagation loss when co-located
+            }
+            else
             {
-                auto rxNetDevice = (*rxPhyIterator)->GetDevice();
-                auto txNetDevice = txParams->txPhy->GetDevice();
-
-                if (rxNetDevice && txNetDevice)
-                {
-                    // we assume that devices are attached to a node
-                    if (rxNetDevice->GetNode()->GetId() == txNetDevice->GetNode()->GetId())
-                    {
-                        NS_LOG_DEBUG(
-                            "Skipping the pathloss calculation among different antennas of the "
-                            "same node, not supported yet by any pathloss model in ns-3.");
-                        continue;
-                    }
-                }
-
-                if (m_filter && m_filter->Filter(txParams, *rxPhyIterator))
-                {
-                    continue;
-                }
-
-                NS_LOG_LOGIC("copying signal parameters " << txParams);
-                auto rxParams = txParams->Copy();
-                rxParams->psd = Copy<SpectrumValue>(txParams->psd);
-                Time delay{0};
-
-                auto receiverMobility = (*rxPhyIterator)->GetMobility();
-
-                if (txMobility && receiverMobility)
-                {
-                    auto txAntennaGain{0.0};
-                    auto rxAntennaGain{0.0};
-                    auto propagationGainDb{0.0};
-                    auto pathLossDb{0.0};
-                    if (rxParams->txAntenna)
-                    {
-                        Angles txAngles(receiverMobility->GetPosition(), txMobility->GetPosition());
-                        txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
-                        NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
-                        pathLossDb -= txAntennaGain;
-                    }
-                    auto rxAntenna = DynamicCast<AntennaModel>((*rxPhyIterator)->GetAntenna());
-                    if (rxAntenna)
-                    {
-                        Angles rxAngles(txMobility->GetPosition(), receiverMobility->GetPosition());
-                        rxAntennaGain = rxAntenna->GetGainDb(rxAngles);
-                        NS_LOG_LOGIC("rxAntennaGain = " << rxAntennaGain << " dB");
-                        pathLossDb -= rxAntennaGain;
-                    }
-                    if (m_propagationLoss)
-                    {
-                        if (txMobility->GetPosition() == receiverMobility->GetPosition())
-                        {
-                            propagationGainDb = 0; // Assume no propagation loss when co-located
-                        }
-                        else
-                        {
-                            propagationGainDb =
-                                m_propagationLoss->CalcRxPower(0, txMobility, receiverMobility);
-                        }
-                        NS_LOG_LOGIC("propagationGainDb = " << propagationGainDb << " dB");
-                        pathLossDb -= propagationGainDb;
-                    }
-                    NS_LOG_LOGIC("total pathLoss = " << pathLossDb << " dB");
-                    // Gain trace
-                    m_gainTrace(txMobility,
-                                receiverMobility,
-                                txAntennaGain,
-                                rxAntennaGain,
-                                propagationGainDb,
-                                pathLossDb);
-                    // Pathloss trace
-                    m_pathLossTrace(txParams->txPhy, *rxPhyIterator, pathLossDb);
-                    if (pathLossDb > m_maxLossDb)
-                    {
-                        // beyond range
-                        continue;
-                    }
-                    auto pathGainLinear = std::pow(10.0, (-pathLossDb) / 10.0);
-                    *(rxParams->psd) *= pathGainLinear;
-
-                    if (m_propagationDelay)
-                    {
-                        delay = m_propagationDelay->GetDelay(txMobility, receiverMobility);
-                    }
-                }
-
-                if (rxNetDevice)
-                {
-                    // the receiver has a NetDevice, so we expect that it is attached to a Node
-                    auto dstNode = rxNetDevice->GetNode()->GetId();
-                    Simulator::ScheduleWithContext(dstNode,
-                                                   delay,
-                                                   &MultiModelSpectrumChannel::StartRx,
-                                                   this,
-                                                   rxParams,
-                                                   *rxPhyIterator);
-                }
-                else
-                {
-                    // the receiver is not attached to a NetDevice, so we cannot assume that it is
-                    // attached to a node
-                    Simulator::Schedule(delay,
-                                        &MultiModelSpectrumChannel::StartRx,
-                                        this,
-                                        rxParams,
-                                        *rxPhyIterator);
-                }
+                propagationGainDb = CalcPropagationGainDb(txMobility,
+                                                          receiverMobility,
+                                                          txParams->psd->GetSpectrumModelUid());
             }
+            NS_LOG_LOGIC("propagationGainDb = " << propagationGainDb << " dB");
+            pathLossDb -= propagationGainDb;
+        }
+        NS_LOG_LOGIC("total pathLoss = " << pathLossDb << " dB");
+        // Gain trace
+        m_gainTrace(txMobility,
+                    receiverMobility,
+                    txAntennaGain,
+                    rxAntennaGain,
+                    propagationGainDb,
+                    pathLossDb);
+        // Pathloss trace
+        m_pathLossTrace(txParams->txPhy, rxPhy, pathLossDb);
+        if (pathLossDb > m_maxLossDb)
+        {
+            // beyond range
+            return;
+        }
+        auto pathGainLinear = std::pow(10.0, (-pathLossDb) / 10.0);
+        *(rxParams->psd) *= pathGainLinear;
+
+        if (m_propagationDelay)
+        {
+            delay = m_propagationDelay->GetDelay(txMobility, receiverMobility);
         }
     }
+
+    if (rxNetDevice)
+    {
+        // the receiver has a NetDevice, so we expect that it is attached to a Node
+        auto dstNode = rxNetDevice->GetNode()->GetId();
+        Simulator::ScheduleWithContext(dstNode,
+                                       delay,
+                                       &MultiModelSpectrumChannel::StartRx,
+                                       this,
+                                       rxParams,
+                                       rxPhy);
+    }
+    else
+    {
+        // the receiver is not attached to a NetDevice, so we cannot assume that it is
+        // attached to a node
+        Simulator::Schedule(delay, &MultiModelSpectrumChannel::StartRx, this, rxParams, rxPhy);
+    }
 }
 
 void
@@ -422,6 +490,23 @@ MultiModelSpectrumChannel::StartRx(Ptr<SpectrumSignalParameters> params, Ptr<Spe
     receiver->StartRx(params);
 }
 
+void
+MultiModelSpectrumChannel::SetMaxRange(double range)
+{
+    NS_LOG_FUNCTION(this << range);
+    m_maxRange = range;
+    if (m_maxRange > 0)
+    {
+        m_grid.SetCellSize(m_maxRange);
+    }
+}
+
+double
+MultiModelSpectrumChannel::GetMaxRange() const
+{
+    return m_maxRange;
+}
+
 std::size_t
 MultiModelSpectrumChannel::GetNDevices() const
 {
@@ -15,6 +15,7 @@
 #include "spectrum-value.h"
 
 #include <ns3/propagation-delay-model.h>
+#include <ns3/spatial-grid.h>
 
 #include <map>
 #include <set>
@@ -88,6 +89,12 @@ typedef std::map<SpectrumModelUid_t, RxSpectrumModelInfo> RxSpectrumModelInfoMap
  * for this to work is that, after the SpectrumPhy switched its
  * SpectrumModel,  MultiModelSpectrumChannel::AddRx () is
  * called again passing the pointer to that SpectrumPhy.
+ *
+ * If the MaxRange attribute is set, a signal is only passed to the PHYs
+ * within that distance of the transmitter (and to the PHYs without a
+ * mobility model), which are found through a SpatialGrid of the positions
+ * of the PHYs, so that the cost of a transmission depends on the number of
+ * PHYs in range rather than on the number of PHYs attached to the channel.
  */
 class MultiModelSpectrumChannel : public SpectrumChannel
 {
@@ -109,6 +116,17 @@ class MultiModelSpectrumChannel : public SpectrumChannel
     std::size_t GetNDevices() const override;
     Ptr<NetDevice> GetDevice(std::size_t i) const override;
 
+    /**
+     * \param range the maximum distance in meters between a transmitter and
+     *        the PHYs its signals are passed to, or 0 for no limit
+     */
+    void SetMaxRange(double range);
+    /**
+     * \return the maximum distance in meters between a transmitter and the
+     *         PHYs its signals are passed to, or 0 for no limit
+     */
+    double GetMaxRange() const;
+
   protected:
     void DoDispose() override;
 
@@ -134,6 +152,19 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      */
     virtual void StartRx(Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
 
+    /**
+     * Apply the propagation loss and the antenna gains between the transmitter
+     * and the given PHY and, unless the PHY is out of range, schedule the
+     * reception of the signal after the propagation delay.
+     *
+     * \param txParams The signal parameters.
+     * \param rxPhy A pointer to the receiver SpectrumPhy.
+     * \param rxSpectrumModelUid The UID of the RX spectrum model the PHY was added with.
+     */
+    void ScheduleRx(Ptr<SpectrumSignalParameters> txParams,
+                    Ptr<SpectrumPhy> rxPhy,
+                    SpectrumModelUid_t rxSpectrumModelUid);
+
     /**
      * Data structure holding, for each TX SpectrumModel,  all the
      * converters to any RX SpectrumModel, and all the corresponding
@@ -152,6 +183,14 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      * Number of devices connected to the channel.
      */
     std::size_t m_numDevices;
+
+    double m_maxRange;                           //!< Maximum distance to the receivers, or 0
+    std::vector<Ptr<SpectrumPhy>> m_indexedPhys; //!< PHYs by identifier, null if removed
+    /// UIDs of the RX spectrum models the PHYs were added with, by identifier
+    std::vector<SpectrumModelUid_t> m_indexedUids;
+    SpatialGrid m_grid;                          //!< Positions of the PHYs
+    std::vector<uint32_t> m_unindexed;           //!< Identifiers of the PHYs not in m_grid yet
+    std::vector<uint32_t> m_inRange;             //!< Identifiers of the PHYs in range
 };
 
 } // namespace ns3
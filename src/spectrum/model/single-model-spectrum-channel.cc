@@ -167,7 +167,9 @@ SingleModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                 if (m_propagationLoss)
                 {
                     propagationGainDb =
-                        m_propagationLoss->CalcRxPower(0, senderMobility, receiverMobility);
+                        CalcPropagationGainDb(senderMobility,
+                                              receiverMobility,
+                                              txParams->psd->GetSpectrumModelUid());
                     NS_LOG_LOGIC("propagationGainDb = " << propagationGainDb << " dB");
                     pathLossDb -= propagationGainDb;
                 }
@@ -9,6 +9,7 @@
 #include "spectrum-channel.h"
 
 #include <ns3/abort.h>
+#include <ns3/boolean.h>
 #include <ns3/double.h>
 #include <ns3/log.h>
 #include <ns3/pointer.h>
@@ -21,6 +22,7 @@ NS_LOG_COMPONENT_DEFINE("SpectrumChannel");
 NS_OBJECT_ENSURE_REGISTERED(SpectrumChannel);
 
 SpectrumChannel::SpectrumChannel()
+    : m_lossCacheEnabled(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -34,6 +36,7 @@ SpectrumChannel::DoDispose()
 {
     NS_LOG_FUNCTION(this);
     m_propagationLoss = nullptr;
+    m_lossCache.Clear();
     m_propagationDelay = nullptr;
     m_spectrumPropagationLoss = nullptr;
 }
@@ -66,6 +69,25 @@ SpectrumChannel::GetTypeId()
                           MakePointerAccessor(&SpectrumChannel::m_propagationLoss),
                           MakePointerChecker<PropagationLossModel>())
 
+            .AddAttribute("LossCache",
+                          "Whether to compute the gain of the single-frequency "
+                          "PropagationLossModel between each pair of nodes once and "
+                          "reuse it until either node moves. This suits static "
+                          "topologies with deterministic propagation loss models, as "
+                          "the losses drawn for each signal (e.g., Nakagami fading) "
+                          "are reused too.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&SpectrumChannel::m_lossCacheEnabled),
+                          MakeBooleanChecker())
+
+            .AddAttribute("LossCacheTolerance",
+                          "The distance in meters a node can move by before the "
+                          "cached gains of its paths are computed again.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&SpectrumChannel::SetLossCacheTolerance,
+                                             &SpectrumChannel::GetLossCacheTolerance),
+                          MakeDoubleChecker<double>(0))
+
             .AddTraceSource("Gain",
                             "This trace is fired whenever a new path loss value "
                             "is calculated. The parameters to this trace are : "
@@ -111,6 +133,7 @@ SpectrumChannel::AddPropagationLossModel(Ptr<PropagationLossModel> loss)
         loss->SetNext(m_propagationLoss);
     }
     m_propagationLoss = loss;
+    m_lossCache.Clear();
 }
 
 void
@@ -185,6 +208,35 @@ SpectrumChannel::GetPropagationDelayModel() const
     return m_propagationDelay;
 }
 
+double
+SpectrumChannel::CalcPropagationGainDb(Ptr<MobilityModel> txMobility,
+                                       Ptr<MobilityModel> rxMobility,
+                                       SpectrumModelUid_t txSpectrumModelUid)
+{
+    if (m_lossCacheEnabled)
+    {
+        return m_lossCache.CalcRxPower(m_propagationLoss,
+                                       0,
+                                       txMobility,
+                                       rxMobility,
+                                       txSpectrumModelUid);
+    }
+    return m_propagationLoss->CalcRxPower(0, txMobility, rxMobility);
+}
+
+void
+SpectrumChannel::SetLossCacheTolerance(double tolerance)
+{
+    NS_LOG_FUNCTION(this << tolerance);
+    m_lossCache.SetTolerance(tolerance);
+}
+
+double
+SpectrumChannel::GetLossCacheTolerance() const
+{
+    return m_lossCache.GetTolerance();
+}
+
 int64_t
 SpectrumChannel::AssignStreams(int64_t stream)
 {
@@ -194,6 +246,8 @@ SpectrumChannel::AssignStreams(int64_t stream)
     if (m_propagationLoss)
     {
         currentStream += m_propagationLoss->AssignStreams(currentStream);
+        // the cached losses may have been drawn from the previous streams
+        m_lossCache.Clear();
     }
     if (currentStream - lastCurrentStream)
     {
@@ -20,6 +20,7 @@
 #include <ns3/nstime.h>
 #include <ns3/object.h>
 #include <ns3/propagation-delay-model.h>
+#include <ns3/propagation-loss-cache.h>
 #include <ns3/propagation-loss-model.h>
 #include <ns3/traced-callback.h>
 
@@ -227,6 +228,19 @@ class SpectrumChannel : public Channel
      */
     virtual int64_t DoAssignStreams(int64_t stream);
 
+    /**
+     * Get the gain of the single-frequency propagation loss model between the
+     * given nodes, from the cache of the gains if the LossCache attribute is set.
+     *
+     * \param txMobility the mobility model of the transmitter
+     * \param rxMobility the mobility model of the receiver
+     * \param txSpectrumModelUid the UID of the SpectrumModel of the signal
+     * \return the propagation gain in dB
+     */
+    double CalcPropagationGainDb(Ptr<MobilityModel> txMobility,
+                                 Ptr<MobilityModel> rxMobility,
+                                 SpectrumModelUid_t txSpectrumModelUid);
+
     /**
      * The `PathLoss` trace source. Exporting the pointers to the Tx and Rx
      * SpectrumPhy and a pathloss value, in dB.
@@ -282,6 +296,21 @@ class SpectrumChannel : public Channel
      * Transmit filter to be used with this channel
      */
     Ptr<SpectrumTransmitFilter> m_filter{nullptr};
+
+  private:
+    /**
+     * \param tolerance the distance in meters a node can move by before the
+     *        cached gains of its paths are computed again
+     */
+    void SetLossCacheTolerance(double tolerance);
+    /**
+     * \return the distance in meters a node can move by before the cached
+     *         gains of its paths are computed again
+     */
+    double GetLossCacheTolerance() const;
+
+    bool m_lossCacheEnabled;          //!< Whether the propagation gains are cached
+    PropagationLossCache m_lossCache; //!< Propagation gains of the pairs of nodes
 };
 
 } // namespace ns3
@@ -2589,7 +2589,6 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
     channelParams->m_o2iCondition = channelCondition->GetO2iCondition();
 
     // Step 4: Generate large scale parameters. All LSPS are uncorrelated.
-    DoubleVector LSPsIndep;
     DoubleVector LSPs;
     uint8_t paramNum = 6;
     if (channelParams->m_losCondition == ChannelCondition::LOS)
@@ -2598,10 +2597,8 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
     }
 
     // Generate paramNum independent LSPs.
-    for (uint8_t iter = 0; iter < paramNum; iter++)
-    {
-        LSPsIndep.push_back(m_normalRv->GetValue());
-    }
+    DoubleVector LSPsIndep(paramNum);
+    m_normalRv->GetValues(LSPsIndep);
     for (uint8_t row = 0; row < paramNum; row++)
     {
         double temp = 0;
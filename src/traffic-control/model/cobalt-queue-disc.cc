@@ -138,6 +138,10 @@ CobaltQueueDisc::CobaltQueueDisc()
     : QueueDisc()
 {
     NS_LOG_FUNCTION(this);
+    m_overlimitDropId = RegisterReason(OVERLIMIT_DROP);
+    m_targetExceededDropId = RegisterReason(TARGET_EXCEEDED_DROP);
+    m_ceThresholdExceededMarkId = RegisterReason(CE_THRESHOLD_EXCEEDED_MARK);
+    m_forcedMarkId = RegisterReason(FORCED_MARK);
     InitializeParams();
     m_uv = CreateObject<UniformRandomVariable>();
 }
@@ -328,7 +332,7 @@ CobaltQueueDisc::DoEnqueue(Ptr<QueueDiscItem> item)
         int64_t now = CoDelGetTime();
         // Call this to update Blue's drop probability
         CobaltQueueFull(now);
-        DropBeforeEnqueue(item, OVERLIMIT_DROP);
+        DropBeforeEnqueue(item, m_overlimitDropId);
         return false;
     }
 
@@ -374,7 +378,7 @@ CobaltQueueDisc::DoDequeue()
 
         if (drop)
         {
-            DropAfterDequeue(item, TARGET_EXCEEDED_DROP);
+            DropAfterDequeue(item, m_targetExceededDropId);
         }
         else
         {
@@ -457,7 +461,7 @@ CobaltQueueDisc::CobaltShouldDrop(Ptr<QueueDiscItem> item, int64_t now)
                 NS_LOG_DEBUG("CE packet " << static_cast<uint16_t>(tosByte & 0x3));
             }
             if (CoDelTimeAfter(sojournTime, Time2CoDel(m_ceThreshold)) &&
-                Mark(item, CE_THRESHOLD_EXCEEDED_MARK))
+                Mark(item, m_ceThresholdExceededMarkId))
             {
                 NS_LOG_LOGIC("Marking due to CeThreshold " << m_ceThreshold.GetSeconds());
             }
@@ -487,7 +491,7 @@ CobaltQueueDisc::CobaltShouldDrop(Ptr<QueueDiscItem> item, int64_t now)
         /* Check for marking possibility only if BLUE decides NOT to drop. */
         /* Check if router and packet, both have ECN enabled. Only if this is true, mark the packet.
          */
-        isMarked = (m_useEcn && Mark(item, FORCED_MARK));
+        isMarked = (m_useEcn && Mark(item, m_forcedMarkId));
         drop = !isMarked;
 
         m_count = std::max(m_count, m_count + 1);
@@ -513,7 +517,7 @@ CobaltQueueDisc::CobaltShouldDrop(Ptr<QueueDiscItem> item, int64_t now)
     // suppressed. If UseL4S attribute is enabled then ECT0 packets should not be marked.
     if (!isMarked && !m_useL4s && m_useEcn &&
         CoDelTimeAfter(sojournTime, Time2CoDel(m_ceThreshold)) &&
-        Mark(item, CE_THRESHOLD_EXCEEDED_MARK))
+        Mark(item, m_ceThresholdExceededMarkId))
     {
         NS_LOG_LOGIC("Marking due to CeThreshold " << m_ceThreshold.GetSeconds());
     }
@@ -244,6 +244,11 @@ class CobaltQueueDisc : public QueueDisc
     double m_increment; //!< increment value for marking probability
     double m_decrement; //!< decrement value for marking probability
     double m_pDrop;     //!< Drop Probability
+
+    ReasonId m_overlimitDropId;           //!< Identifier of the OVERLIMIT_DROP reason
+    ReasonId m_targetExceededDropId;      //!< Identifier of the TARGET_EXCEEDED_DROP reason
+    ReasonId m_ceThresholdExceededMarkId; //!< Identifier of the CE_THRESHOLD_EXCEEDED_MARK reason
+    ReasonId m_forcedMarkId;              //!< Identifier of the FORCED_MARK reason
 };
 
 } // namespace ns3
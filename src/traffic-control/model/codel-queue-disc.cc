@@ -133,6 +133,10 @@ CoDelQueueDisc::CoDelQueueDisc()
       m_dropNext(0)
 {
     NS_LOG_FUNCTION(this);
+    m_overlimitDropId = RegisterReason(OVERLIMIT_DROP);
+    m_ceThresholdExceededMarkId = RegisterReason(CE_THRESHOLD_EXCEEDED_MARK);
+    m_targetExceededMarkId = RegisterReason(TARGET_EXCEEDED_MARK);
+    m_targetExceededDropId = RegisterReason(TARGET_EXCEEDED_DROP);
 }
 
 CoDelQueueDisc::~CoDelQueueDisc()
@@ -168,7 +172,7 @@ CoDelQueueDisc::DoEnqueue(Ptr<QueueDiscItem> item)
     if (GetCurrentSize() + item > GetMaxSize())
     {
         NS_LOG_LOGIC("Queue full -- dropping pkt");
-        DropBeforeEnqueue(item, OVERLIMIT_DROP);
+        DropBeforeEnqueue(item, m_overlimitDropId);
         return false;
     }
 
@@ -257,7 +261,7 @@ CoDelQueueDisc::DoDequeue()
             }
 
             if (CoDelTimeAfter(ldelay, Time2CoDel(m_ceThreshold)) &&
-                Mark(item, CE_THRESHOLD_EXCEEDED_MARK))
+                Mark(item, m_ceThresholdExceededMarkId))
             {
                 NS_LOG_LOGIC("Marking due to CeThreshold " << m_ceThreshold.GetSeconds());
             }
@@ -297,7 +301,7 @@ CoDelQueueDisc::DoDequeue()
                 // A large amount of packets in queue might result in drop
                 // rates so high that the next drop should happen now,
                 // hence the while loop.
-                if (m_useEcn && Mark(item, TARGET_EXCEEDED_MARK))
+                if (m_useEcn && Mark(item, m_targetExceededMarkId))
                 {
                     isMarked = true;
                     NS_LOG_LOGIC("Sojourn time is still above target and it's time for next drop "
@@ -312,7 +316,7 @@ CoDelQueueDisc::DoDequeue()
                 NS_LOG_LOGIC(
                     "Sojourn time is still above target and it's time for next drop; dropping "
                     << item);
-                DropAfterDequeue(item, TARGET_EXCEEDED_DROP);
+                DropAfterDequeue(item, m_targetExceededDropId);
 
                 item = GetInternalQueue(0)->Dequeue();
 
@@ -348,7 +352,7 @@ CoDelQueueDisc::DoDequeue()
                      "first packet");
         if (okToDrop)
         {
-            if (m_useEcn && Mark(item, TARGET_EXCEEDED_MARK))
+            if (m_useEcn && Mark(item, m_targetExceededMarkId))
             {
                 isMarked = true;
                 NS_LOG_LOGIC("Sojourn time goes above target, marking the first packet "
@@ -359,7 +363,7 @@ CoDelQueueDisc::DoDequeue()
                 // Drop the first packet and enter dropping state unless the queue is empty
                 NS_LOG_LOGIC("Sojourn time goes above target, dropping the first packet "
                              << item << " and entering the dropping state");
-                DropAfterDequeue(item, TARGET_EXCEEDED_DROP);
+                DropAfterDequeue(item, m_targetExceededDropId);
                 item = GetInternalQueue(0)->Dequeue();
                 if (item)
                 {
@@ -400,7 +404,8 @@ end:
     // it would result in two counts of mark in the queue statistics. Therefore, we
     // use the isMarked flag to suppress a second attempt at marking.
     if (!isMarked && item && !m_useL4s && m_useEcn &&
-        CoDelTimeAfter(ldelay, Time2CoDel(m_ceThreshold)) && Mark(item, CE_THRESHOLD_EXCEEDED_MARK))
+        CoDelTimeAfter(ldelay, Time2CoDel(m_ceThreshold)) &&
+        Mark(item, m_ceThresholdExceededMarkId))
     {
         NS_LOG_LOGIC("Marking due to CeThreshold " << m_ceThreshold.GetSeconds());
     }
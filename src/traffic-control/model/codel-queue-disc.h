@@ -208,6 +208,11 @@ class CoDelQueueDisc : public QueueDisc
     uint16_t m_recInvSqrt;             //!< Reciprocal inverse square root
     uint32_t m_firstAboveTime;         //!< Time to declare sojourn time above target
     TracedValue<uint32_t> m_dropNext;  //!< Time to drop next packet
+
+    ReasonId m_overlimitDropId;           //!< Identifier of the OVERLIMIT_DROP reason
+    ReasonId m_ceThresholdExceededMarkId; //!< Identifier of the CE_THRESHOLD_EXCEEDED_MARK reason
+    ReasonId m_targetExceededMarkId;      //!< Identifier of the TARGET_EXCEEDED_MARK reason
+    ReasonId m_targetExceededDropId;      //!< Identifier of the TARGET_EXCEEDED_DROP reason
 };
 
 } // namespace ns3
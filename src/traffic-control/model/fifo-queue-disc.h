@@ -47,6 +47,8 @@ class FifoQueueDisc : public QueueDisc
     Ptr<const QueueDiscItem> DoPeek() override;
     bool CheckConfig() override;
     void InitializeParams() override;
+
+    ReasonId m_limitExceededDropId; //!< Identifier of the LIMIT_EXCEEDED_DROP reason
 };
 
 } // namespace ns3
@@ -0,0 +1,262 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "fluid-fifo-queue-disc.h"
+
+#include "ns3/drop-tail-queue.h"
+#include "ns3/log.h"
+#include "ns3/object-factory.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("FluidFifoQueueDisc");
+
+NS_OBJECT_ENSURE_REGISTERED(FluidFifoQueueDisc);
+
+TypeId
+FluidFifoQueueDisc::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::FluidFifoQueueDisc")
+            .SetParent<QueueDisc>()
+            .SetGroupName("TrafficControl")
+            .AddConstructor<FluidFifoQueueDisc>()
+            .AddAttribute("MaxSize",
+                          "The max queue size, in bytes",
+                          QueueSizeValue(QueueSize("100KB")),
+                          MakeQueueSizeAccessor(&QueueDisc::SetMaxSize, &QueueDisc::GetMaxSize),
+                          MakeQueueSizeChecker())
+            .AddAttribute("LinkRate",
+                          "The rate the buffer is drained at, i.e., the rate of the device",
+                          DataRateValue(DataRate("0bps")),
+                          MakeDataRateAccessor(&FluidFifoQueueDisc::m_linkRate),
+                          MakeDataRateChecker());
+    return tid;
+}
+
+FluidFifoQueueDisc::FluidFifoQueueDisc()
+    : QueueDisc(QueueDiscSizePolicy::SINGLE_INTERNAL_QUEUE),
+      m_fluidRate(0),
+      m_backlog(0),
+      m_fluidOffered(0),
+      m_fluidDropped(0)
+{
+    NS_LOG_FUNCTION(this);
+    m_limitExceededDropId = RegisterReason(LIMIT_EXCEEDED_DROP);
+}
+
+FluidFifoQueueDisc::~FluidFifoQueueDisc()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+FluidFifoQueueDisc::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_id.Cancel();
+    m_releaseTimes.clear();
+    QueueDisc::DoDispose();
+}
+
+void
+FluidFifoQueueDisc::SetFluidRate(DataRate rate)
+{
+    NS_LOG_FUNCTION(this << rate);
+    Update();
+    m_fluidRate = rate;
+}
+
+DataRate
+FluidFifoQueueDisc::GetFluidRate() const
+{
+    return m_fluidRate;
+}
+
+double
+FluidFifoQueueDisc::GetBacklog()
+{
+    Update();
+    return m_backlog;
+}
+
+Time
+FluidFifoQueueDisc::GetQueueingDelay()
+{
+    NS_ASSERT_MSG(m_linkRate.GetBitRate() > 0, "FluidFifoQueueDisc needs a link rate");
+    Update();
+    return Seconds(m_backlog * 8 / m_linkRate.GetBitRate());
+}
+
+double
+FluidFifoQueueDisc::GetFluidOffered()
+{
+    Update();
+    return m_fluidOffered;
+}
+
+double
+FluidFifoQueueDisc::GetFluidDropped()
+{
+    Update();
+    return m_fluidDropped;
+}
+
+void
+FluidFifoQueueDisc::Update()
+{
+    Time now = Simulator::Now();
+    if (now == m_lastUpdate)
+    {
+        return;
+    }
+
+    // the rates are constant since the last update, hence the backlog is
+    // linear in between and clamping it at the end is exact
+    double elapsed = (now - m_lastUpdate).GetSeconds();
+    double offered = m_fluidRate.GetBitRate() * elapsed / 8;
+    double drained = m_linkRate.GetBitRate() * elapsed / 8;
+    double limit = GetMaxSize().GetValue();
+
+    m_fluidOffered += offered;
+    m_backlog = std::max(m_backlog + offered - drained, 0.0);
+    if (m_backlog > limit)
+    {
+        m_fluidDropped += m_backlog - limit;
+        m_backlog = limit;
+    }
+    m_lastUpdate = now;
+}
+
+bool
+FluidFifoQueueDisc::DoEnqueue(Ptr<QueueDiscItem> item)
+{
+    NS_LOG_FUNCTION(this << item);
+
+    Update();
+
+    if (m_backlog + item->GetSize() > GetMaxSize().GetValue())
+    {
+        NS_LOG_LOGIC("Queue full -- dropping pkt");
+        DropBeforeEnqueue(item, m_limitExceededDropId);
+        return false;
+    }
+
+    NS_ASSERT_MSG(m_linkRate.GetBitRate() > 0, "FluidFifoQueueDisc needs a link rate");
+    Time release = Simulator::Now() + Seconds(m_backlog * 8 / m_linkRate.GetBitRate());
+
+    bool retval = GetInternalQueue(0)->Enqueue(item);
+
+    // If Queue::Enqueue fails, QueueDisc::DropBeforeEnqueue is called by the
+    // internal queue because QueueDisc::AddInternalQueue sets the trace callback
+
+    if (retval)
+    {
+        m_backlog += item->GetSize();
+        m_releaseTimes.push_back(release);
+    }
+
+    NS_LOG_LOGIC("Backlog " << m_backlog << " bytes, release at " << release.As(Time::S));
+
+    return retval;
+}
+
+Ptr<QueueDiscItem>
+FluidFifoQueueDisc::DoDequeue()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!DoPeek())
+    {
+        return nullptr;
+    }
+
+    m_releaseTimes.pop_front();
+    return GetInternalQueue(0)->Dequeue();
+}
+
+Ptr<const QueueDiscItem>
+FluidFifoQueueDisc::DoPeek()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_releaseTimes.empty())
+    {
+        NS_LOG_LOGIC("Queue empty");
+        return nullptr;
+    }
+
+    Time now = Simulator::Now();
+    if (m_releaseTimes.front() > now)
+    {
+        // the head packet is still behind the fluid backlog
+        if (m_id.IsExpired())
+        {
+            m_id = Simulator::Schedule(m_releaseTimes.front() - now, &QueueDisc::Run, this);
+            NS_LOG_LOGIC("Waking Event Scheduled at " << m_releaseTimes.front().As(Time::S));
+        }
+        return nullptr;
+    }
+
+    return GetInternalQueue(0)->Peek();
+}
+
+bool
+FluidFifoQueueDisc::CheckConfig()
+{
+    NS_LOG_FUNCTION(this);
+    if (GetNQueueDiscClasses() > 0)
+    {
+        NS_LOG_ERROR("FluidFifoQueueDisc cannot have classes");
+        return false;
+    }
+
+    if (GetNPacketFilters() > 0)
+    {
+        NS_LOG_ERROR("FluidFifoQueueDisc needs no packet filter");
+        return false;
+    }
+
+    if (GetNInternalQueues() == 0)
+    {
+        // add a DropTail queue
+        AddInternalQueue(
+            CreateObjectWithAttributes<DropTailQueue<QueueDiscItem>>("MaxSize",
+                                                                     QueueSizeValue(GetMaxSize())));
+    }
+
+    if (GetNInternalQueues() != 1)
+    {
+        NS_LOG_ERROR("FluidFifoQueueDisc needs 1 internal queue");
+        return false;
+    }
+
+    if (GetMaxSize().GetUnit() != QueueSizeUnit::BYTES)
+    {
+        NS_LOG_ERROR("FluidFifoQueueDisc needs a size in bytes");
+        return false;
+    }
+
+    if (m_linkRate.GetBitRate() == 0)
+    {
+        NS_LOG_ERROR("FluidFifoQueueDisc needs a link rate");
+        return false;
+    }
+
+    return true;
+}
+
+void
+FluidFifoQueueDisc::InitializeParams()
+{
+    NS_LOG_FUNCTION(this);
+    m_lastUpdate = Simulator::Now();
+    m_id = EventId();
+}
+
+} // namespace ns3
@@ -0,0 +1,130 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef FLUID_FIFO_QUEUE_DISC_H
+#define FLUID_FIFO_QUEUE_DISC_H
+
+#include "queue-disc.h"
+
+#include "ns3/data-rate.h"
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+
+#include <deque>
+
+namespace ns3
+{
+
+/**
+ * \ingroup traffic-control
+ *
+ * \brief FIFO queue disc shared by packets and by a fluid traffic aggregate.
+ *
+ * The queue disc models a drop-tail FIFO link buffer, in front of a device
+ * transmitting at LinkRate, that is also fed by background traffic described
+ * only by its aggregate rate (see SetFluidRate()), as done by fluid and
+ * hybrid simulators.  The backlog of the buffer evolves in continuous time,
+ * growing at the fluid rate and draining at the link rate, so that thousands
+ * of background flows cost a few events instead of a few events per packet.
+ *
+ * Packets see the background traffic as queueing delay and losses: a packet
+ * is dropped if it does not fit in the buffer, and otherwise it is held
+ * until the backlog in front of it, fluid and packets alike, would have been
+ * transmitted.  The fluid arriving when the buffer is full is dropped, and
+ * the model of the background flows (e.g., TcpFluidModel) polls the amounts
+ * of fluid offered and dropped to adapt the fluid rate to the losses.
+ *
+ * The size of the buffer can only be expressed in bytes.
+ */
+class FluidFifoQueueDisc : public QueueDisc
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+    /**
+     * \brief FluidFifoQueueDisc constructor
+     */
+    FluidFifoQueueDisc();
+
+    ~FluidFifoQueueDisc() override;
+
+    /**
+     * \brief Set the rate of the fluid traffic entering the queue disc.
+     *
+     * \param rate The fluid rate.
+     */
+    void SetFluidRate(DataRate rate);
+
+    /**
+     * \brief Get the rate of the fluid traffic entering the queue disc.
+     *
+     * \returns The fluid rate.
+     */
+    DataRate GetFluidRate() const;
+
+    /**
+     * \brief Get the current backlog of the buffer, fluid and packets alike.
+     *
+     * \returns The backlog in bytes.
+     */
+    double GetBacklog();
+
+    /**
+     * \brief Get the delay a packet enqueued now would wait before being dequeued.
+     *
+     * \returns The queueing delay.
+     */
+    Time GetQueueingDelay();
+
+    /**
+     * \brief Get the amount of fluid offered to the queue disc so far.
+     *
+     * \returns The fluid offered in bytes.
+     */
+    double GetFluidOffered();
+
+    /**
+     * \brief Get the amount of fluid dropped by the queue disc so far.
+     *
+     * \returns The fluid dropped in bytes.
+     */
+    double GetFluidDropped();
+
+    // Reasons for dropping packets
+    static constexpr const char* LIMIT_EXCEEDED_DROP =
+        "Queue disc limit exceeded"; //!< Packet dropped due to queue disc limit exceeded
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    bool DoEnqueue(Ptr<QueueDiscItem> item) override;
+    Ptr<QueueDiscItem> DoDequeue() override;
+    Ptr<const QueueDiscItem> DoPeek() override;
+    bool CheckConfig() override;
+    void InitializeParams() override;
+
+    /**
+     * \brief Bring the backlog up to date, dropping the fluid exceeding the buffer.
+     */
+    void Update();
+
+    DataRate m_linkRate;             //!< Rate the buffer is drained at
+    DataRate m_fluidRate;            //!< Rate of the fluid traffic
+    double m_backlog;                //!< Backlog in bytes at the last update
+    Time m_lastUpdate;               //!< Time of the last update
+    double m_fluidOffered;           //!< Fluid bytes offered so far
+    double m_fluidDropped;           //!< Fluid bytes dropped so far
+    std::deque<Time> m_releaseTimes; //!< Time each queued packet can be dequeued at
+    EventId m_id;                    //!< Event to wake up the queue disc at the next release
+
+    ReasonId m_limitExceededDropId; //!< Identifier of the LIMIT_EXCEEDED_DROP reason
+};
+
+} // namespace ns3
+
+#endif /* FLUID_FIFO_QUEUE_DISC_H */
@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef FQ_FLOW_LIST_H
+#define FQ_FLOW_LIST_H
+
+#include "ns3/assert.h"
+
+/**
+ * \file
+ * \ingroup traffic-control
+ * ns3::FqFlowList declaration and implementation.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup traffic-control
+ *
+ * \brief Intrusive FIFO list of flow queues, used by the DRR schedulers of
+ * FqCoDelQueueDisc, FqCobaltQueueDisc and FqPieQueueDisc.
+ *
+ * A flow queue belongs to at most one list at a time (the list of new flows
+ * or the list of old flows), hence the link to the next flow is stored in
+ * the flow itself, in a \c m_next member the list is a friend of.  Moving a
+ * flow between lists or to the back of its list neither allocates memory
+ * nor touches the reference count of the flow, which is owned by the queue
+ * disc as one of its classes.
+ *
+ * \tparam Flow The flow queue type.
+ */
+template <typename Flow>
+class FqFlowList
+{
+  public:
+    /** \returns true if the list is empty. */
+    bool IsEmpty() const;
+
+    /** \returns The flow at the front of the list, or nullptr if the list is empty. */
+    Flow* Front() const;
+
+    /**
+     * Append a flow to the list.
+     *
+     * \param [in] flow The flow, which must not belong to any list.
+     */
+    void PushBack(Flow* flow);
+
+    /**
+     * Remove the flow at the front of the list, which must not be empty.
+     *
+     * \returns The flow removed.
+     */
+    Flow* PopFront();
+
+    /**
+     * Remove all the flows from the list, unlinking each of them.
+     */
+    void Clear();
+
+  private:
+    Flow* m_head{nullptr}; //!< First flow of the list
+    Flow* m_tail{nullptr}; //!< Last flow of the list
+};
+
+/***************************************************************
+ *  Implementation of the templates declared above.
+ ***************************************************************/
+
+template <typename Flow>
+bool
+FqFlowList<Flow>::IsEmpty() const
+{
+    return m_head == nullptr;
+}
+
+template <typename Flow>
+Flow*
+FqFlowList<Flow>::Front() const
+{
+    return m_head;
+}
+
+template <typename Flow>
+void
+FqFlowList<Flow>::PushBack(Flow* flow)
+{
+    NS_ASSERT(flow->m_next == nullptr && flow != m_tail);
+    if (m_tail)
+    {
+        m_tail->m_next = flow;
+    }
+    else
+    {
+        m_head = flow;
+    }
+    m_tail = flow;
+}
+
+template <typename Flow>
+Flow*
+FqFlowList<Flow>::PopFront()
+{
+    NS_ASSERT(m_head);
+    Flow* flow = m_head;
+    m_head = flow->m_next;
+    if (!m_head)
+    {
+        m_tail = nullptr;
+    }
+    flow->m_next = nullptr;
+    return flow;
+}
+
+template <typename Flow>
+void
+FqFlowList<Flow>::Clear()
+{
+    while (m_head)
+    {
+        PopFront();
+    }
+}
+
+} // namespace ns3
+
+#endif /* FQ_FLOW_LIST_H */
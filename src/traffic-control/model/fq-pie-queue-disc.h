@@ -15,12 +15,12 @@
 #ifndef FQ_PIE_QUEUE_DISC
 #define FQ_PIE_QUEUE_DISC
 
+#include "fq-flow-list.h"
 #include "queue-disc.h"
 
 #include "ns3/object-factory.h"
 
-#include <list>
-#include <map>
+#include <vector>
 
 namespace ns3
 {
@@ -97,6 +97,10 @@ class FqPieFlow : public QueueDiscClass
     int32_t m_deficit;   //!< the deficit for this flow
     FlowStatus m_status; //!< the status of this flow
     uint32_t m_index;    //!< the index for this flow
+
+    /// Allow the flow lists to link the flows
+    friend class FqFlowList<FqPieFlow>;
+    FqPieFlow* m_next; //!< the next flow in the list of new or old flows
 };
 
 /**
@@ -141,6 +145,12 @@ class FqPieQueueDisc : public QueueDisc
         "Unclassified drop"; //!< No packet filter able to classify packet
     static constexpr const char* OVERLIMIT_DROP = "Overlimit drop"; //!< Overlimit dropped packets
 
+  protected:
+    /**
+     * \brief Dispose of the object
+     */
+    void DoDispose() override;
+
   private:
     bool DoEnqueue(Ptr<QueueDiscItem> item) override;
     Ptr<QueueDiscItem> DoDequeue() override;
@@ -189,14 +199,17 @@ class FqPieQueueDisc : public QueueDisc
     uint32_t m_perturbation;         //!< hash perturbation value
     bool m_enableSetAssociativeHash; //!< whether to enable set associative hash
 
-    std::list<Ptr<FqPieFlow>> m_newFlows; //!< The list of new flows
-    std::list<Ptr<FqPieFlow>> m_oldFlows; //!< The list of old flows
+    FqFlowList<FqPieFlow> m_newFlows; //!< The list of new flows
+    FqFlowList<FqPieFlow> m_oldFlows; //!< The list of old flows
 
-    std::map<uint32_t, uint32_t> m_flowsIndices; //!< Map with the index of class for each flow
-    std::map<uint32_t, uint32_t> m_tags;         //!< Tags used by set associative hash
+    std::vector<Ptr<FqPieFlow>> m_flowTable; //!< The flow queue with each index, if created
+    std::vector<uint32_t> m_tags;            //!< Tags used by set associative hash
 
     ObjectFactory m_flowFactory;      //!< Factory to create a new flow
     ObjectFactory m_queueDiscFactory; //!< Factory to create a new queue
+
+    ReasonId m_unclassifiedDropId; //!< Identifier of the UNCLASSIFIED_DROP reason
+    ReasonId m_overlimitDropId;    //!< Identifier of the OVERLIMIT_DROP reason
 };
 
 } // namespace ns3
@@ -42,6 +42,7 @@ PfifoFastQueueDisc::PfifoFastQueueDisc()
     : QueueDisc(QueueDiscSizePolicy::MULTIPLE_QUEUES, QueueSizeUnit::PACKETS)
 {
     NS_LOG_FUNCTION(this);
+    m_limitExceededDropId = RegisterReason(LIMIT_EXCEEDED_DROP);
 }
 
 PfifoFastQueueDisc::~PfifoFastQueueDisc()
@@ -59,7 +60,7 @@ PfifoFastQueueDisc::DoEnqueue(Ptr<QueueDiscItem> item)
     if (GetCurrentSize() >= GetMaxSize())
     {
         NS_LOG_LOGIC("Queue disc limit exceeded -- dropping packet");
-        DropBeforeEnqueue(item, LIMIT_EXCEEDED_DROP);
+        DropBeforeEnqueue(item, m_limitExceededDropId);
         return false;
     }
 
@@ -68,6 +68,8 @@ class PfifoFastQueueDisc : public QueueDisc
     Ptr<const QueueDiscItem> DoPeek() override;
     bool CheckConfig() override;
     void InitializeParams() override;
+
+    ReasonId m_limitExceededDropId; //!< Identifier of the LIMIT_EXCEEDED_DROP reason
 };
 
 } // namespace ns3
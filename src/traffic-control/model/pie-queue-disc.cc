@@ -131,6 +131,10 @@ PieQueueDisc::PieQueueDisc()
     : QueueDisc(QueueDiscSizePolicy::SINGLE_INTERNAL_QUEUE)
 {
     NS_LOG_FUNCTION(this);
+    m_forcedDropId = RegisterReason(FORCED_DROP);
+    m_unforcedMarkId = RegisterReason(UNFORCED_MARK);
+    m_unforcedDropId = RegisterReason(UNFORCED_DROP);
+    m_ceThresholdExceededMarkId = RegisterReason(CE_THRESHOLD_EXCEEDED_MARK);
     m_uv = CreateObject<UniformRandomVariable>();
     m_rtrsEvent = Simulator::Schedule(m_sUpdate, &PieQueueDisc::CalculateP, this);
 }
@@ -192,7 +196,7 @@ PieQueueDisc::DoEnqueue(Ptr<QueueDiscItem> item)
     if (nQueued + item > GetMaxSize())
     {
         // Drops due to queue limit: reactive
-        DropBeforeEnqueue(item, FORCED_DROP);
+        DropBeforeEnqueue(item, m_forcedDropId);
         m_accuProb = 0;
         return false;
     }
@@ -201,10 +205,10 @@ PieQueueDisc::DoEnqueue(Ptr<QueueDiscItem> item)
     else if ((m_activeThreshold == Time::Max() || m_active) && !isEct1 &&
              DropEarly(item, nQueued.GetValue()))
     {
-        if (!m_useEcn || m_dropProb >= m_markEcnTh || !Mark(item, UNFORCED_MARK))
+        if (!m_useEcn || m_dropProb >= m_markEcnTh || !Mark(item, m_unforcedMarkId))
         {
             // Early probability drop: proactive
-            DropBeforeEnqueue(item, UNFORCED_DROP);
+            DropBeforeEnqueue(item, m_unforcedDropId);
             m_accuProb = 0;
             return false;
         }
@@ -488,7 +492,7 @@ PieQueueDisc::DoDequeue()
                 NS_LOG_DEBUG("CE packet " << static_cast<uint16_t>(tosByte & 0x3));
             }
             if ((Now() - item->GetTimeStamp() > m_ceThreshold) &&
-                Mark(item, CE_THRESHOLD_EXCEEDED_MARK))
+                Mark(item, m_ceThresholdExceededMarkId))
             {
                 NS_LOG_LOGIC("Marking due to CeThreshold " << m_ceThreshold.GetSeconds());
             }
@@ -167,6 +167,11 @@ class PieQueueDisc : public QueueDisc
     Ptr<UniformRandomVariable> m_uv; //!< Rng stream
     double m_accuProb;               //!< Accumulated drop probability
     bool m_active;                   //!< Indicates whether PIE is in active state or not
+
+    ReasonId m_forcedDropId;              //!< Identifier of the FORCED_DROP reason
+    ReasonId m_unforcedMarkId;            //!< Identifier of the UNFORCED_MARK reason
+    ReasonId m_unforcedDropId;            //!< Identifier of the UNFORCED_DROP reason
+    ReasonId m_ceThresholdExceededMarkId; //!< Identifier of the CE_THRESHOLD_EXCEEDED_MARK reason
 };
 
 }; // namespace ns3
@@ -315,16 +315,18 @@ QueueDisc::QueueDisc(QueueDiscSizePolicy policy)
 {
     NS_LOG_FUNCTION(this << (uint16_t)policy);
 
+    m_internalQueueDrop = RegisterReason(INTERNAL_QUEUE_DROP);
+
     // These lambdas call the DropBeforeEnqueue or DropAfterDequeue methods of this
     // QueueDisc object. Given that a callback to the operator() of these lambdas
     // is connected to the DropBeforeEnqueue and DropAfterDequeue traces of the
-    // internal queues, the INTERNAL_QUEUE_DROP constant is passed as the reason
-    // why the packet is dropped.
+    // internal queues, the identifier of the INTERNAL_QUEUE_DROP reason is passed
+    // as the reason why the packet is dropped.
     m_internalQueueDbeFunctor = [this](Ptr<const QueueDiscItem> item) {
-        return DropBeforeEnqueue(item, INTERNAL_QUEUE_DROP);
+        return DropBeforeEnqueue(item, m_internalQueueDrop);
     };
     m_internalQueueDadFunctor = [this](Ptr<const QueueDiscItem> item) {
-        return DropAfterDequeue(item, INTERNAL_QUEUE_DROP);
+        return DropAfterDequeue(item, m_internalQueueDrop);
     };
 
     // These lambdas call the DropBeforeEnqueue or DropAfterDequeue methods of this
@@ -334,18 +336,16 @@ QueueDisc::QueueDisc(QueueDiscSizePolicy policy)
     // and the second argument provided by such traces is passed as the reason why
     // the packet is dropped.
     m_childQueueDiscDbeFunctor = [this](Ptr<const QueueDiscItem> item, const char* r) {
-        return DropBeforeEnqueue(
-            item,
-            m_childQueueDiscDropMsg.assign(CHILD_QUEUE_DISC_DROP).append(r).data());
+        return DropBeforeEnqueue(item,
+                                 GetChildReason(m_childDropReasons, CHILD_QUEUE_DISC_DROP, r));
     };
     m_childQueueDiscDadFunctor = [this](Ptr<const QueueDiscItem> item, const char* r) {
-        return DropAfterDequeue(
-            item,
-            m_childQueueDiscDropMsg.assign(CHILD_QUEUE_DISC_DROP).append(r).data());
+        return DropAfterDequeue(item,
+                                GetChildReason(m_childDropReasons, CHILD_QUEUE_DISC_DROP, r));
     };
     m_childQueueDiscMarkFunctor = [this](Ptr<const QueueDiscItem> item, const char* r) {
         return Mark(const_cast<QueueDiscItem*>(PeekPointer(item)),
-                    m_childQueueDiscMarkMsg.assign(CHILD_QUEUE_DISC_MARK).append(r).data());
+                    GetChildReason(m_childMarkReasons, CHILD_QUEUE_DISC_MARK, r));
     };
 }
 
@@ -414,9 +414,63 @@ QueueDisc::GetStats()
                               (m_requeued ? m_requeued->GetSize() : 0) -
                               m_stats.nTotalDroppedBytesAfterDequeue;
 
+    // likewise, the counters for each reason are only named here
+    m_stats.nDroppedPacketsBeforeEnqueue.clear();
+    m_stats.nDroppedBytesBeforeEnqueue.clear();
+    m_stats.nDroppedPacketsAfterDequeue.clear();
+    m_stats.nDroppedBytesAfterDequeue.clear();
+    m_stats.nMarkedPackets.clear();
+    m_stats.nMarkedBytes.clear();
+
+    for (std::size_t i = 0; i < m_reasons.size(); i++)
+    {
+        const auto& counters = m_reasonCounters[i];
+        const auto& reason = m_reasons[i];
+        if (counters.nDroppedPacketsBeforeEnqueue > 0)
+        {
+            m_stats.nDroppedPacketsBeforeEnqueue[reason] = counters.nDroppedPacketsBeforeEnqueue;
+            m_stats.nDroppedBytesBeforeEnqueue[reason] = counters.nDroppedBytesBeforeEnqueue;
+        }
+        if (counters.nDroppedPacketsAfterDequeue > 0)
+        {
+            m_stats.nDroppedPacketsAfterDequeue[reason] = counters.nDroppedPacketsAfterDequeue;
+            m_stats.nDroppedBytesAfterDequeue[reason] = counters.nDroppedBytesAfterDequeue;
+        }
+        if (counters.nMarkedPackets > 0)
+        {
+            m_stats.nMarkedPackets[reason] = counters.nMarkedPackets;
+            m_stats.nMarkedBytes[reason] = counters.nMarkedBytes;
+        }
+    }
+
     return m_stats;
 }
 
+QueueDisc::ReasonId
+QueueDisc::RegisterReason(const std::string& reason)
+{
+    auto [it, inserted] = m_reasonIds.try_emplace(reason, m_reasons.size());
+    if (inserted)
+    {
+        // the strings in the deque are never moved, hence their address can be
+        // used by the parent queue disc to identify the reason
+        m_reasons.push_back(reason);
+        m_reasonCounters.emplace_back();
+    }
+    return it->second;
+}
+
+QueueDisc::ReasonId
+QueueDisc::GetChildReason(ChildReasonMap& childReasons, const char* prefix, const char* reason)
+{
+    auto it = childReasons.find(reason);
+    if (it == childReasons.end())
+    {
+        it = childReasons.emplace(reason, RegisterReason(std::string(prefix) + reason)).first;
+    }
+    return it->second;
+}
+
 uint32_t
 QueueDisc::GetNPackets() const
 {
@@ -708,72 +762,54 @@ QueueDisc::PacketDequeued(Ptr<const QueueDiscItem> item)
 void
 QueueDisc::DropBeforeEnqueue(Ptr<const QueueDiscItem> item, const char* reason)
 {
-    NS_LOG_FUNCTION(this << item << reason);
+    DropBeforeEnqueue(item, RegisterReason(reason));
+}
+
+void
+QueueDisc::DropBeforeEnqueue(Ptr<const QueueDiscItem> item, ReasonId reason)
+{
+    NS_ASSERT(reason < m_reasons.size());
+    NS_LOG_FUNCTION(this << item << m_reasons[reason]);
 
     m_stats.nTotalDroppedPackets++;
     m_stats.nTotalDroppedBytes += item->GetSize();
     m_stats.nTotalDroppedPacketsBeforeEnqueue++;
     m_stats.nTotalDroppedBytesBeforeEnqueue += item->GetSize();
 
-    // update the number of packets dropped for the given reason
-    auto itp = m_stats.nDroppedPacketsBeforeEnqueue.find(reason);
-    if (itp != m_stats.nDroppedPacketsBeforeEnqueue.end())
-    {
-        itp->second++;
-    }
-    else
-    {
-        m_stats.nDroppedPacketsBeforeEnqueue[reason] = 1;
-    }
-    // update the amount of bytes dropped for the given reason
-    auto itb = m_stats.nDroppedBytesBeforeEnqueue.find(reason);
-    if (itb != m_stats.nDroppedBytesBeforeEnqueue.end())
-    {
-        itb->second += item->GetSize();
-    }
-    else
-    {
-        m_stats.nDroppedBytesBeforeEnqueue[reason] = item->GetSize();
-    }
+    // update the counters of the given reason
+    auto& counters = m_reasonCounters[reason];
+    counters.nDroppedPacketsBeforeEnqueue++;
+    counters.nDroppedBytesBeforeEnqueue += item->GetSize();
 
     NS_LOG_DEBUG("Total packets/bytes dropped before enqueue: "
                  << m_stats.nTotalDroppedPacketsBeforeEnqueue << " / "
                  << m_stats.nTotalDroppedBytesBeforeEnqueue);
     NS_LOG_LOGIC("m_traceDropBeforeEnqueue (p)");
     m_traceDrop(item);
-    m_traceDropBeforeEnqueue(item, reason);
+    m_traceDropBeforeEnqueue(item, m_reasons[reason].c_str());
 }
 
 void
 QueueDisc::DropAfterDequeue(Ptr<const QueueDiscItem> item, const char* reason)
 {
-    NS_LOG_FUNCTION(this << item << reason);
+    DropAfterDequeue(item, RegisterReason(reason));
+}
+
+void
+QueueDisc::DropAfterDequeue(Ptr<const QueueDiscItem> item, ReasonId reason)
+{
+    NS_ASSERT(reason < m_reasons.size());
+    NS_LOG_FUNCTION(this << item << m_reasons[reason]);
 
     m_stats.nTotalDroppedPackets++;
     m_stats.nTotalDroppedBytes += item->GetSize();
     m_stats.nTotalDroppedPacketsAfterDequeue++;
     m_stats.nTotalDroppedBytesAfterDequeue += item->GetSize();
 
-    // update the number of packets dropped for the given reason
-    auto itp = m_stats.nDroppedPacketsAfterDequeue.find(reason);
-    if (itp != m_stats.nDroppedPacketsAfterDequeue.end())
-    {
-        itp->second++;
-    }
-    else
-    {
-        m_stats.nDroppedPacketsAfterDequeue[reason] = 1;
-    }
-    // update the amount of bytes dropped for the given reason
-    auto itb = m_stats.nDroppedBytesAfterDequeue.find(reason);
-    if (itb != m_stats.nDroppedBytesAfterDequeue.end())
-    {
-        itb->second += item->GetSize();
-    }
-    else
-    {
-        m_stats.nDroppedBytesAfterDequeue[reason] = item->GetSize();
-    }
+    // update the counters of the given reason
+    auto& counters = m_reasonCounters[reason];
+    counters.nDroppedPacketsAfterDequeue++;
+    counters.nDroppedBytesAfterDequeue += item->GetSize();
 
     // if in the context of a peek request a dequeued packet is dropped, we need
     // to update the statistics and fire the dequeue trace before firing the drop
@@ -791,13 +827,20 @@ QueueDisc::DropAfterDequeue(Ptr<const QueueDiscItem> item, const char* reason)
                  << m_stats.nTotalDroppedBytesAfterDequeue);
     NS_LOG_LOGIC("m_traceDropAfterDequeue (p)");
     m_traceDrop(item);
-    m_traceDropAfterDequeue(item, reason);
+    m_traceDropAfterDequeue(item, m_reasons[reason].c_str());
 }
 
 bool
 QueueDisc::Mark(Ptr<QueueDiscItem> item, const char* reason)
 {
-    NS_LOG_FUNCTION(this << item << reason);
+    return Mark(item, RegisterReason(reason));
+}
+
+bool
+QueueDisc::Mark(Ptr<QueueDiscItem> item, ReasonId reason)
+{
+    NS_ASSERT(reason < m_reasons.size());
+    NS_LOG_FUNCTION(this << item << m_reasons[reason]);
 
     bool retval = item->Mark();
 
@@ -809,30 +852,14 @@ QueueDisc::Mark(Ptr<QueueDiscItem> item, const char* reason)
     m_stats.nTotalMarkedPackets++;
     m_stats.nTotalMarkedBytes += item->GetSize();
 
-    // update the number of packets marked for the given reason
-    auto itp = m_stats.nMarkedPackets.find(reason);
-    if (itp != m_stats.nMarkedPackets.end())
-    {
-        itp->second++;
-    }
-    else
-    {
-        m_stats.nMarkedPackets[reason] = 1;
-    }
-    // update the amount of bytes marked for the given reason
-    auto itb = m_stats.nMarkedBytes.find(reason);
-    if (itb != m_stats.nMarkedBytes.end())
-    {
-        itb->second += item->GetSize();
-    }
-    else
-    {
-        m_stats.nMarkedBytes[reason] = item->GetSize();
-    }
+    // update the counters of the given reason
+    auto& counters = m_reasonCounters[reason];
+    counters.nMarkedPackets++;
+    counters.nMarkedBytes += item->GetSize();
 
     NS_LOG_DEBUG("Total packets/bytes marked: " << m_stats.nTotalMarkedPackets << " / "
                                                 << m_stats.nTotalMarkedBytes);
-    m_traceMark(item, reason);
+    m_traceMark(item, m_reasons[reason].c_str());
     return true;
 }
 
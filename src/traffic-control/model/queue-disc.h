@@ -17,9 +17,11 @@
 #include "ns3/traced-callback.h"
 #include "ns3/traced-value.h"
 
+#include <deque>
 #include <functional>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ns3
@@ -157,7 +159,11 @@ enum QueueDiscSizePolicy
  * When a packet is dropped by an internal queue, e.g., because the queue is full,
  * the reason is "Dropped by internal queue". When a packet is dropped by a child
  * queue disc, the reason is "(Dropped by child queue disc) " followed by the
- * reason why the child queue disc dropped the packet.
+ * reason why the child queue disc dropped the packet. Subclasses register their
+ * reasons to drop or mark packets by calling RegisterReason, which returns the
+ * identifier to pass to DropBeforeEnqueue, DropAfterDequeue and Mark, so that
+ * the counters of a reason are found by index; the names of the reasons are
+ * only used by GetStats.
  *
  * The QueueDisc base class provides the SojournTime trace source, which provides
  * the sojourn time of every packet dequeued from a queue disc, including packets
@@ -195,21 +201,21 @@ class QueueDisc : public Object
         uint32_t nTotalDroppedPackets;
         /// Total packets dropped before enqueue
         uint32_t nTotalDroppedPacketsBeforeEnqueue;
-        /// Packets dropped before enqueue, for each reason
+        /// Packets dropped before enqueue, per reason -- not kept up to date, call GetStats first
         std::map<std::string, uint32_t, std::less<>> nDroppedPacketsBeforeEnqueue;
         /// Total packets dropped after dequeue
         uint32_t nTotalDroppedPacketsAfterDequeue;
-        /// Packets dropped after dequeue, for each reason
+        /// Packets dropped after dequeue, per reason -- not kept up to date, call GetStats first
         std::map<std::string, uint32_t, std::less<>> nDroppedPacketsAfterDequeue;
         /// Total dropped bytes
         uint64_t nTotalDroppedBytes;
         /// Total bytes dropped before enqueue
         uint64_t nTotalDroppedBytesBeforeEnqueue;
-        /// Bytes dropped before enqueue, for each reason
+        /// Bytes dropped before enqueue, per reason -- not kept up to date, call GetStats first
         std::map<std::string, uint64_t, std::less<>> nDroppedBytesBeforeEnqueue;
         /// Total bytes dropped after dequeue
         uint64_t nTotalDroppedBytesAfterDequeue;
-        /// Bytes dropped after dequeue, for each reason
+        /// Bytes dropped after dequeue, per reason -- not kept up to date, call GetStats first
         std::map<std::string, uint64_t, std::less<>> nDroppedBytesAfterDequeue;
         /// Total requeued packets
         uint32_t nTotalRequeuedPackets;
@@ -217,11 +223,11 @@ class QueueDisc : public Object
         uint64_t nTotalRequeuedBytes;
         /// Total marked packets
         uint32_t nTotalMarkedPackets;
-        /// Marked packets, for each reason
+        /// Marked packets, per reason -- not kept up to date, call GetStats first
         std::map<std::string, uint32_t, std::less<>> nMarkedPackets;
         /// Total marked bytes
         uint32_t nTotalMarkedBytes;
-        /// Marked bytes, for each reason
+        /// Marked bytes, per reason -- not kept up to date, call GetStats first
         std::map<std::string, uint64_t, std::less<>> nMarkedBytes;
 
         /// constructor
@@ -507,6 +513,9 @@ class QueueDisc : public Object
      */
     virtual WakeMode GetWakeMode() const;
 
+    /// Identifier of a reason to drop or mark packets, returned by RegisterReason
+    using ReasonId = std::size_t;
+
     // Reasons for dropping packets
     static constexpr const char* INTERNAL_QUEUE_DROP =
         "Dropped by internal queue"; //!< Packet dropped by an internal queue
@@ -532,13 +541,35 @@ class QueueDisc : public Object
      */
     void DoInitialize() override;
 
+    /**
+     * \brief Register a reason to drop or mark packets
+     *
+     * This method is meant to be called by subclasses at construction time, for
+     * each of their reasons to drop or mark packets.
+     *
+     * \param reason the reason
+     * \return the identifier of the reason, which is the same for all the calls
+     *         with the same reason
+     */
+    ReasonId RegisterReason(const std::string& reason);
+
     /**
      * \brief Perform the actions required when the queue disc is notified of
      *        a packet dropped before enqueue
      * \param item item that was dropped
-     * \param reason the reason why the item was dropped
+     * \param reason the identifier of the reason why the item was dropped
      * This method must be called by subclasses to record that a packet was
-     * dropped before enqueue for the specified reason
+     * dropped before enqueue for the specified reason.
+     */
+    void DropBeforeEnqueue(Ptr<const QueueDiscItem> item, ReasonId reason);
+
+    /**
+     * \brief Perform the actions required when the queue disc is notified of
+     *        a packet dropped before enqueue
+     * \param item item that was dropped
+     * \param reason the reason why the item was dropped, which is looked up by
+     *        name: subclasses should rather pass the identifier returned by
+     *        RegisterReason
      */
     void DropBeforeEnqueue(Ptr<const QueueDiscItem> item, const char* reason);
 
@@ -546,9 +577,19 @@ class QueueDisc : public Object
      * \brief Perform the actions required when the queue disc is notified of
      *        a packet dropped after dequeue
      * \param item item that was dropped
-     * \param reason the reason why the item was dropped
+     * \param reason the identifier of the reason why the item was dropped
      * This method must be called by subclasses to record that a packet was
-     * dropped after dequeue for the specified reason
+     * dropped after dequeue for the specified reason.
+     */
+    void DropAfterDequeue(Ptr<const QueueDiscItem> item, ReasonId reason);
+
+    /**
+     * \brief Perform the actions required when the queue disc is notified of
+     *        a packet dropped after dequeue
+     * \param item item that was dropped
+     * \param reason the reason why the item was dropped, which is looked up by
+     *        name: subclasses should rather pass the identifier returned by
+     *        RegisterReason
      */
     void DropAfterDequeue(Ptr<const QueueDiscItem> item, const char* reason);
 
@@ -556,7 +597,18 @@ class QueueDisc : public Object
      * \brief Marks the given packet and, if successful, updates the counters
      *        associated with the given reason
      * \param item item that has to be marked
-     * \param reason the reason why the item has to be marked
+     * \param reason the identifier of the reason why the item has to be marked
+     * \return true if the item was successfully marked, false otherwise
+     */
+    bool Mark(Ptr<QueueDiscItem> item, ReasonId reason);
+
+    /**
+     * \brief Marks the given packet and, if successful, updates the counters
+     *        associated with the given reason
+     * \param item item that has to be marked
+     * \param reason the reason why the item has to be marked, which is looked up
+     *        by name: subclasses should rather pass the identifier returned by
+     *        RegisterReason
      * \return true if the item was successfully marked, false otherwise
      */
     bool Mark(Ptr<QueueDiscItem> item, const char* reason);
@@ -692,10 +744,47 @@ class QueueDisc : public Object
     bool m_running;                //!< The queue disc is performing multiple dequeue operations
     Ptr<QueueDiscItem> m_requeued; //!< The last packet that failed to be transmitted
     bool m_peeked;                 //!< A packet was dequeued because Peek was called
-    std::string m_childQueueDiscDropMsg; //!< Reason why a packet was dropped by a child queue disc
-    std::string m_childQueueDiscMarkMsg; //!< Reason why a packet was marked by a child queue disc
-    QueueDiscSizePolicy m_sizePolicy;    //!< The queue disc size policy
-    bool m_prohibitChangeMode;           //!< True if changing mode is prohibited
+    QueueDiscSizePolicy m_sizePolicy; //!< The queue disc size policy
+    bool m_prohibitChangeMode;        //!< True if changing mode is prohibited
+
+    /// Counters of the packets dropped or marked for a given reason
+    struct ReasonCounters
+    {
+        uint32_t nDroppedPacketsBeforeEnqueue{0}; //!< Packets dropped before enqueue
+        uint64_t nDroppedBytesBeforeEnqueue{0};   //!< Bytes dropped before enqueue
+        uint32_t nDroppedPacketsAfterDequeue{0};  //!< Packets dropped after dequeue
+        uint64_t nDroppedBytesAfterDequeue{0};    //!< Bytes dropped after dequeue
+        uint32_t nMarkedPackets{0};               //!< Marked packets
+        uint64_t nMarkedBytes{0};                 //!< Marked bytes
+    };
+
+    /// Identifiers of the reasons composed for the reasons of a child queue disc
+    using ChildReasonMap = std::unordered_map<const char*, ReasonId>;
+
+    /**
+     * \brief Get the identifier of the reason reported for a packet dropped or
+     *        marked by a child queue disc, i.e., the given prefix followed by
+     *        the reason provided by the child queue disc.
+     *
+     * The reasons provided by the traces of a queue disc are the names it stores
+     * for its registered reasons, which are never moved nor freed as long as the
+     * queue disc; hence, the address of a reason provided by a child queue disc
+     * identifies it.
+     *
+     * \param childReasons the reasons already composed with the given prefix
+     * \param prefix the prefix
+     * \param reason the reason provided by the child queue disc
+     * \return the identifier of the composed reason
+     */
+    ReasonId GetChildReason(ChildReasonMap& childReasons, const char* prefix, const char* reason);
+
+    std::deque<std::string> m_reasons;            //!< Names of the registered reasons, by id
+    std::vector<ReasonCounters> m_reasonCounters; //!< Counters of the registered reasons, by id
+    /// Identifiers of the registered reasons, by name
+    std::unordered_map<std::string, ReasonId> m_reasonIds;
+    ReasonId m_internalQueueDrop;      //!< Identifier of the INTERNAL_QUEUE_DROP reason
+    ChildReasonMap m_childDropReasons; //!< Reasons for child queue disc drops
+    ChildReasonMap m_childMarkReasons; //!< Reasons for child queue disc marks
 
     /// Traced callback: fired when a packet is enqueued
     TracedCallback<Ptr<const QueueDiscItem>> m_traceEnqueue;
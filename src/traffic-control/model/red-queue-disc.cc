@@ -218,6 +218,10 @@ RedQueueDisc::RedQueueDisc()
     : QueueDisc(QueueDiscSizePolicy::SINGLE_INTERNAL_QUEUE)
 {
     NS_LOG_FUNCTION(this);
+    m_unforcedMarkId = RegisterReason(UNFORCED_MARK);
+    m_unforcedDropId = RegisterReason(UNFORCED_DROP);
+    m_forcedMarkId = RegisterReason(FORCED_MARK);
+    m_forcedDropId = RegisterReason(FORCED_DROP);
     m_uv = CreateObject<UniformRandomVariable>();
 }
 
@@ -399,20 +403,20 @@ RedQueueDisc::DoEnqueue(Ptr<QueueDiscItem> item)
 
     if (dropType == DTYPE_UNFORCED)
     {
-        if (!m_useEcn || !Mark(item, UNFORCED_MARK))
+        if (!m_useEcn || !Mark(item, m_unforcedMarkId))
         {
             NS_LOG_DEBUG("\t Dropping due to Prob Mark " << m_qAvg);
-            DropBeforeEnqueue(item, UNFORCED_DROP);
+            DropBeforeEnqueue(item, m_unforcedDropId);
             return false;
         }
         NS_LOG_DEBUG("\t Marking due to Prob Mark " << m_qAvg);
     }
     else if (dropType == DTYPE_FORCED)
     {
-        if (m_useHardDrop || !m_useEcn || !Mark(item, FORCED_MARK))
+        if (m_useHardDrop || !m_useEcn || !Mark(item, m_forcedMarkId))
         {
             NS_LOG_DEBUG("\t Dropping due to Hard Mark " << m_qAvg);
-            DropBeforeEnqueue(item, FORCED_DROP);
+            DropBeforeEnqueue(item, m_forcedDropId);
             if (m_isNs1Compat)
             {
                 m_count = 0;
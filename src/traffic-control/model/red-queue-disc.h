@@ -302,6 +302,11 @@ class RedQueueDisc : public QueueDisc
     Time m_idleTime; //!< Start of current idle period
 
     Ptr<UniformRandomVariable> m_uv; //!< rng stream
+
+    ReasonId m_unforcedMarkId; //!< Identifier of the UNFORCED_MARK reason
+    ReasonId m_unforcedDropId; //!< Identifier of the UNFORCED_DROP reason
+    ReasonId m_forcedMarkId;   //!< Identifier of the FORCED_MARK reason
+    ReasonId m_forcedDropId;   //!< Identifier of the FORCED_DROP reason
 };
 
 }; // namespace ns3
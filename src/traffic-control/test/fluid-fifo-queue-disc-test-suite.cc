@@ -0,0 +1,186 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/fluid-fifo-queue-disc.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup traffic-control-test
+ *
+ * \brief Fluid Fifo Queue Disc Test Item
+ */
+class FluidFifoQueueDiscTestItem : public QueueDiscItem
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param p the packet
+     */
+    FluidFifoQueueDiscTestItem(Ptr<Packet> p);
+
+    void AddHeader() override;
+    bool Mark() override;
+};
+
+FluidFifoQueueDiscTestItem::FluidFifoQueueDiscTestItem(Ptr<Packet> p)
+    : QueueDiscItem(p, Address(), 0)
+{
+}
+
+void
+FluidFifoQueueDiscTestItem::AddHeader()
+{
+}
+
+bool
+FluidFifoQueueDiscTestItem::Mark()
+{
+    return false;
+}
+
+/**
+ * \ingroup traffic-control-test
+ *
+ * \brief Check that the packets see the fluid backlog as queueing delay and
+ * losses, and that the fluid exceeding the buffer is dropped.
+ */
+class FluidFifoQueueDiscTestCase : public TestCase
+{
+  public:
+    FluidFifoQueueDiscTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Enqueue a packet and run the queue disc, as the traffic control layer does.
+     *
+     * \param expected Whether the packet is expected to be enqueued.
+     */
+    void Enqueue(bool expected);
+
+    /**
+     * Check the backlog and the amount of fluid dropped.
+     *
+     * \param backlog The expected backlog in bytes.
+     * \param dropped The expected amount of fluid dropped in bytes.
+     */
+    void CheckFluid(double backlog, double dropped);
+
+    Ptr<FluidFifoQueueDisc> m_queue; //!< The queue disc
+    std::vector<Time> m_sent;        //!< Times the packets have been dequeued at
+};
+
+FluidFifoQueueDiscTestCase::FluidFifoQueueDiscTestCase()
+    : TestCase("Sanity check on the fluid fifo queue disc implementation")
+{
+}
+
+void
+FluidFifoQueueDiscTestCase::Enqueue(bool expected)
+{
+    auto item = Create<FluidFifoQueueDiscTestItem>(Create<Packet>(1000));
+    NS_TEST_EXPECT_MSG_EQ(m_queue->Enqueue(item),
+                          expected,
+                          "Unexpected enqueue result at " << Simulator::Now().As(Time::MS));
+    m_queue->Run();
+}
+
+void
+FluidFifoQueueDiscTestCase::CheckFluid(double backlog, double dropped)
+{
+    NS_TEST_EXPECT_MSG_EQ_TOL(m_queue->GetBacklog(), backlog, 1e-6, "Wrong backlog");
+    NS_TEST_EXPECT_MSG_EQ_TOL(m_queue->GetQueueingDelay(),
+                              Seconds(backlog * 8 / 8e6),
+                              NanoSeconds(1),
+                              "Wrong queueing delay");
+    NS_TEST_EXPECT_MSG_EQ_TOL(m_queue->GetFluidDropped(), dropped, 1e-6, "Wrong fluid dropped");
+}
+
+void
+FluidFifoQueueDiscTestCase::DoRun()
+{
+    // the link drains one byte per microsecond
+    m_queue = CreateObjectWithAttributes<FluidFifoQueueDisc>("MaxSize",
+                                                             QueueSizeValue(QueueSize("10000B")),
+                                                             "LinkRate",
+                                                             DataRateValue(DataRate("8Mbps")));
+    m_queue->SetSendCallback([this](Ptr<QueueDiscItem>) { m_sent.push_back(Simulator::Now()); });
+    m_queue->Initialize();
+
+    // without fluid, a burst of packets is paced at the link rate
+    for (int i = 0; i < 3; i++)
+    {
+        Simulator::Schedule(Seconds(0), &FluidFifoQueueDiscTestCase::Enqueue, this, true);
+    }
+
+    // the fluid fills the buffer at one byte per microsecond, until it is
+    // full at 20 ms; from then on, the excess fluid is dropped
+    Simulator::Schedule(MilliSeconds(10),
+                        &FluidFifoQueueDisc::SetFluidRate,
+                        m_queue,
+                        DataRate("16Mbps"));
+    Simulator::Schedule(MilliSeconds(15),
+                        &FluidFifoQueueDiscTestCase::CheckFluid,
+                        this,
+                        5000,
+                        0);
+    Simulator::Schedule(MilliSeconds(25),
+                        &FluidFifoQueueDiscTestCase::CheckFluid,
+                        this,
+                        10000,
+                        5000);
+    Simulator::Schedule(MilliSeconds(25), &FluidFifoQueueDiscTestCase::Enqueue, this, false);
+    Simulator::Schedule(MilliSeconds(25),
+                        &FluidFifoQueueDisc::SetFluidRate,
+                        m_queue,
+                        DataRate("0bps"));
+
+    // the packet enqueued at 30 ms waits for the remaining fluid backlog
+    Simulator::Schedule(MilliSeconds(30),
+                        &FluidFifoQueueDiscTestCase::CheckFluid,
+                        this,
+                        5000,
+                        5000);
+    Simulator::Schedule(MilliSeconds(30), &FluidFifoQueueDiscTestCase::Enqueue, this, true);
+
+    Simulator::Run();
+
+    std::vector<Time> expected{MilliSeconds(0), MilliSeconds(1), MilliSeconds(2), MilliSeconds(35)};
+    NS_TEST_ASSERT_MSG_EQ(m_sent.size(), expected.size(), "Wrong number of packets dequeued");
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_sent[i],
+                                  expected[i],
+                                  NanoSeconds(1),
+                                  "Wrong dequeue time of packet " << i);
+    }
+    NS_TEST_EXPECT_MSG_EQ(m_queue->GetStats().nTotalDroppedPackets, 1, "Wrong number of drops");
+    NS_TEST_EXPECT_MSG_EQ_TOL(m_queue->GetFluidOffered(), 30000, 1e-6, "Wrong fluid offered");
+
+    m_queue = nullptr;
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup traffic-control-test
+ *
+ * \brief Fluid Fifo Queue Disc Test Suite
+ */
+static class FluidFifoQueueDiscTestSuite : public TestSuite
+{
+  public:
+    FluidFifoQueueDiscTestSuite()
+        : TestSuite("fluid-fifo-queue-disc", Type::UNIT)
+    {
+        AddTestCase(new FluidFifoQueueDiscTestCase(), TestCase::Duration::QUICK);
+    }
+} g_fluidFifoQueueTestSuite; ///< the test suite
@@ -13,7 +13,9 @@
 #include "ns3/simulator.h"
 #include "ns3/test.h"
 
+#include <cstring>
 #include <map>
+#include <string>
 
 using namespace ns3;
 
@@ -572,6 +574,249 @@ QueueDiscTracesTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup traffic-control-test
+ *
+ * \brief Queue Disc Test Item that can be marked
+ */
+class QdMarkTestItem : public QdTestItem
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param p the packet
+     * \param addr the address
+     */
+    QdMarkTestItem(Ptr<Packet> p, const Address& addr);
+    bool Mark() override;
+};
+
+QdMarkTestItem::QdMarkTestItem(Ptr<Packet> p, const Address& addr)
+    : QdTestItem(p, addr)
+{
+}
+
+bool
+QdMarkTestItem::Mark()
+{
+    return true;
+}
+
+/**
+ * \ingroup traffic-control-test
+ *
+ * \brief Test Queue Disc that drops the packets before enqueue and marks the
+ *        packets at dequeue for the given reasons, if any
+ */
+class TestReasonQueueDisc : public QueueDisc
+{
+  public:
+    /**
+     * Constructor
+     */
+    TestReasonQueueDisc();
+    bool DoEnqueue(Ptr<QueueDiscItem> item) override;
+    Ptr<QueueDiscItem> DoDequeue() override;
+    bool CheckConfig() override;
+    void InitializeParams() override;
+
+    const char* m_dropReason{nullptr}; //!< reason for dropping the packets before enqueue
+    const char* m_markReason{nullptr}; //!< reason for marking the packets at dequeue
+    bool m_dropById{false};            //!< drop by the identifier of the registered reason
+};
+
+TestReasonQueueDisc::TestReasonQueueDisc()
+    : QueueDisc(QueueDiscSizePolicy::SINGLE_INTERNAL_QUEUE)
+{
+}
+
+bool
+TestReasonQueueDisc::DoEnqueue(Ptr<QueueDiscItem> item)
+{
+    if (m_dropReason && m_dropById)
+    {
+        DropBeforeEnqueue(item, RegisterReason(m_dropReason));
+        return false;
+    }
+    if (m_dropReason)
+    {
+        DropBeforeEnqueue(item, m_dropReason);
+        return false;
+    }
+    return GetInternalQueue(0)->Enqueue(item);
+}
+
+Ptr<QueueDiscItem>
+TestReasonQueueDisc::DoDequeue()
+{
+    Ptr<QueueDiscItem> item = GetInternalQueue(0)->Dequeue();
+    if (item && m_markReason)
+    {
+        Mark(item, m_markReason);
+    }
+    return item;
+}
+
+bool
+TestReasonQueueDisc::CheckConfig()
+{
+    AddInternalQueue(CreateObject<DropTailQueue<QueueDiscItem>>());
+    return true;
+}
+
+void
+TestReasonQueueDisc::InitializeParams()
+{
+}
+
+/**
+ * \ingroup traffic-control-test
+ *
+ * \brief Test Parent Queue Disc having a child of type TestReasonQueueDisc
+ */
+class TestReasonParentQueueDisc : public TestParentQueueDisc
+{
+  public:
+    bool CheckConfig() override;
+};
+
+bool
+TestReasonParentQueueDisc::CheckConfig()
+{
+    Ptr<QueueDiscClass> c = CreateObject<QueueDiscClass>();
+    c->SetQueueDisc(CreateObject<TestReasonQueueDisc>());
+    AddQueueDiscClass(c);
+    return true;
+}
+
+/**
+ * \ingroup traffic-control-test
+ *
+ * \brief Queue Disc Reasons Test Case
+ *
+ * Check the packets and bytes dropped and marked for each reason reported by
+ * the statistics of a root queue disc and of its child queue disc, including
+ * the reasons composed by the root queue disc for the drops and marks of the
+ * child queue disc. The reasons are passed in a buffer whose content changes,
+ * so that the same address is used for different reasons, in distinct buffers
+ * having the same content and by the identifier of a registered reason.
+ */
+class QueueDiscReasonsTestCase : public TestCase
+{
+  public:
+    QueueDiscReasonsTestCase();
+    void DoRun() override;
+};
+
+QueueDiscReasonsTestCase::QueueDiscReasonsTestCase()
+    : TestCase("Check the statistics of the packets dropped and marked for each reason")
+{
+}
+
+void
+QueueDiscReasonsTestCase::DoRun()
+{
+    Address dest;
+    uint32_t pktSize = 100;
+
+    Ptr<QueueDisc> root = CreateObject<TestReasonParentQueueDisc>();
+    root->Initialize();
+    auto child = DynamicCast<TestReasonQueueDisc>(root->GetQueueDiscClass(0)->GetQueueDisc());
+    NS_TEST_ASSERT_MSG_NE(child, nullptr, "The child queue disc has not been created");
+
+    const std::string childDrop{QueueDisc::CHILD_QUEUE_DISC_DROP};
+    const std::string childMark{QueueDisc::CHILD_QUEUE_DISC_MARK};
+
+    // drop one packet for reason A, then two packets for reason B, using the same buffer
+    char buffer[16];
+    std::strcpy(buffer, "Reason A");
+    child->m_dropReason = buffer;
+    root->Enqueue(Create<QdTestItem>(Create<Packet>(pktSize), dest));
+    std::strcpy(buffer, "Reason B");
+    root->Enqueue(Create<QdTestItem>(Create<Packet>(pktSize), dest));
+    root->Enqueue(Create<QdTestItem>(Create<Packet>(pktSize), dest));
+
+    // drop one more packet for reason A, using a distinct buffer
+    const std::string reasonA{"Reason A"};
+    child->m_dropReason = reasonA.c_str();
+    root->Enqueue(Create<QdTestItem>(Create<Packet>(2 * pktSize), dest));
+
+    // drop one more packet for reason B, by the identifier of the reason
+    child->m_dropReason = "Reason B";
+    child->m_dropById = true;
+    root->Enqueue(Create<QdTestItem>(Create<Packet>(pktSize), dest));
+
+    auto childStats = child->GetStats();
+    auto rootStats = root->GetStats();
+    NS_TEST_EXPECT_MSG_EQ(childStats.GetNDroppedPackets("Reason A"),
+                          2,
+                          "Wrong number of packets dropped by the child for reason A");
+    NS_TEST_EXPECT_MSG_EQ(childStats.GetNDroppedBytes("Reason A"),
+                          3 * pktSize,
+                          "Wrong number of bytes dropped by the child for reason A");
+    NS_TEST_EXPECT_MSG_EQ(childStats.GetNDroppedPackets("Reason B"),
+                          3,
+                          "Wrong number of packets dropped by the child for reason B");
+    NS_TEST_EXPECT_MSG_EQ(childStats.nDroppedPacketsBeforeEnqueue.size(),
+                          2,
+                          "Unexpected reasons of the packets dropped by the child");
+    NS_TEST_EXPECT_MSG_EQ(rootStats.GetNDroppedPackets(childDrop + "Reason A"),
+                          2,
+                          "Wrong number of packets dropped by the root for reason A");
+    NS_TEST_EXPECT_MSG_EQ(rootStats.GetNDroppedBytes(childDrop + "Reason A"),
+                          3 * pktSize,
+                          "Wrong number of bytes dropped by the root for reason A");
+    NS_TEST_EXPECT_MSG_EQ(rootStats.GetNDroppedPackets(childDrop + "Reason B"),
+                          3,
+                          "Wrong number of packets dropped by the root for reason B");
+    NS_TEST_EXPECT_MSG_EQ(rootStats.nDroppedPacketsBeforeEnqueue.size(),
+                          2,
+                          "Unexpected reasons of the packets dropped by the root");
+    NS_TEST_EXPECT_MSG_EQ(rootStats.nTotalDroppedPacketsBeforeEnqueue,
+                          5,
+                          "Wrong total number of packets dropped by the root");
+
+    // enqueue three packets, then mark one for reason C and two for reason D at dequeue,
+    // using the same buffer
+    child->m_dropReason = nullptr;
+    child->m_dropById = false;
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        root->Enqueue(Create<QdMarkTestItem>(Create<Packet>(pktSize), dest));
+    }
+    std::strcpy(buffer, "Reason C");
+    child->m_markReason = buffer;
+    root->Dequeue();
+    std::strcpy(buffer, "Reason D");
+    root->Dequeue();
+    root->Dequeue();
+
+    childStats = child->GetStats();
+    rootStats = root->GetStats();
+    NS_TEST_EXPECT_MSG_EQ(childStats.GetNMarkedPackets("Reason C"),
+                          1,
+                          "Wrong number of packets marked by the child for reason C");
+    NS_TEST_EXPECT_MSG_EQ(childStats.GetNMarkedBytes("Reason D"),
+                          2 * pktSize,
+                          "Wrong number of bytes marked by the child for reason D");
+    NS_TEST_EXPECT_MSG_EQ(rootStats.GetNMarkedPackets(childMark + "Reason C"),
+                          1,
+                          "Wrong number of packets marked by the root for reason C");
+    NS_TEST_EXPECT_MSG_EQ(rootStats.GetNMarkedPackets(childMark + "Reason D"),
+                          2,
+                          "Wrong number of packets marked by the root for reason D");
+    NS_TEST_EXPECT_MSG_EQ(rootStats.nMarkedPackets.size(),
+                          2,
+                          "Unexpected reasons of the packets marked by the root");
+    // the drop statistics are unchanged
+    NS_TEST_EXPECT_MSG_EQ(rootStats.GetNDroppedPackets(childDrop + "Reason B"),
+                          3,
+                          "Wrong number of packets dropped by the root for reason B");
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup traffic-control-test
  *
@@ -584,5 +829,6 @@ static class QueueDiscTracesTestSuite : public TestSuite
         : TestSuite("queue-disc-traces", Type::UNIT)
     {
         AddTestCase(new QueueDiscTracesTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new QueueDiscReasonsTestCase(), TestCase::Duration::QUICK);
     }
 } g_queueDiscTracesTestSuite; ///< the test suite
@@ -20,6 +20,7 @@
 #include "ns3/simulator.h"
 
 #include <algorithm>
+#include <bit>
 #include <optional>
 
 namespace ns3
@@ -29,6 +30,93 @@ NS_LOG_COMPONENT_DEFINE("BlockAckManager");
 
 NS_OBJECT_ENSURE_REGISTERED(BlockAckManager);
 
+void
+BlockAckManager::InFlightMpdus::Init(std::size_t winSize)
+{
+    const auto nSlots = std::max<std::size_t>(std::bit_ceil(winSize), 64);
+    NS_ASSERT(SEQNO_SPACE_SIZE % nSlots == 0);
+    if (nSlots == m_mpdus.size())
+    {
+        return;
+    }
+
+    auto mpdus = std::move(m_mpdus);
+    m_mpdus.assign(nSlots, nullptr);
+    m_occupied.assign(nSlots / 64, 0);
+    m_nMpdus = 0;
+    for (auto& mpdu : mpdus)
+    {
+        if (mpdu)
+        {
+            Insert(std::move(mpdu));
+        }
+    }
+}
+
+std::size_t
+BlockAckManager::InFlightMpdus::GetSlot(uint16_t seqNumber) const
+{
+    return seqNumber & (m_mpdus.size() - 1);
+}
+
+Ptr<WifiMpdu>
+BlockAckManager::InFlightMpdus::Get(std::size_t slot) const
+{
+    return m_mpdus[slot];
+}
+
+void
+BlockAckManager::InFlightMpdus::Insert(Ptr<WifiMpdu> mpdu)
+{
+    const auto slot = GetSlot(mpdu->GetHeader().GetSequenceNumber());
+    NS_ASSERT_MSG(!m_mpdus[slot], "Slot " << slot << " already holds " << *m_mpdus[slot]);
+    m_mpdus[slot] = std::move(mpdu);
+    m_occupied[slot / 64] |= uint64_t{1} << (slot % 64);
+    m_nMpdus++;
+}
+
+void
+BlockAckManager::InFlightMpdus::Remove(std::size_t slot)
+{
+    NS_ASSERT(m_mpdus[slot]);
+    m_mpdus[slot] = nullptr;
+    m_occupied[slot / 64] &= ~(uint64_t{1} << (slot % 64));
+    m_nMpdus--;
+}
+
+std::size_t
+BlockAckManager::InFlightMpdus::GetNMpdus() const
+{
+    return m_nMpdus;
+}
+
+std::vector<std::size_t>
+BlockAckManager::InFlightMpdus::GetSlots(uint16_t startingSeq) const
+{
+    std::vector<std::size_t> slots;
+    slots.reserve(m_nMpdus);
+    const auto nSlots = m_mpdus.size();
+    const auto start = GetSlot(startingSeq);
+
+    for (std::size_t offset = 0; offset < nSlots && slots.size() < m_nMpdus; ++offset)
+    {
+        const auto slot = (start + offset) & (nSlots - 1);
+        // the occupied slots from the current one to the end of its word
+        const auto word = m_occupied[slot / 64] >> (slot % 64);
+        if (word == 0)
+        {
+            offset += 63 - slot % 64;
+            continue;
+        }
+        offset += std::countr_zero(word);
+        if (offset < nSlots)
+        {
+            slots.push_back((start + offset) & (nSlots - 1));
+        }
+    }
+    return slots;
+}
+
 TypeId
 BlockAckManager::GetTypeId()
 {
@@ -119,8 +207,11 @@ BlockAckManager::CreateOriginatorAgreement(const MgtAddBaRequestHeader& reqHdr,
         NS_ASSERT_MSG(existingAgreement->get().IsReset(),
                       "Existing agreement must be in RESET state");
     }
-    m_originatorAgreements.insert_or_assign({recipient, tid},
-                                            std::make_pair(std::move(agreement), PacketQueue{}));
+    InFlightMpdus inFlight;
+    inFlight.Init(agreement.GetBufferSize());
+    m_originatorAgreements.insert_or_assign(
+        {recipient, tid},
+        std::make_pair(std::move(agreement), std::move(inFlight)));
     m_blockPackets(recipient, tid);
 }
 
@@ -151,6 +242,7 @@ BlockAckManager::UpdateOriginatorAgreement(const MgtAddBaResponseHeader& respHdr
         agreement.SetAmsduSupport(respHdr.IsAmsduSupported());
         agreement.SetStartingSequence(startingSeq);
         agreement.InitTxWindow();
+        it->second.second.Init(agreement.GetBufferSize());
         if (respHdr.IsImmediateBlockAck())
         {
             agreement.SetImmediateBlockAck();
@@ -245,30 +337,32 @@ BlockAckManager::StorePacket(Ptr<WifiMpdu> mpdu)
         return;
     }
 
-    // store the packet and keep the list sorted in increasing order of sequence number
-    // with respect to the starting sequence number
-    auto it = agreementIt->second.second.rbegin();
-    while (it != agreementIt->second.second.rend())
-    {
-        if (mpdu->GetHeader().GetSequenceControl() == (*it)->GetHeader().GetSequenceControl())
-        {
-            NS_LOG_DEBUG("Packet already in the queue of the BA agreement");
-            return;
-        }
+    auto& inFlight = agreementIt->second.second;
+    const auto slot = inFlight.GetSlot(mpdu->GetHeader().GetSequenceNumber());
 
-        uint16_t dist =
-            agreementIt->second.first.GetDistance((*it)->GetHeader().GetSequenceNumber());
+    if (auto stored = inFlight.Get(slot); stored && mpdu->GetHeader().GetSequenceControl() ==
+                                                        stored->GetHeader().GetSequenceControl())
+    {
+        NS_LOG_DEBUG("Packet already in the queue of the BA agreement");
+        return;
+    }
 
-        if (mpduDist > dist || (mpduDist == dist && mpdu->GetHeader().GetFragmentNumber() >
-                                                        (*it)->GetHeader().GetFragmentNumber()))
-        {
-            break;
-        }
+    agreementIt->second.first.NotifyTransmittedMpdu(mpdu);
 
-        it++;
+    if (auto stored = inFlight.Get(slot);
+        stored && stored->GetHeader().GetSequenceNumber() != mpdu->GetHeader().GetSequenceNumber())
+    {
+        // the transmit window includes the given MPDU, hence the MPDU stored in the same
+        // slot (whose sequence number differs by a multiple of the number of slots) is old
+        HandleInFlightMpdu(SINGLE_LINK_OP_ID, slot, STAY_INFLIGHT, agreementIt, Simulator::Now());
     }
-    agreementIt->second.second.insert(it.base(), mpdu);
-    agreementIt->second.first.NotifyTransmittedMpdu(mpdu);
+    if (auto stored = inFlight.Get(slot))
+    {
+        // the stored MPDU (e.g., a previous fragment of the same MSDU) is no longer in flight
+        NS_LOG_DEBUG("Replacing " << *stored);
+        inFlight.Remove(slot);
+    }
+    inFlight.Insert(mpdu);
 }
 
 uint32_t
@@ -280,7 +374,7 @@ BlockAckManager::GetNBufferedPackets(const Mac48Address& recipient, uint8_t tid)
     {
         return 0;
     }
-    return it->second.second.size();
+    return it->second.second.GetNMpdus();
 }
 
 void
@@ -290,30 +384,34 @@ BlockAckManager::SetBlockAckThreshold(uint8_t nPackets)
     m_blockAckThreshold = nPackets;
 }
 
-BlockAckManager::PacketQueueI
+void
 BlockAckManager::HandleInFlightMpdu(uint8_t linkId,
-                                    PacketQueueI mpduIt,
+                                    std::size_t slot,
                                     MpduStatus status,
                                     const OriginatorAgreementsI& it,
                                     const Time& now)
 {
-    NS_LOG_FUNCTION(this << linkId << **mpduIt << +static_cast<uint8_t>(status));
+    auto& inFlight = it->second.second;
+    auto mpdu = inFlight.Get(slot);
+    NS_LOG_FUNCTION(this << linkId << *mpdu << +static_cast<uint8_t>(status));
 
-    if (!(*mpduIt)->IsQueued())
+    if (!mpdu->IsQueued())
     {
         // MPDU is not in the EDCA queue (e.g., its lifetime expired and it was
-        // removed by another method), remove from the queue of in flight MPDUs
+        // removed by another method), remove from the set of in flight MPDUs
         NS_LOG_DEBUG("MPDU is not stored in the EDCA queue, drop MPDU");
-        return it->second.second.erase(mpduIt);
+        inFlight.Remove(slot);
+        return;
     }
 
     if (status == ACKNOWLEDGED)
     {
         // the MPDU has to be dequeued from the EDCA queue
-        return it->second.second.erase(mpduIt);
+        inFlight.Remove(slot);
+        return;
     }
 
-    const WifiMacHeader& hdr = (*mpduIt)->GetHeader();
+    const WifiMacHeader& hdr = mpdu->GetHeader();
 
     NS_ASSERT(hdr.GetAddr1() == it->first.first);
     NS_ASSERT(hdr.IsQosData() && hdr.GetQosTid() == it->first.second);
@@ -322,37 +420,32 @@ BlockAckManager::HandleInFlightMpdu(uint8_t linkId,
     {
         NS_LOG_DEBUG("Old packet. Remove from the EDCA queue, too");
         NS_ASSERT(!m_droppedOldMpduCallback.IsNull());
-        m_droppedOldMpduCallback(*mpduIt);
-        m_queue->Remove(*mpduIt);
-        return it->second.second.erase(mpduIt);
-    }
-
-    std::optional<PacketQueueI> prevIt;
-    if (mpduIt != it->second.second.begin())
-    {
-        prevIt = std::prev(mpduIt);
+        m_droppedOldMpduCallback(mpdu);
+        m_queue->Remove(mpdu);
+        inFlight.Remove(slot);
+        return;
     }
 
-    if (m_queue->TtlExceeded(*mpduIt, now))
+    if (m_queue->TtlExceeded(mpdu, now))
     {
         // WifiMacQueue::TtlExceeded() has removed the MPDU from the EDCA queue
         // and fired the Expired trace source, which called NotifyDiscardedMpdu,
-        // which removed this MPDU (and possibly others) from the in flight queue as well
+        // which removed this MPDU (and possibly others) from the in flight MPDUs as well
         NS_LOG_DEBUG("MSDU lifetime expired, drop MPDU");
-        return (prevIt.has_value() ? std::next(prevIt.value()) : it->second.second.begin());
+        return;
     }
 
     if (status == STAY_INFLIGHT)
     {
         // the MPDU has to stay in flight, do nothing
-        return ++mpduIt;
+        return;
     }
 
     NS_ASSERT(status == TO_RETRANSMIT);
-    (*mpduIt)->GetHeader().SetRetry();
-    (*mpduIt)->ResetInFlight(linkId); // no longer in flight; will be if retransmitted
+    mpdu->GetHeader().SetRetry();
+    mpdu->ResetInFlight(linkId); // no longer in flight; will be if retransmitted
 
-    return it->second.second.erase(mpduIt);
+    inFlight.Remove(slot);
 }
 
 void
@@ -370,15 +463,13 @@ BlockAckManager::NotifyGotAck(uint8_t linkId, Ptr<const WifiMpdu> mpdu)
 
     it->second.first.NotifyAckedMpdu(mpdu);
 
-    // remove the acknowledged frame from the queue of outstanding packets
-    for (auto queueIt = it->second.second.begin(); queueIt != it->second.second.end(); ++queueIt)
+    // remove the acknowledged frame from the outstanding packets
+    const auto slot = it->second.second.GetSlot(mpdu->GetHeader().GetSequenceNumber());
+    if (auto stored = it->second.second.Get(slot);
+        stored && stored->GetHeader().GetSequenceNumber() == mpdu->GetHeader().GetSequenceNumber())
     {
-        if ((*queueIt)->GetHeader().GetSequenceNumber() == mpdu->GetHeader().GetSequenceNumber())
-        {
-            m_queue->DequeueIfQueued({*queueIt});
-            HandleInFlightMpdu(linkId, queueIt, ACKNOWLEDGED, it, Simulator::Now());
-            break;
-        }
+        m_queue->DequeueIfQueued({stored});
+        HandleInFlightMpdu(linkId, slot, ACKNOWLEDGED, it, Simulator::Now());
     }
 }
 
@@ -395,15 +486,13 @@ BlockAckManager::NotifyMissedAck(uint8_t linkId, Ptr<WifiMpdu> mpdu)
     NS_ASSERT(it != m_originatorAgreements.end());
     NS_ASSERT(it->second.first.IsEstablished());
 
-    // remove the frame from the queue of outstanding packets (it will be re-inserted
+    // remove the frame from the outstanding packets (it will be re-inserted
     // if retransmitted)
-    for (auto queueIt = it->second.second.begin(); queueIt != it->second.second.end(); ++queueIt)
+    const auto slot = it->second.second.GetSlot(mpdu->GetHeader().GetSequenceNumber());
+    if (auto stored = it->second.second.Get(slot);
+        stored && stored->GetHeader().GetSequenceNumber() == mpdu->GetHeader().GetSequenceNumber())
     {
-        if ((*queueIt)->GetHeader().GetSequenceNumber() == mpdu->GetHeader().GetSequenceNumber())
-        {
-            HandleInFlightMpdu(linkId, queueIt, TO_RETRANSMIT, it, Simulator::Now());
-            break;
-        }
+        HandleInFlightMpdu(linkId, slot, TO_RETRANSMIT, it, Simulator::Now());
     }
 }
 
@@ -452,24 +541,28 @@ BlockAckManager::NotifyGotBlockAck(uint8_t linkId,
     Time now = Simulator::Now();
     std::list<Ptr<const WifiMpdu>> acked;
 
-    for (auto queueIt = it->second.second.begin(); queueIt != it->second.second.end();)
+    auto& inFlight = it->second.second;
+    const auto slots = inFlight.GetSlots(it->second.first.GetStartingSequence());
+
+    for (const auto slot : slots)
     {
-        uint16_t currentSeq = (*queueIt)->GetHeader().GetSequenceNumber();
+        auto mpdu = inFlight.Get(slot);
+        if (!mpdu)
+        {
+            continue; // removed while handling another MPDU
+        }
+        uint16_t currentSeq = mpdu->GetHeader().GetSequenceNumber();
         NS_LOG_DEBUG("Current seq=" << currentSeq);
         if (blockAck.IsPacketReceived(currentSeq, index))
         {
-            it->second.first.NotifyAckedMpdu(*queueIt);
+            it->second.first.NotifyAckedMpdu(mpdu);
             nSuccessfulMpdus++;
             if (!m_txOkCallback.IsNull())
             {
-                m_txOkCallback(*queueIt);
+                m_txOkCallback(mpdu);
             }
-            acked.emplace_back(*queueIt);
-            queueIt = HandleInFlightMpdu(linkId, queueIt, ACKNOWLEDGED, it, now);
-        }
-        else
-        {
-            ++queueIt;
+            acked.emplace_back(mpdu);
+            HandleInFlightMpdu(linkId, slot, ACKNOWLEDGED, it, now);
         }
     }
 
@@ -477,24 +570,30 @@ BlockAckManager::NotifyGotBlockAck(uint8_t linkId,
     m_queue->DequeueIfQueued(acked);
 
     // Remaining outstanding MPDUs have not been acknowledged
-    for (auto queueIt = it->second.second.begin(); queueIt != it->second.second.end();)
+    for (const auto slot : slots)
     {
+        auto mpdu = inFlight.Get(slot);
+        if (!mpdu)
+        {
+            continue; // acknowledged or removed while handling another MPDU
+        }
+
         // transmission actually failed if the MPDU is inflight only on the same link on
         // which we received the BlockAck frame
-        auto linkIds = (*queueIt)->GetInFlightLinkIds();
+        auto linkIds = mpdu->GetInFlightLinkIds();
 
         if (linkIds.size() == 1 && *linkIds.begin() == linkId)
         {
             nFailedMpdus++;
             if (!m_txFailedCallback.IsNull())
             {
-                m_txFailedCallback(*queueIt);
+                m_txFailedCallback(mpdu);
             }
-            queueIt = HandleInFlightMpdu(linkId, queueIt, TO_RETRANSMIT, it, now);
+            HandleInFlightMpdu(linkId, slot, TO_RETRANSMIT, it, now);
             continue;
         }
 
-        queueIt = HandleInFlightMpdu(linkId, queueIt, STAY_INFLIGHT, it, now);
+        HandleInFlightMpdu(linkId, slot, STAY_INFLIGHT, it, now);
     }
 
     return {nSuccessfulMpdus, nFailedMpdus};
@@ -513,18 +612,24 @@ BlockAckManager::NotifyMissedBlockAck(uint8_t linkId, const Mac48Address& recipi
 
     Time now = Simulator::Now();
 
-    // remove all packets from the queue of outstanding packets (they will be
+    // remove all packets from the outstanding packets (they will be
     // re-inserted if retransmitted)
-    for (auto mpduIt = it->second.second.begin(); mpduIt != it->second.second.end();)
+    auto& inFlight = it->second.second;
+    for (const auto slot : inFlight.GetSlots(it->second.first.GetStartingSequence()))
     {
+        auto mpdu = inFlight.Get(slot);
+        if (!mpdu)
+        {
+            continue; // removed while handling another MPDU
+        }
         // MPDUs that were transmitted on another link shall stay inflight
-        auto linkIds = (*mpduIt)->GetInFlightLinkIds();
+        auto linkIds = mpdu->GetInFlightLinkIds();
         if (!linkIds.contains(linkId))
         {
-            mpduIt = HandleInFlightMpdu(linkId, mpduIt, STAY_INFLIGHT, it, now);
+            HandleInFlightMpdu(linkId, slot, STAY_INFLIGHT, it, now);
             continue;
         }
-        mpduIt = HandleInFlightMpdu(linkId, mpduIt, TO_RETRANSMIT, it, now);
+        HandleInFlightMpdu(linkId, slot, TO_RETRANSMIT, it, now);
     }
 }
 
@@ -564,24 +669,23 @@ BlockAckManager::NotifyDiscardedMpdu(Ptr<const WifiMpdu> mpdu)
     // actually advance the transmit window
     it->second.first.NotifyDiscardedMpdu(mpdu);
 
-    // remove old MPDUs from the EDCA queue and from the in flight queue
+    // remove old MPDUs from the EDCA queue and from the in flight MPDUs
     // (including the given MPDU which became old after advancing the transmit window)
-    for (auto mpduIt = it->second.second.begin(); mpduIt != it->second.second.end();)
+    auto& inFlight = it->second.second;
+    for (const auto slot : inFlight.GetSlots(it->second.first.GetStartingSequence()))
     {
-        if (it->second.first.GetDistance((*mpduIt)->GetHeader().GetSequenceNumber()) >=
-            SEQNO_SPACE_HALF_SIZE)
+        auto inFlightMpdu = inFlight.Get(slot);
+        if (inFlightMpdu &&
+            it->second.first.GetDistance(inFlightMpdu->GetHeader().GetSequenceNumber()) >=
+                SEQNO_SPACE_HALF_SIZE)
         {
-            NS_LOG_DEBUG("Dropping old MPDU: " << **mpduIt);
-            m_queue->DequeueIfQueued({*mpduIt});
+            NS_LOG_DEBUG("Dropping old MPDU: " << *inFlightMpdu);
+            m_queue->DequeueIfQueued({inFlightMpdu});
             if (!m_droppedOldMpduCallback.IsNull())
             {
-                m_droppedOldMpduCallback(*mpduIt);
+                m_droppedOldMpduCallback(inFlightMpdu);
             }
-            mpduIt = it->second.second.erase(mpduIt);
-        }
-        else
-        {
-            break; // MPDUs are in increasing order of sequence number in the in flight queue
+            inFlight.Remove(slot);
         }
     }
 
@@ -800,12 +904,18 @@ BlockAckManager::NeedBarRetransmission(uint8_t tid, const Mac48Address& recipien
     Time now = Simulator::Now();
 
     // A BAR needs to be retransmitted if there is at least a non-expired in flight MPDU
-    for (auto mpduIt = it->second.second.begin(); mpduIt != it->second.second.end();)
+    auto& inFlight = it->second.second;
+    for (const auto slot : inFlight.GetSlots(it->second.first.GetStartingSequence()))
     {
+        if (!inFlight.Get(slot))
+        {
+            continue; // removed while handling another MPDU
+        }
+
         // remove MPDU if old or with expired lifetime
-        mpduIt = HandleInFlightMpdu(SINGLE_LINK_OP_ID, mpduIt, STAY_INFLIGHT, it, now);
+        HandleInFlightMpdu(SINGLE_LINK_OP_ID, slot, STAY_INFLIGHT, it, now);
 
-        if (mpduIt != it->second.second.begin())
+        if (inFlight.Get(slot))
         {
             // the MPDU has not been removed
             return true;
@@ -22,6 +22,7 @@
 
 #include <map>
 #include <optional>
+#include <vector>
 
 namespace ns3
 {
@@ -441,17 +442,67 @@ class BlockAckManager : public Object
     void InactivityTimeout(const Mac48Address& recipient, uint8_t tid);
 
     /**
-     * typedef for a list of WifiMpdu.
+     * The MPDUs in flight for an originator block ack agreement, kept in a ring of
+     * slots indexed by sequence number modulo the number of slots. The number of
+     * slots is a power of two (hence a divisor of the size of the sequence number
+     * space) that is not less than the size of the transmit window, so that the
+     * MPDUs within the transmit window are stored in distinct slots. A bitmap of
+     * the occupied slots allows to skip the empty slots 64 at a time.
      */
-    typedef std::list<Ptr<WifiMpdu>> PacketQueue;
-    /**
-     * typedef for an iterator for PacketQueue.
-     */
-    typedef std::list<Ptr<WifiMpdu>>::iterator PacketQueueI;
+    class InFlightMpdus
+    {
+      public:
+        /**
+         * Set the number of slots based on the given size of the transmit window.
+         * The MPDUs already stored are moved to their slot in the resized ring.
+         *
+         * \param winSize the size of the transmit window
+         */
+        void Init(std::size_t winSize);
+        /**
+         * \param seqNumber the given sequence number
+         * \return the slot for the MPDUs having the given sequence number
+         */
+        std::size_t GetSlot(uint16_t seqNumber) const;
+        /**
+         * \param slot the given slot
+         * \return the MPDU stored in the given slot, if any, or a null pointer
+         */
+        Ptr<WifiMpdu> Get(std::size_t slot) const;
+        /**
+         * Store the given MPDU in the slot for its sequence number, which must be empty.
+         *
+         * \param mpdu the given MPDU
+         */
+        void Insert(Ptr<WifiMpdu> mpdu);
+        /**
+         * Remove the MPDU stored in the given slot.
+         *
+         * \param slot the given slot
+         */
+        void Remove(std::size_t slot);
+        /**
+         * \return the number of MPDUs stored
+         */
+        std::size_t GetNMpdus() const;
+        /**
+         * Get the occupied slots, in increasing order of distance from the slot for
+         * the given starting sequence number.
+         *
+         * \param startingSeq the given starting sequence number
+         * \return the occupied slots
+         */
+        std::vector<std::size_t> GetSlots(uint16_t startingSeq) const;
+
+      private:
+        std::vector<Ptr<WifiMpdu>> m_mpdus; //!< the MPDUs in flight, indexed by slot
+        std::vector<uint64_t> m_occupied;   //!< bitmap of the occupied slots
+        std::size_t m_nMpdus{0};            //!< number of MPDUs stored
+    };
 
     /// AgreementKey-indexed map of originator block ack agreements
     using OriginatorAgreements =
-        std::map<AgreementKey, std::pair<OriginatorBlockAckAgreement, PacketQueue>>;
+        std::map<AgreementKey, std::pair<OriginatorBlockAckAgreement, InFlightMpdus>>;
     /// typedef for an iterator for Agreements
     using OriginatorAgreementsI = OriginatorAgreements::iterator;
 
@@ -460,24 +511,23 @@ class BlockAckManager : public Object
 
     /**
      * Handle the given in flight MPDU based on its given status. If the status is
-     * ACKNOWLEDGED, the MPDU is removed from both the EDCA queue and the queue of
+     * ACKNOWLEDGED, the MPDU is removed from both the EDCA queue and the set of
      * in flight MPDUs. If the status is TO_RETRANSMIT, the MPDU is only removed
-     * from the queue of in flight MPDUs. Note that the MPDU is removed from both
-     * queues (independently of the status) if the MPDU is not stored in the EDCA
+     * from the set of in flight MPDUs. Note that the MPDU is removed from both
+     * (independently of the status) if the MPDU is not stored in the EDCA
      * queue, is an old packet or its lifetime expired.
      *
      * \param linkId the ID of the link on which the MPDU has been transmitted
-     * \param mpduIt an iterator pointing to the MPDU in the queue of in flight MPDUs
+     * \param slot the slot holding the MPDU in the set of in flight MPDUs
      * \param status the status of the in flight MPDU
      * \param it iterator pointing to the Block Ack agreement
      * \param now the current time
-     * \return an iterator pointing to the next MPDU in the queue of in flight MPDUs
      */
-    PacketQueueI HandleInFlightMpdu(uint8_t linkId,
-                                    PacketQueueI mpduIt,
-                                    MpduStatus status,
-                                    const OriginatorAgreementsI& it,
-                                    const Time& now);
+    void HandleInFlightMpdu(uint8_t linkId,
+                            std::size_t slot,
+                            MpduStatus status,
+                            const OriginatorAgreementsI& it,
+                            const Time& now);
 
     /**
      * This data structure contains, for each originator block ack agreement (recipient, TID),
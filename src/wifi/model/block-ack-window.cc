@@ -12,6 +12,9 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+#include <bit>
+
 namespace ns3
 {
 
@@ -19,6 +22,7 @@ NS_LOG_COMPONENT_DEFINE("BlockAckWindow");
 
 BlockAckWindow::BlockAckWindow()
     : m_winStart(0),
+      m_winSize(0),
       m_head(0)
 {
 }
@@ -28,14 +32,15 @@ BlockAckWindow::Init(uint16_t winStart, uint16_t winSize)
 {
     NS_LOG_FUNCTION(this << winStart << winSize);
     m_winStart = winStart;
-    m_window.assign(winSize, false);
+    m_winSize = winSize;
+    m_window.assign((winSize + 63) / 64, 0);
     m_head = 0;
 }
 
 void
 BlockAckWindow::Reset(uint16_t winStart)
 {
-    Init(winStart, m_window.size());
+    Init(winStart, m_winSize);
 }
 
 uint16_t
@@ -47,29 +52,84 @@ BlockAckWindow::GetWinStart() const
 uint16_t
 BlockAckWindow::GetWinEnd() const
 {
-    return (m_winStart + m_window.size() - 1) % SEQNO_SPACE_SIZE;
+    return (m_winStart + m_winSize - 1) % SEQNO_SPACE_SIZE;
 }
 
 std::size_t
 BlockAckWindow::GetWinSize() const
 {
-    return m_window.size();
+    return m_winSize;
 }
 
-std::vector<bool>::reference
-BlockAckWindow::At(std::size_t distance)
+bool
+BlockAckWindow::At(std::size_t distance) const
 {
-    NS_ASSERT(distance < m_window.size());
+    NS_ASSERT(distance < m_winSize);
 
-    return m_window.at((m_head + distance) % m_window.size());
+    const auto pos = (m_head + distance) % (64 * m_window.size());
+    return (m_window[pos / 64] >> (pos % 64)) & 1;
 }
 
-std::vector<bool>::const_reference
-BlockAckWindow::At(std::size_t distance) const
+void
+BlockAckWindow::Set(std::size_t distance)
+{
+    NS_ASSERT(distance < m_winSize);
+
+    const auto pos = (m_head + distance) % (64 * m_window.size());
+    m_window[pos / 64] |= uint64_t{1} << (pos % 64);
+}
+
+uint64_t
+BlockAckWindow::GetWord(std::size_t distance) const
 {
-    NS_ASSERT(distance < m_window.size());
+    NS_ASSERT(distance < m_winSize);
+
+    const auto pos = (m_head + distance) % (64 * m_window.size());
+    const auto index = pos / 64;
+    const auto offset = pos % 64;
 
-    return m_window.at((m_head + distance) % m_window.size());
+    uint64_t word = m_window[index] >> offset;
+    if (offset > 0)
+    {
+        word |= m_window[(index + 1) % m_window.size()] << (64 - offset);
+    }
+    // the bits beyond the end of the window may wrap around to its beginning
+    if (const auto remaining = m_winSize - distance; remaining < 64)
+    {
+        word &= (uint64_t{1} << remaining) - 1;
+    }
+    return word;
+}
+
+std::size_t
+BlockAckWindow::GetNLeadingSet() const
+{
+    std::size_t count = 0;
+    while (count < m_winSize)
+    {
+        const auto ones = static_cast<std::size_t>(std::countr_one(GetWord(count)));
+        count += ones;
+        if (ones < 64)
+        {
+            break;
+        }
+    }
+    return count;
+}
+
+void
+BlockAckWindow::Clear(std::size_t pos, std::size_t count)
+{
+    const auto size = 64 * m_window.size();
+    while (count > 0)
+    {
+        const auto offset = pos % 64;
+        const auto n = std::min(count, 64 - offset);
+        const auto mask = (n == 64 ? ~uint64_t{0} : ((uint64_t{1} << n) - 1)) << offset;
+        m_window[pos / 64] &= ~mask;
+        pos = (pos + n) % size;
+        count -= n;
+    }
 }
 
 void
@@ -77,17 +137,14 @@ BlockAckWindow::Advance(std::size_t count)
 {
     NS_LOG_FUNCTION(this << count);
 
-    if (count >= m_window.size())
+    if (count >= m_winSize)
     {
         Reset((m_winStart + count) % SEQNO_SPACE_SIZE);
         return;
     }
 
-    for (std::size_t i = 0; i < count; i++)
-    {
-        m_window[m_head] = false;
-        m_head = (m_head + 1) % m_window.size();
-    }
+    Clear(m_head, count);
+    m_head = (m_head + count) % (64 * m_window.size());
     m_winStart = (m_winStart + count) % SEQNO_SPACE_SIZE;
 }
 
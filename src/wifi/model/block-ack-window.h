@@ -24,10 +24,13 @@ namespace ns3
  * a given number of positions. This class can be used to implement both
  * an originator's window and a recipient's window.
  *
- * The window is implemented as a vector of bool and managed as a circular
- * queue. The window is moved forward by advancing the head of the queue and
- * clearing the elements that become part of the tail of the queue. Hence,
- * no element is required to be shifted when the window moves forward.
+ * The window is implemented as a bitmap stored in 64-bit words and managed as
+ * a circular queue. The window is moved forward by advancing the head of the
+ * queue and clearing the elements that become part of the tail of the queue.
+ * Hence, no element is required to be shifted when the window moves forward.
+ * The elements of the window can also be read 64 at a time, which allows to
+ * process the window (e.g., to fill the bitmap of a BlockAck frame or to find
+ * the first element that is not set) a word at a time.
  *
  * Example:
  *
@@ -83,25 +86,38 @@ class BlockAckWindow
      */
     std::size_t GetWinSize() const;
     /**
-     * Get a reference to the element in the window having the given distance from
+     * Get the value of the element in the window having the given distance from
      * the current winStart. Note that the given distance must be less than the
      * window size.
      *
      * \param distance the given distance
-     * \return a reference to the element in the window having the given distance
+     * \return the value of the element in the window having the given distance
      *         from the current winStart
      */
-    std::vector<bool>::reference At(std::size_t distance);
+    bool At(std::size_t distance) const;
     /**
-     * Get a const reference to the element in the window having the given distance from
-     * the current winStart. Note that the given distance must be less than the
-     * window size.
+     * Set the element in the window having the given distance from the current
+     * winStart. Note that the given distance must be less than the window size.
      *
      * \param distance the given distance
-     * \return a const reference to the element in the window having the given distance
-     *         from the current winStart
      */
-    std::vector<bool>::const_reference At(std::size_t distance) const;
+    void Set(std::size_t distance);
+    /**
+     * Get the values of the 64 elements in the window starting at the given distance
+     * from the current winStart. Bit i of the returned word holds the value of the
+     * element having distance equal to the given distance plus i; the bits
+     * corresponding to positions beyond the end of the window are zero. Note that
+     * the given distance must be less than the window size.
+     *
+     * \param distance the given distance
+     * \return the values of the 64 elements starting at the given distance
+     */
+    uint64_t GetWord(std::size_t distance) const;
+    /**
+     * \return the number of consecutive elements that are set, starting from the
+     *         current winStart
+     */
+    std::size_t GetNLeadingSet() const;
     /**
      * Advance the current winStart by the given number of positions.
      *
@@ -110,9 +126,19 @@ class BlockAckWindow
     void Advance(std::size_t count);
 
   private:
-    uint16_t m_winStart;        ///< window start (sequence number)
-    std::vector<bool> m_window; ///< window
-    std::size_t m_head;         ///< index of winStart in the vector
+    /**
+     * Clear the given number of consecutive bits of the bitmap, starting at the
+     * given position (and wrapping around the end of the bitmap).
+     *
+     * \param pos the position of the first bit to clear
+     * \param count the number of bits to clear
+     */
+    void Clear(std::size_t pos, std::size_t count);
+
+    uint16_t m_winStart;            ///< window start (sequence number)
+    std::size_t m_winSize;          ///< window size
+    std::vector<uint64_t> m_window; ///< bitmap holding the window
+    std::size_t m_head;             ///< index of the bit of winStart in the bitmap
 };
 
 } // namespace ns3
@@ -9,21 +9,55 @@
 #include "error-rate-model.h"
 
 #include "wifi-tx-vector.h"
+#include "wifi-utils.h"
 
+#include "ns3/double.h"
 #include "ns3/dsss-error-rate-model.h"
 
+#include <bit>
+#include <cmath>
+#include <limits>
+
 namespace ns3
 {
 
+static const dB_u SNR_GRID_MIN{-20}; //!< lowest SNR of the grids of SNR values
+static const dB_u SNR_GRID_MAX{60};  //!< highest SNR of the grids of SNR values
+
 NS_OBJECT_ENSURE_REGISTERED(ErrorRateModel);
 
 TypeId
 ErrorRateModel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::ErrorRateModel").SetParent<Object>().SetGroupName("Wifi");
+    static TypeId tid =
+        TypeId("ns3::ErrorRateModel")
+            .SetParent<Object>()
+            .SetGroupName("Wifi")
+            .AddAttribute("SnrGridStep",
+                          "The step (dB) of the grid of SNR values on which the success rates "
+                          "per bit are precomputed, from which the success rates of the chunks "
+                          "of the PPDUs are interpolated. Zero to compute the success rate of "
+                          "every chunk from scratch.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&ErrorRateModel::SetSnrGridStep,
+                                             &ErrorRateModel::GetSnrGridStep),
+                          MakeDoubleChecker<dB_u>(0));
     return tid;
 }
 
+void
+ErrorRateModel::SetSnrGridStep(dB_u step)
+{
+    m_snrGridStep = step;
+    m_snrGrids.clear();
+}
+
+dB_u
+ErrorRateModel::GetSnrGridStep() const
+{
+    return m_snrGridStep;
+}
+
 double
 ErrorRateModel::CalculateSnr(const WifiTxVector& txVector, double ber) const
 {
@@ -83,6 +117,120 @@ ErrorRateModel::GetChunkSuccessRate(WifiMode mode,
     return 0;
 }
 
+double
+ErrorRateModel::GetChunksSuccessRate(WifiMode mode,
+                                     const WifiTxVector& txVector,
+                                     const std::vector<std::pair<double, uint64_t>>& chunks,
+                                     uint8_t numRxAntennas,
+                                     WifiPpduField field,
+                                     uint16_t staId) const
+{
+    uint64_t totalBits = 0;
+    for (const auto& chunk : chunks)
+    {
+        totalBits += chunk.second;
+    }
+    if (m_snrGridStep <= 0 || totalBits == 0 ||
+        mode.GetModulationClass() == WIFI_MOD_CLASS_DSSS ||
+        mode.GetModulationClass() == WIFI_MOD_CLASS_HR_DSSS)
+    {
+        double psr = 1.0;
+        for (const auto& [snr, nbits] : chunks)
+        {
+            psr *= GetChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+        }
+        return psr;
+    }
+
+    const auto header =
+        (txVector.IsMu() && (staId == SU_STA_ID)) || (mode != txVector.GetMode(staId));
+    const auto sizeLog = static_cast<uint8_t>(std::bit_width(totalBits) - 1);
+    auto [it, inserted] = m_snrGrids.try_emplace({mode.GetUid(),
+                                                  header ? 0 : mode.GetDataRate(txVector, staId),
+                                                  txVector.GetChannelWidth(),
+                                                  txVector.IsLdpc(),
+                                                  numRxAntennas,
+                                                  field,
+                                                  sizeLog});
+    auto& grid = it->second;
+    if (inserted)
+    {
+        grid.assign(std::lround((SNR_GRID_MAX - SNR_GRID_MIN) / m_snrGridStep) + 1,
+                    std::numeric_limits<double>::quiet_NaN());
+    }
+
+    // the success rate of the chunks out of the grid is computed from scratch
+    double psr = 1.0;
+    // sum of the logarithms of the success rates of the chunks on the grid
+    double logPsr = 0.0;
+    for (const auto& [snr, nbits] : chunks)
+    {
+        if (nbits == 0)
+        {
+            // a success rate per bit of zero would give 0 * inf
+            continue;
+        }
+        const auto position = (RatioToDb(snr) - SNR_GRID_MIN) / m_snrGridStep;
+        if (!(position >= 0) || position >= static_cast<double>(grid.size() - 1))
+        {
+            psr *= GetChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+            continue;
+        }
+        const auto i = static_cast<std::size_t>(position);
+        for (auto j : {i, i + 1})
+        {
+            if (std::isnan(grid[j]))
+            {
+                grid[j] = ComputeSnrGridPoint(mode,
+                                              txVector,
+                                              SNR_GRID_MIN + j * m_snrGridStep,
+                                              uint64_t{1} << sizeLog,
+                                              numRxAntennas,
+                                              field,
+                                              staId);
+            }
+        }
+        // the negated logarithm of the success rate per bit is about exponential in the SNR
+        // (dB), hence its logarithm is interpolated linearly
+        const auto a = grid[i];
+        const auto b = grid[i + 1];
+        const auto t = position - i;
+        const auto logErrorRate = (std::isfinite(a) && std::isfinite(b)) ? a + t * (b - a)
+                                  : (t < 0.5)                             ? a
+                                                                          : b;
+        logPsr -= nbits * std::exp(logErrorRate);
+    }
+    return psr * std::exp(logPsr);
+}
+
+double
+ErrorRateModel::ComputeSnrGridPoint(WifiMode mode,
+                                    const WifiTxVector& txVector,
+                                    dB_u snr,
+                                    uint64_t nbits,
+                                    uint8_t numRxAntennas,
+                                    WifiPpduField field,
+                                    uint16_t staId) const
+{
+    // halve the chunk until its success rate does not underflow
+    double csr = 0;
+    for (; nbits > 0; nbits /= 2)
+    {
+        csr = GetChunkSuccessRate(mode,
+                                  txVector,
+                                  DbToRatio(snr),
+                                  nbits,
+                                  numRxAntennas,
+                                  field,
+                                  staId);
+        if (csr > 0 || nbits == 1)
+        {
+            break;
+        }
+    }
+    return std::log(-std::log(csr) / nbits);
+}
+
 bool
 ErrorRateModel::IsAwgn() const
 {
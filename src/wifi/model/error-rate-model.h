@@ -10,9 +10,15 @@
 #define ERROR_RATE_MODEL_H
 
 #include "wifi-mode.h"
+#include "wifi-units.h"
 
 #include "ns3/object.h"
 
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 namespace ns3
 {
 
@@ -81,6 +87,50 @@ class ErrorRateModel : public Object
                                WifiPpduField field = WIFI_PPDU_FIELD_DATA,
                                uint16_t staId = SU_STA_ID) const;
 
+    /**
+     * This method returns the probability that the given chunks of a
+     * packet, all transmitted with the given mode, will be successfully
+     * received by the PHY, i.e., the product of the success rates of the
+     * chunks.
+     *
+     * If the SnrGridStep attribute is positive, the success rates of the
+     * chunks are interpolated from success rates per bit precomputed (once per
+     * mode, TXVECTOR parameters and size of the chunks) on a grid of SNR
+     * values in dB, rather than computed from scratch for each chunk. This
+     * assumes that the success rate of a chunk is the success rate per bit to
+     * the power of the number of bits, which holds for the Yans and NIST
+     * models, and approximately for the table-based model.
+     *
+     * \param mode the Wi-Fi mode applicable to the chunks
+     * \param txVector TXVECTOR of the overall transmission
+     * \param chunks the (SNR, number of bits) pairs of the chunks
+     * \param numRxAntennas the number of active RX antennas (1 if not provided)
+     * \param field the PPDU field to which the chunks belong to (assumes this is for the payload
+     * part if not provided)
+     * \param staId the station ID for MU
+     *
+     * \return probability of successfully receiving all the chunks
+     */
+    double GetChunksSuccessRate(WifiMode mode,
+                                const WifiTxVector& txVector,
+                                const std::vector<std::pair<double, uint64_t>>& chunks,
+                                uint8_t numRxAntennas = 1,
+                                WifiPpduField field = WIFI_PPDU_FIELD_DATA,
+                                uint16_t staId = SU_STA_ID) const;
+
+    /**
+     * Set the step of the grid of SNR values on which the success rates are
+     * precomputed. The success rates precomputed so far are discarded.
+     *
+     * \param step the step of the grid, zero to compute every success rate from scratch
+     */
+    void SetSnrGridStep(dB_u step);
+
+    /**
+     * \return the step of the grid of SNR values on which the success rates are precomputed
+     */
+    dB_u GetSnrGridStep() const;
+
     /**
      * Assign a fixed random variable stream number to the random variables
      * used by this model. Return the number of streams (possibly zero) that
@@ -92,6 +142,41 @@ class ErrorRateModel : public Object
     virtual int64_t AssignStreams(int64_t stream);
 
   private:
+    /**
+     * Key of a grid of SNR values: UID of the mode, data rate (zero for a
+     * mode of the PHY header), channel width, LDPC, number of RX antennas,
+     * PPDU field and size of the chunks, as the base-2 logarithm of the
+     * number of bits.
+     */
+    using SnrGridKey =
+        std::tuple<uint32_t, uint64_t, MHz_u, bool, uint8_t, WifiPpduField, uint8_t>;
+
+    /**
+     * Compute the success rate per bit at a point of a grid of SNR values.
+     *
+     * \param mode the Wi-Fi mode applicable to the chunks
+     * \param txVector TXVECTOR of the overall transmission
+     * \param snr the SNR at the point of the grid
+     * \param nbits the number of bits of a chunk of the size of the grid
+     * \param numRxAntennas the number of active RX antennas
+     * \param field the PPDU field to which the chunks belong to
+     * \param staId the station ID for MU
+     *
+     * \return the logarithm of the negated logarithm of the success rate per bit
+     */
+    double ComputeSnrGridPoint(WifiMode mode,
+                               const WifiTxVector& txVector,
+                               dB_u snr,
+                               uint64_t nbits,
+                               uint8_t numRxAntennas,
+                               WifiPpduField field,
+                               uint16_t staId) const;
+
+    dB_u m_snrGridStep{0}; //!< step of the grids of SNR values, zero if disabled
+    /// logarithms of the negated logarithms of the success rates per bit on the grids of SNR
+    /// values, NaN for the points not computed yet
+    mutable std::map<SnrGridKey, std::vector<double>> m_snrGrids;
+
     /**
      * A pure virtual method that must be implemented in the subclass.
      *
@@ -157,6 +157,115 @@ InterferenceHelper::NiChange::GetEvent() const
     return m_event;
 }
 
+InterferenceHelper::NiChanges::iterator
+InterferenceHelper::NiChanges::begin()
+{
+    return m_changes.begin() + m_head;
+}
+
+InterferenceHelper::NiChanges::iterator
+InterferenceHelper::NiChanges::end()
+{
+    return m_changes.end();
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::NiChanges::begin() const
+{
+    return m_changes.cbegin() + m_head;
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::NiChanges::end() const
+{
+    return m_changes.cend();
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::NiChanges::cbegin() const
+{
+    return begin();
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::NiChanges::cend() const
+{
+    return end();
+}
+
+std::size_t
+InterferenceHelper::NiChanges::size() const
+{
+    return m_changes.size() - m_head;
+}
+
+bool
+InterferenceHelper::NiChanges::empty() const
+{
+    return size() == 0;
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::NiChanges::find(Time moment) const
+{
+    auto it = std::lower_bound(begin(), end(), moment, [](const auto& change, Time t) {
+        return change.first < t;
+    });
+    return (it != end() && it->first == moment) ? it : end();
+}
+
+InterferenceHelper::NiChanges::iterator
+InterferenceHelper::NiChanges::upper_bound(Time moment)
+{
+    return std::upper_bound(begin(), end(), moment, [](Time t, const auto& change) {
+        return t < change.first;
+    });
+}
+
+InterferenceHelper::NiChanges::iterator
+InterferenceHelper::NiChanges::Insert(Time moment, NiChange change)
+{
+    return m_changes.emplace(upper_bound(moment), moment, std::move(change));
+}
+
+void
+InterferenceHelper::NiChanges::Append(Time moment, NiChange change)
+{
+    NS_ASSERT(empty() || m_changes.back().first <= moment);
+    m_changes.emplace_back(moment, std::move(change));
+}
+
+void
+InterferenceHelper::NiChanges::PruneUpTo(iterator last)
+{
+    NS_ASSERT(last >= begin() && last < end());
+    const auto first = begin();
+    if (last == first)
+    {
+        return;
+    }
+    // release the events of the NI changes pruned, and move the first NI change in place of
+    // the last one
+    for (auto it = first + 1; it != last; ++it)
+    {
+        it->second = NiChange(0, nullptr);
+    }
+    *last = std::move(*first);
+    m_head = last - m_changes.begin();
+    if (m_head >= m_changes.size() / 2)
+    {
+        m_changes.erase(m_changes.begin(), m_changes.begin() + m_head);
+        m_head = 0;
+    }
+}
+
+void
+InterferenceHelper::NiChanges::clear()
+{
+    m_changes.clear();
+    m_head = 0;
+}
+
 /****************************************************************
  *       The actual InterferenceHelper
  ****************************************************************/
@@ -187,10 +296,6 @@ void
 InterferenceHelper::DoDispose()
 {
     NS_LOG_FUNCTION(this);
-    for (auto it : m_niChanges)
-    {
-        it.second.clear();
-    }
     m_niChanges.clear();
     m_firstPowers.clear();
     m_errorRateModel = nullptr;
@@ -230,36 +335,51 @@ InterferenceHelper::HasBands() const
     return !m_niChanges.empty();
 }
 
+std::size_t
+InterferenceHelper::GetBandIndex(const WifiSpectrumBandInfo& band) const
+{
+    auto it = std::lower_bound(m_niChanges.cbegin(),
+                               m_niChanges.cend(),
+                               band,
+                               [](const auto& nis, const auto& b) { return nis.first < b; });
+    if (it == m_niChanges.cend() || band < it->first)
+    {
+        return m_niChanges.size();
+    }
+    return it - m_niChanges.cbegin();
+}
+
 bool
 InterferenceHelper::HasBand(const WifiSpectrumBandInfo& band) const
 {
-    return m_niChanges.contains(band);
+    return GetBandIndex(band) < m_niChanges.size();
 }
 
 void
 InterferenceHelper::AddBand(const WifiSpectrumBandInfo& band)
 {
     NS_LOG_FUNCTION(this << band);
-    NS_ASSERT(!m_niChanges.contains(band));
-    NS_ASSERT(!m_firstPowers.contains(band));
-    NiChanges niChanges;
-    auto result = m_niChanges.insert({band, niChanges});
-    NS_ASSERT(result.second);
+    NS_ASSERT(!HasBand(band));
+    NS_ASSERT(m_firstPowers.size() == m_niChanges.size());
+    auto it = std::lower_bound(m_niChanges.begin(),
+                               m_niChanges.end(),
+                               band,
+                               [](const auto& nis, const auto& b) { return nis.first < b; });
+    const auto index = it - m_niChanges.begin();
+    it = m_niChanges.insert(it, {band, NiChanges()});
     // Always have a zero power noise event in the list
-    AddNiChangeEvent(Time(0), NiChange(0.0, nullptr), result.first);
-    m_firstPowers.insert({band, 0.0});
+    AddNiChangeEvent(Time(0), NiChange(0.0, nullptr), it->second);
+    m_firstPowers.insert(m_firstPowers.begin() + index, 0.0);
 }
 
 void
 InterferenceHelper::RemoveBand(const WifiSpectrumBandInfo& band)
 {
     NS_LOG_FUNCTION(this << band);
-    NS_ASSERT(m_firstPowers.count(band) != 0);
-    m_firstPowers.erase(band);
-    auto it = m_niChanges.find(band);
-    NS_ASSERT(it != std::end(m_niChanges));
-    it->second.clear();
-    m_niChanges.erase(it);
+    const auto index = GetBandIndex(band);
+    NS_ASSERT(index < m_niChanges.size());
+    m_niChanges.erase(m_niChanges.begin() + index);
+    m_firstPowers.erase(m_firstPowers.begin() + index);
 }
 
 void
@@ -328,11 +448,12 @@ InterferenceHelper::GetEnergyDuration(Watt_u energy, const WifiSpectrumBandInfo&
 {
     NS_LOG_FUNCTION(this << energy << band);
     Time now = Simulator::Now();
-    auto niIt = m_niChanges.find(band);
-    NS_ABORT_IF(niIt == m_niChanges.end());
-    auto i = GetPreviousPosition(now, niIt);
+    const auto index = GetBandIndex(band);
+    NS_ABORT_IF(index == m_niChanges.size());
+    auto& nis = m_niChanges[index].second;
+    auto i = GetPreviousPosition(now, nis);
     Time end = i->first;
-    for (; i != niIt->second.end(); ++i)
+    for (; i != nis.end(); ++i)
     {
         const auto noiseInterference = i->second.GetPower();
         end = i->first;
@@ -350,35 +471,40 @@ InterferenceHelper::AppendEvent(Ptr<Event> event,
                                 bool isStartHePortionRxing)
 {
     NS_LOG_FUNCTION(this << event << freqRange << isStartHePortionRxing);
+    const auto rxing = (m_rxing.contains(freqRange) && m_rxing.at(freqRange));
     for (const auto& [band, power] : event->GetRxPowerPerBand())
     {
-        auto niIt = m_niChanges.find(band);
-        NS_ABORT_IF(niIt == m_niChanges.end());
+        const auto index = GetBandIndex(band);
+        NS_ABORT_IF(index == m_niChanges.size());
+        auto& nis = m_niChanges[index].second;
         Watt_u previousPowerStart = 0;
         Watt_u previousPowerEnd = 0;
-        auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), niIt);
+        auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), nis);
         previousPowerStart = previousPowerPosition->second.GetPower();
-        previousPowerEnd = GetPreviousPosition(event->GetEndTime(), niIt)->second.GetPower();
-        if (const auto rxing = (m_rxing.contains(freqRange) && m_rxing.at(freqRange)); !rxing)
+        previousPowerEnd = GetPreviousPosition(event->GetEndTime(), nis)->second.GetPower();
+        if (!rxing)
         {
-            m_firstPowers.find(band)->second = previousPowerStart;
+            m_firstPowers[index] = previousPowerStart;
             // Always leave the first zero power noise event in the list
-            niIt->second.erase(++(niIt->second.begin()), ++previousPowerPosition);
+            nis.PruneUpTo(previousPowerPosition);
         }
         else if (isStartHePortionRxing)
         {
             // When the first HE portion is received, we need to set m_firstPowerPerBand
             // so that it takes into account interferences that arrived between the start of the
             // HE TB PPDU transmission and the start of HE TB payload.
-            m_firstPowers.find(band)->second = previousPowerStart;
+            m_firstPowers[index] = previousPowerStart;
         }
+        // add the power of the event to the NI changes it overlaps before inserting the NI
+        // change of its end, which invalidates the iterators
         auto first =
-            AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
-        auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
+            AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), nis);
+        auto last = GetNextPosition(event->GetEndTime(), nis);
         for (auto i = first; i != last; ++i)
         {
             i->second.AddPower(power);
         }
+        AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), nis);
     }
 }
 
@@ -389,10 +515,11 @@ InterferenceHelper::UpdateEvent(Ptr<Event> event, const RxPowerWattPerChannelBan
     // This is called for UL MU events, in order to scale power as long as UL MU PPDUs arrive
     for (const auto& [band, power] : rxPower)
     {
-        auto niIt = m_niChanges.find(band);
-        NS_ABORT_IF(niIt == m_niChanges.end());
-        auto first = GetPreviousPosition(event->GetStartTime(), niIt);
-        auto last = GetPreviousPosition(event->GetEndTime(), niIt);
+        const auto index = GetBandIndex(band);
+        NS_ABORT_IF(index == m_niChanges.size());
+        auto& nis = m_niChanges[index].second;
+        auto first = GetPreviousPosition(event->GetStartTime(), nis);
+        auto last = GetPreviousPosition(event->GetEndTime(), nis);
         for (auto i = first; i != last; ++i)
         {
             i->second.AddPower(power);
@@ -435,21 +562,20 @@ InterferenceHelper::CalculateSnr(Watt_u signal,
 
 Watt_u
 InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
-                                                NiChangesPerBand& nis,
+                                                NiChanges& nis,
                                                 const WifiSpectrumBandInfo& band) const
 {
     NS_LOG_FUNCTION(this << band);
-    auto firstPower_it = m_firstPowers.find(band);
-    NS_ABORT_IF(firstPower_it == m_firstPowers.end());
-    auto noiseInterference = firstPower_it->second;
-    auto niIt = m_niChanges.find(band);
-    NS_ABORT_IF(niIt == m_niChanges.end());
+    const auto index = GetBandIndex(band);
+    NS_ABORT_IF(index == m_niChanges.size());
+    auto noiseInterference = m_firstPowers[index];
+    const auto& bandNis = m_niChanges[index].second;
     const auto now = Simulator::Now();
-    auto it = niIt->second.find(event->GetStartTime());
+    auto it = bandNis.find(event->GetStartTime());
     const auto muMimoPower = (event->GetPpdu()->GetType() == WIFI_PPDU_TYPE_UL_MU)
                                  ? CalculateMuMimoPowerW(event, band)
                                  : 0.0;
-    for (; it != niIt->second.end() && it->first < now; ++it)
+    for (; it != bandNis.end() && it->first < now; ++it)
     {
         if (IsSameMuMimoTransmission(event, it->second.GetEvent()) &&
             (event != it->second.GetEvent()))
@@ -465,20 +591,19 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
             noiseInterference = 0.0;
         }
     }
-    it = niIt->second.find(event->GetStartTime());
-    NS_ABORT_IF(it == niIt->second.end());
-    for (; it != niIt->second.end() && it->second.GetEvent() != event; ++it)
+    it = bandNis.find(event->GetStartTime());
+    NS_ABORT_IF(it == bandNis.end());
+    for (; it != bandNis.end() && it->second.GetEvent() != event; ++it)
     {
         ;
     }
-    NiChanges ni;
-    ni.emplace(event->GetStartTime(), NiChange(0, event));
-    while (++it != niIt->second.end() && it->second.GetEvent() != event)
+    nis.clear();
+    nis.Append(event->GetStartTime(), NiChange(0, event));
+    while (++it != bandNis.end() && it->second.GetEvent() != event)
     {
-        ni.insert(*it);
+        nis.Append(it->first, it->second);
     }
-    ni.emplace(event->GetEndTime(), NiChange(0, event));
-    nis.insert({band, ni});
+    nis.Append(event->GetEndTime(), NiChange(0, event));
     NS_ASSERT_MSG(noiseInterference >= 0.0,
                   "CalculateNoiseInterferenceW returns negative value " << noiseInterference);
     return noiseInterference;
@@ -488,12 +613,13 @@ Watt_u
 InterferenceHelper::CalculateMuMimoPowerW(Ptr<const Event> event,
                                           const WifiSpectrumBandInfo& band) const
 {
-    auto niIt = m_niChanges.find(band);
-    NS_ASSERT(niIt != m_niChanges.end());
-    auto it = niIt->second.begin();
+    const auto index = GetBandIndex(band);
+    NS_ASSERT(index < m_niChanges.size());
+    const auto& nis = m_niChanges[index].second;
+    auto it = nis.begin();
     ++it;
     Watt_u muMimoPower{0.0};
-    for (; it != niIt->second.end() && it->first < Simulator::Now(); ++it)
+    for (; it != nis.end() && it->first < Simulator::Now(); ++it)
     {
         if (IsSameMuMimoTransmission(event, it->second.GetEvent()))
         {
@@ -521,22 +647,10 @@ InterferenceHelper::CalculateMuMimoPowerW(Ptr<const Event> event,
     return muMimoPower;
 }
 
-double
-InterferenceHelper::CalculateChunkSuccessRate(double snir,
-                                              Time duration,
-                                              WifiMode mode,
-                                              const WifiTxVector& txVector,
-                                              WifiPpduField field) const
+uint64_t
+InterferenceHelper::GetChunkNBits(uint64_t rate, Time duration, uint8_t nss)
 {
-    if (duration.IsZero())
-    {
-        return 1.0;
-    }
-    const auto rate = mode.GetDataRate(txVector.GetChannelWidth());
-    auto nbits = static_cast<uint64_t>(rate * duration.GetSeconds());
-    const auto csr =
-        m_errorRateModel->GetChunkSuccessRate(mode, txVector, snir, nbits, m_numRxAntennas, field);
-    return csr;
+    return static_cast<uint64_t>(rate * duration.GetSeconds()) / nss;
 }
 
 double
@@ -550,32 +664,26 @@ InterferenceHelper::CalculatePayloadChunkSuccessRate(double snir,
         return 1.0;
     }
     const auto mode = txVector.GetMode(staId);
-    const auto rate = mode.GetDataRate(txVector, staId);
-    auto nbits = static_cast<uint64_t>(rate * duration.GetSeconds());
-    nbits /= txVector.GetNss(staId); // divide effective number of bits by NSS to achieve same chunk
-                                     // error rate as SISO for AWGN
-    double csr = m_errorRateModel->GetChunkSuccessRate(mode,
-                                                       txVector,
-                                                       snir,
-                                                       nbits,
-                                                       m_numRxAntennas,
-                                                       WIFI_PPDU_FIELD_DATA,
-                                                       staId);
-    return csr;
+    const auto nbits =
+        GetChunkNBits(mode.GetDataRate(txVector, staId), duration, txVector.GetNss(staId));
+    return m_errorRateModel->GetChunksSuccessRate(mode,
+                                                  txVector,
+                                                  {{snir, nbits}},
+                                                  m_numRxAntennas,
+                                                  WIFI_PPDU_FIELD_DATA,
+                                                  staId);
 }
 
 double
 InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
                                         MHz_u channelWidth,
-                                        NiChangesPerBand* nis,
+                                        const NiChanges& nis,
                                         const WifiSpectrumBandInfo& band,
                                         uint16_t staId,
                                         std::pair<Time, Time> window) const
 {
     NS_LOG_FUNCTION(this << channelWidth << band << staId << window.first << window.second);
-    double psr = 1.0; /* Packet Success Rate */
-    const auto& niIt = nis->find(band)->second;
-    auto j = niIt.cbegin();
+    auto j = nis.cbegin();
     auto previous = j->first;
     Watt_u muMimoPower = 0.0;
     const auto payloadMode = event->GetPpdu()->GetTxVector().GetMode(staId);
@@ -593,38 +701,41 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
     }
     const auto windowStart = phyPayloadStart + window.first;
     const auto windowEnd = phyPayloadStart + window.second;
-    NS_ABORT_IF(!m_firstPowers.contains(band));
-    auto noiseInterference = m_firstPowers.at(band);
+    const auto index = GetBandIndex(band);
+    NS_ABORT_IF(index == m_niChanges.size());
+    auto noiseInterference = m_firstPowers[index];
     auto power = event->GetRxPower(band);
-    while (++j != niIt.cend())
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    const auto rate = payloadMode.GetDataRate(txVector, staId);
+    const auto nss = txVector.GetNss(staId);
+    // the (SNR, number of bits) pairs of the chunks of the windowed payload, whose success rate
+    // is computed in a single call to the error rate model
+    std::vector<std::pair<double, uint64_t>> chunks;
+    while (++j != nis.cend())
     {
         Time current = j->first;
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
-        const auto snr = CalculateSnr(power,
-                                      noiseInterference,
-                                      channelWidth,
-                                      event->GetPpdu()->GetTxVector().GetNss(staId));
+        const auto snr = CalculateSnr(power, noiseInterference, channelWidth, nss);
+        Time duration;
         // Case 1: Both previous and current point to the windowed payload
         if (previous >= windowStart)
         {
-            psr *= CalculatePayloadChunkSuccessRate(snr,
-                                                    Min(windowEnd, current) - previous,
-                                                    event->GetPpdu()->GetTxVector(),
-                                                    staId);
+            duration = Min(windowEnd, current) - previous;
             NS_LOG_DEBUG("Both previous and current point to the windowed payload: mode="
-                         << payloadMode << ", psr=" << psr);
+                         << payloadMode << ", snr=" << snr);
         }
         // Case 2: previous is before windowed payload and current is in the windowed payload
         else if (current >= windowStart)
         {
-            psr *= CalculatePayloadChunkSuccessRate(snr,
-                                                    Min(windowEnd, current) - windowStart,
-                                                    event->GetPpdu()->GetTxVector(),
-                                                    staId);
+            duration = Min(windowEnd, current) - windowStart;
             NS_LOG_DEBUG(
                 "previous is before windowed payload and current is in the windowed payload: mode="
-                << payloadMode << ", psr=" << psr);
+                << payloadMode << ", snr=" << snr);
+        }
+        if (!duration.IsZero())
+        {
+            chunks.emplace_back(snr, GetChunkNBits(rate, duration, nss));
         }
         noiseInterference = j->second.GetPower() - power;
         if (IsSameMuMimoTransmission(event, j->second.GetEvent()))
@@ -641,6 +752,13 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
             break;
         }
     }
+    const auto psr = m_errorRateModel->GetChunksSuccessRate(payloadMode,
+                                                            txVector,
+                                                            chunks,
+                                                            m_numRxAntennas,
+                                                            WIFI_PPDU_FIELD_DATA,
+                                                            staId);
+    NS_LOG_DEBUG("psr=" << psr);
     const auto per = 1.0 - psr;
     return per;
 }
@@ -648,15 +766,13 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
 double
 InterferenceHelper::CalculatePhyHeaderSectionPsr(
     Ptr<const Event> event,
-    NiChangesPerBand* nis,
+    const NiChanges& nis,
     MHz_u channelWidth,
     const WifiSpectrumBandInfo& band,
     PhyEntity::PhyHeaderSections phyHeaderSections) const
 {
     NS_LOG_FUNCTION(this << band);
-    double psr = 1.0; /* Packet Success Rate */
-    auto niIt = nis->find(band)->second;
-    auto j = niIt.begin();
+    auto j = nis.cbegin();
 
     NS_ASSERT(!phyHeaderSections.empty());
     Time stopLastSection;
@@ -665,16 +781,22 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
         stopLastSection = Max(stopLastSection, section.second.first.second);
     }
 
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    // the (SNR, number of bits) pairs of the chunks of each section, in the order of the sections,
+    // whose success rate is computed in a single call to the error rate model per section
+    std::vector<std::vector<std::pair<double, uint64_t>>> chunks(phyHeaderSections.size());
     auto previous = j->first;
-    NS_ABORT_IF(!m_firstPowers.contains(band));
-    auto noiseInterference = m_firstPowers.at(band);
+    const auto index = GetBandIndex(band);
+    NS_ABORT_IF(index == m_niChanges.size());
+    auto noiseInterference = m_firstPowers[index];
     const auto power = event->GetRxPower(band);
-    while (++j != niIt.end())
+    while (++j != nis.cend())
     {
         auto current = j->first;
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
         const auto snr = CalculateSnr(power, noiseInterference, channelWidth, 1);
+        auto sectionChunks = chunks.begin();
         for (const auto& section : phyHeaderSections)
         {
             const auto start = section.second.first.first;
@@ -685,17 +807,16 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
                 const auto duration = Min(stop, current) - Max(start, previous);
                 if (duration.IsStrictlyPositive())
                 {
-                    psr *= CalculateChunkSuccessRate(snr,
-                                                     duration,
-                                                     section.second.second,
-                                                     event->GetPpdu()->GetTxVector(),
-                                                     section.first);
+                    const auto rate =
+                        section.second.second.GetDataRate(txVector.GetChannelWidth());
+                    sectionChunks->emplace_back(snr, GetChunkNBits(rate, duration, 1));
                     NS_LOG_DEBUG("Current NI change in "
                                  << section.first << " [" << start << ", " << stop << "] for "
                                  << duration.As(Time::NS) << ": mode=" << section.second.second
-                                 << ", psr=" << psr);
+                                 << ", snr=" << snr);
                 }
             }
+            ++sectionChunks;
         }
         noiseInterference = j->second.GetPower() - power;
         previous = j->first;
@@ -706,24 +827,35 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
             break;
         }
     }
+
+    double psr = 1.0; /* Packet Success Rate */
+    auto sectionChunks = chunks.cbegin();
+    for (const auto& section : phyHeaderSections)
+    {
+        psr *= m_errorRateModel->GetChunksSuccessRate(section.second.second,
+                                                      txVector,
+                                                      *sectionChunks++,
+                                                      m_numRxAntennas,
+                                                      section.first);
+    }
+    NS_LOG_DEBUG("psr=" << psr);
     return psr;
 }
 
 double
 InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
-                                          NiChangesPerBand* nis,
+                                          const NiChanges& nis,
                                           MHz_u channelWidth,
                                           const WifiSpectrumBandInfo& band,
                                           WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    auto niIt = nis->find(band)->second;
     auto phyEntity =
         WifiPhy::GetStaticPhyEntity(event->GetPpdu()->GetTxVector().GetModulationClass());
 
     PhyEntity::PhyHeaderSections sections;
     for (const auto& section :
-         phyEntity->GetPhyHeaderSections(event->GetPpdu()->GetTxVector(), niIt.begin()->first))
+         phyEntity->GetPhyHeaderSections(event->GetPpdu()->GetTxVector(), nis.begin()->first))
     {
         if (section.first == header)
         {
@@ -748,7 +880,7 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
 {
     NS_LOG_FUNCTION(this << channelWidth << band << staId << relativeMpduStartStop.first
                          << relativeMpduStartStop.second);
-    NiChangesPerBand ni;
+    NiChanges ni;
     const auto noiseInterference = CalculateNoiseInterferenceW(event, ni, band);
     const auto snr = CalculateSnr(event->GetRxPower(band),
                                   noiseInterference,
@@ -759,7 +891,7 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
      * all SNIR changes in the SNIR vector.
      */
     const auto per =
-        CalculatePayloadPer(event, channelWidth, &ni, band, staId, relativeMpduStartStop);
+        CalculatePayloadPer(event, channelWidth, ni, band, staId, relativeMpduStartStop);
 
     return PhyEntity::SnrPer(snr, per);
 }
@@ -770,7 +902,7 @@ InterferenceHelper::CalculateSnr(Ptr<Event> event,
                                  uint8_t nss,
                                  const WifiSpectrumBandInfo& band) const
 {
-    NiChangesPerBand ni;
+    NiChanges ni;
     const auto noiseInterference = CalculateNoiseInterferenceW(event, ni, band);
     return CalculateSnr(event->GetRxPower(band), noiseInterference, channelWidth, nss);
 }
@@ -782,28 +914,28 @@ InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
                                              WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    NiChangesPerBand ni;
+    NiChanges ni;
     const auto noiseInterference = CalculateNoiseInterferenceW(event, ni, band);
     const auto snr = CalculateSnr(event->GetRxPower(band), noiseInterference, channelWidth, 1);
 
     /* calculate the SNIR at the start of the PHY header and accumulate
      * all SNIR changes in the SNIR vector.
      */
-    const auto per = CalculatePhyHeaderPer(event, &ni, channelWidth, band, header);
+    const auto per = CalculatePhyHeaderPer(event, ni, channelWidth, band, header);
 
     return PhyEntity::SnrPer(snr, per);
 }
 
 InterferenceHelper::NiChanges::iterator
-InterferenceHelper::GetNextPosition(Time moment, NiChangesPerBand::iterator niIt)
+InterferenceHelper::GetNextPosition(Time moment, NiChanges& nis)
 {
-    return niIt->second.upper_bound(moment);
+    return nis.upper_bound(moment);
 }
 
 InterferenceHelper::NiChanges::iterator
-InterferenceHelper::GetPreviousPosition(Time moment, NiChangesPerBand::iterator niIt)
+InterferenceHelper::GetPreviousPosition(Time moment, NiChanges& nis)
 {
-    auto it = GetNextPosition(moment, niIt);
+    auto it = GetNextPosition(moment, nis);
     // This is safe since there is always an NiChange at time 0,
     // before moment.
     --it;
@@ -811,9 +943,9 @@ InterferenceHelper::GetPreviousPosition(Time moment, NiChangesPerBand::iterator
 }
 
 InterferenceHelper::NiChanges::iterator
-InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, NiChangesPerBand::iterator niIt)
+InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, NiChanges& nis)
 {
-    return niIt->second.insert(GetNextPosition(moment, niIt), {moment, change});
+    return nis.Insert(moment, change);
 }
 
 void
@@ -829,16 +961,17 @@ InterferenceHelper::NotifyRxEnd(Time endTime, const FrequencyRange& freqRange)
     NS_LOG_FUNCTION(this << endTime << freqRange);
     m_rxing.at(freqRange) = false;
     // Update m_firstPowers for frame capture
-    for (auto niIt = m_niChanges.begin(); niIt != m_niChanges.end(); ++niIt)
+    for (std::size_t index = 0; index < m_niChanges.size(); ++index)
     {
-        if (!IsBandInFrequencyRange(niIt->first, freqRange))
+        auto& [band, nis] = m_niChanges[index];
+        if (!IsBandInFrequencyRange(band, freqRange))
         {
             continue;
         }
-        NS_ASSERT(niIt->second.size() > 1);
-        auto it = GetPreviousPosition(endTime, niIt);
+        NS_ASSERT(nis.size() > 1);
+        auto it = GetPreviousPosition(endTime, nis);
         it--;
-        m_firstPowers.find(niIt->first)->second = it->second.GetPower();
+        m_firstPowers[index] = it->second.GetPower();
     }
 }
 
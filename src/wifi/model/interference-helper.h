@@ -13,6 +13,9 @@
 
 #include "ns3/object.h"
 
+#include <utility>
+#include <vector>
+
 namespace ns3
 {
 
@@ -314,23 +317,6 @@ class InterferenceHelper : public Object
                         Watt_u noiseInterference,
                         MHz_u channelWidth,
                         uint8_t nss) const;
-    /**
-     * Calculate the success rate of the chunk given the SINR, duration, and TXVECTOR.
-     * The duration and TXVECTOR are used to calculate how many bits are present in the chunk.
-     *
-     * \param snir the SINR
-     * \param duration the duration of the chunk
-     * \param mode the WifiMode
-     * \param txVector the TXVECTOR
-     * \param field the PPDU field to which the chunk belongs to
-     *
-     * \return the success rate
-     */
-    double CalculateChunkSuccessRate(double snir,
-                                     Time duration,
-                                     WifiMode mode,
-                                     const WifiTxVector& txVector,
-                                     WifiPpduField field) const;
     /**
      * Calculate the success rate of the payload chunk given the SINR, duration, and TXVECTOR.
      * The duration and TXVECTOR are used to calculate how many bits are present in the payload
@@ -391,23 +377,122 @@ class InterferenceHelper : public Object
     };
 
     /**
-     * typedef for a multimap of NiChange
+     * NI changes of a band, sorted by time (the changes occurring at the same time are sorted
+     * by insertion order).
+     *
+     * The changes are stored in a vector, whose first entries may have been pruned: pruning
+     * the changes that precede a given change only moves the head of the vector, which is
+     * compacted once the pruned entries make up half of the vector.
      */
-    using NiChanges = std::multimap<Time, NiChange>;
+    class NiChanges
+    {
+      public:
+        /// type of the entries
+        using value_type = std::pair<Time, NiChange>;
+        /// iterator over the entries
+        using iterator = std::vector<value_type>::iterator;
+        /// const iterator over the entries
+        using const_iterator = std::vector<value_type>::const_iterator;
+
+        /**
+         * \return an iterator to the first NI change
+         */
+        iterator begin();
+        /**
+         * \return an iterator past the last NI change
+         */
+        iterator end();
+        /**
+         * \return a const iterator to the first NI change
+         */
+        const_iterator begin() const;
+        /**
+         * \return a const iterator past the last NI change
+         */
+        const_iterator end() const;
+        /**
+         * \return a const iterator to the first NI change
+         */
+        const_iterator cbegin() const;
+        /**
+         * \return a const iterator past the last NI change
+         */
+        const_iterator cend() const;
+        /**
+         * \return the number of NI changes
+         */
+        std::size_t size() const;
+        /**
+         * \return whether there is no NI change
+         */
+        bool empty() const;
+
+        /**
+         * \param moment the time to look for
+         * \return an iterator to the first NI change at the given time, or the end iterator if
+         *         there is none
+         */
+        const_iterator find(Time moment) const;
+        /**
+         * \param moment the time to look for
+         * \return an iterator to the first NI change later than the given time
+         */
+        iterator upper_bound(Time moment);
+
+        /**
+         * Insert a NI change after the NI changes at the same time or earlier.
+         *
+         * \param moment the time of the NI change
+         * \param change the NI change
+         * \return an iterator to the NI change inserted
+         */
+        iterator Insert(Time moment, NiChange change);
+        /**
+         * Append a NI change, which must not precede the last NI change.
+         *
+         * \param moment the time of the NI change
+         * \param change the NI change
+         */
+        void Append(Time moment, NiChange change);
+        /**
+         * Remove the NI changes following the first NI change up to the given NI change,
+         * included. The first NI change is kept and takes the place of the given NI change.
+         *
+         * \param last an iterator to the last NI change to remove
+         */
+        void PruneUpTo(iterator last);
+        /**
+         * Remove all the NI changes.
+         */
+        void clear();
+
+      private:
+        std::vector<value_type> m_changes; //!< NI changes, the pruned ones included
+        std::size_t m_head{0};             //!< index of the first NI change not pruned
+    };
 
     /**
-     * Map of NiChanges per band
+     * NiChanges of each band, sorted by band. The index of a band in this vector identifies
+     * the band in the vectors indexed by band.
      */
-    using NiChangesPerBand = std::map<WifiSpectrumBandInfo, NiChanges>;
+    using NiChangesPerBand = std::vector<std::pair<WifiSpectrumBandInfo, NiChanges>>;
 
     /**
-     * Map of first power per band
+     * First power of each band, indexed by band
      */
-    using FirstPowerPerBand = std::map<WifiSpectrumBandInfo, Watt_u>;
+    using FirstPowerPerBand = std::vector<Watt_u>;
 
     NiChangesPerBand m_niChanges; //!< NI Changes for each band
 
   private:
+    /**
+     * Get the index of a given band in the vectors indexed by band.
+     *
+     * \param band the band
+     * \return the index of the band, or the number of bands if the band is not tracked
+     */
+    std::size_t GetBandIndex(const WifiSpectrumBandInfo& band) const;
+
     /**
      * Check whether a given band is tracked by this interference helper.
      *
@@ -440,13 +525,13 @@ class InterferenceHelper : public Object
      * Calculate noise and interference power.
      *
      * \param event the event
-     * \param nis the NiChanges
+     * \param nis the NiChanges to fill with the NI changes during the event
      * \param band the band
      *
      * \return noise and interference power
      */
     Watt_u CalculateNoiseInterferenceW(Ptr<Event> event,
-                                       NiChangesPerBand& nis,
+                                       NiChanges& nis,
                                        const WifiSpectrumBandInfo& band) const;
 
     /**
@@ -461,6 +546,19 @@ class InterferenceHelper : public Object
      */
     Watt_u CalculateMuMimoPowerW(Ptr<const Event> event, const WifiSpectrumBandInfo& band) const;
 
+    /**
+     * Get the number of bits of a chunk passed to the error rate model. The number of bits
+     * transmitted during the chunk is divided by the number of spatial streams, to achieve the
+     * same chunk error rate as SISO for AWGN.
+     *
+     * \param rate the data rate of the chunk in bps
+     * \param duration the duration of the chunk
+     * \param nss the number of spatial streams
+     *
+     * \return the number of bits of the chunk
+     */
+    static uint64_t GetChunkNBits(uint64_t rate, Time duration, uint8_t nss);
+
     /**
      * Calculate the error rate of the given PHY payload only in the provided time
      * window (thus enabling per MPDU PER information). The PHY payload can be divided into
@@ -468,7 +566,7 @@ class InterferenceHelper : public Object
      *
      * \param event the event
      * \param channelWidth the channel width used to transmit the PSDU
-     * \param nis the NiChanges
+     * \param nis the NI changes during the event
      * \param band identify the band used by the PSDU
      * \param staId the station ID of the PSDU (only used for MU)
      * \param window time window (pair of start and end times) of PHY payload to focus on
@@ -477,7 +575,7 @@ class InterferenceHelper : public Object
      */
     double CalculatePayloadPer(Ptr<const Event> event,
                                MHz_u channelWidth,
-                               NiChangesPerBand* nis,
+                               const NiChanges& nis,
                                const WifiSpectrumBandInfo& band,
                                uint16_t staId,
                                std::pair<Time, Time> window) const;
@@ -486,7 +584,7 @@ class InterferenceHelper : public Object
      * can be divided into multiple chunks (e.g. due to interference from other transmissions).
      *
      * \param event the event
-     * \param nis the NiChanges
+     * \param nis the NI changes during the event
      * \param channelWidth the channel width for header measurement
      * \param band the band
      * \param header the PHY header to consider
@@ -494,7 +592,7 @@ class InterferenceHelper : public Object
      * \return the error rate of the HT PHY header
      */
     double CalculatePhyHeaderPer(Ptr<const Event> event,
-                                 NiChangesPerBand* nis,
+                                 const NiChanges& nis,
                                  MHz_u channelWidth,
                                  const WifiSpectrumBandInfo& band,
                                  WifiPpduField header) const;
@@ -502,7 +600,7 @@ class InterferenceHelper : public Object
      * Calculate the success rate of the PHY header sections for the provided event.
      *
      * \param event the event
-     * \param nis the NiChanges
+     * \param nis the NI changes during the event
      * \param channelWidth the channel width for header measurement
      * \param band the band
      * \param phyHeaderSections the map of PHY header sections (\see PhyEntity::PhyHeaderSections)
@@ -510,7 +608,7 @@ class InterferenceHelper : public Object
      * \return the success rate of the PHY header sections
      */
     double CalculatePhyHeaderSectionPsr(Ptr<const Event> event,
-                                        NiChangesPerBand* nis,
+                                        const NiChanges& nis,
                                         MHz_u channelWidth,
                                         const WifiSpectrumBandInfo& band,
                                         PhyEntity::PhyHeaderSections phyHeaderSections) const;
@@ -518,24 +616,24 @@ class InterferenceHelper : public Object
     double m_noiseFigure;                 //!< noise figure (linear)
     Ptr<ErrorRateModel> m_errorRateModel; //!< error rate model
     uint8_t m_numRxAntennas;         //!< the number of RX antennas in the corresponding receiver
-    FirstPowerPerBand m_firstPowers; //!< first power of each band
+    FirstPowerPerBand m_firstPowers; //!< first power of each band, indexed by band
 
     /**
      * Returns an iterator to the first NiChange that is later than moment
      *
      * \param moment time to check from
-     * \param niIt iterator of the band to check
+     * \param nis the NiChanges of the band to check
      * \returns an iterator to the list of NiChanges
      */
-    NiChanges::iterator GetNextPosition(Time moment, NiChangesPerBand::iterator niIt);
+    NiChanges::iterator GetNextPosition(Time moment, NiChanges& nis);
     /**
      * Returns an iterator to the last NiChange that is before than moment
      *
      * \param moment time to check from
-     * \param niIt iterator of the band to check
+     * \param nis the NiChanges of the band to check
      * \returns an iterator to the list of NiChanges
      */
-    NiChanges::iterator GetPreviousPosition(Time moment, NiChangesPerBand::iterator niIt);
+    NiChanges::iterator GetPreviousPosition(Time moment, NiChanges& nis);
 
     /**
      * Add NiChange to the list at the appropriate position and
@@ -543,12 +641,10 @@ class InterferenceHelper : public Object
      *
      * \param moment time to check from
      * \param change the NiChange to add
-     * \param niIt iterator of the band to check
+     * \param nis the NiChanges of the band to check
      * \returns the iterator of the new event
      */
-    NiChanges::iterator AddNiChangeEvent(Time moment,
-                                         NiChange change,
-                                         NiChangesPerBand::iterator niIt);
+    NiChanges::iterator AddNiChangeEvent(Time moment, NiChange change, NiChanges& nis);
 
     /**
      * Return whether another event is a MU-MIMO event that belongs to the same transmission and to
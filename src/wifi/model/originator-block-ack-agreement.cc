@@ -14,6 +14,8 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -91,21 +93,23 @@ OriginatorBlockAckAgreement::InitTxWindow()
 bool
 OriginatorBlockAckAgreement::AllAckedMpdusInTxWindow(const std::set<uint16_t>& seqNumbers) const
 {
-    std::set<std::size_t> distances;
+    // positions to ignore, grouped by 64-bit word of the TX window
+    std::vector<uint64_t> ignored((m_txWindow.GetWinSize() + 63) / 64, 0);
     for (const auto seqN : seqNumbers)
     {
-        distances.insert(GetDistance(seqN));
+        if (const auto distance = GetDistance(seqN); distance < m_txWindow.GetWinSize())
+        {
+            ignored[distance / 64] |= uint64_t{1} << (distance % 64);
+        }
     }
 
-    for (std::size_t i = 0; i < m_txWindow.GetWinSize(); ++i)
+    for (std::size_t i = 0; i < m_txWindow.GetWinSize(); i += 64)
     {
-        if (distances.contains(i))
+        const auto n = std::min<std::size_t>(m_txWindow.GetWinSize() - i, 64);
+        const auto all = (n == 64 ? ~uint64_t{0} : (uint64_t{1} << n) - 1);
+        if ((m_txWindow.GetWord(i) | ignored[i / 64]) != all)
         {
-            continue; // this is one of the positions to ignore
-        }
-        if (!m_txWindow.At(i))
-        {
-            return false; // this position is available or contains an unacknowledged MPDU
+            return false; // a position is available or contains an unacknowledged MPDU
         }
     }
     NS_LOG_INFO("TX window is blocked");
@@ -115,9 +119,11 @@ OriginatorBlockAckAgreement::AllAckedMpdusInTxWindow(const std::set<uint16_t>& s
 void
 OriginatorBlockAckAgreement::AdvanceTxWindow()
 {
-    while (m_txWindow.At(0))
+    // advance past all the acknowledged MPDUs at the head of the window (if the
+    // whole window is acknowledged, this resets the current head)
+    if (const auto count = m_txWindow.GetNLeadingSet(); count > 0)
     {
-        m_txWindow.Advance(1); // reset the current head -- ensures loop termination
+        m_txWindow.Advance(count);
     }
 }
 
@@ -162,7 +168,7 @@ OriginatorBlockAckAgreement::NotifyAckedMpdu(Ptr<const WifiMpdu> mpdu)
     // when an MPDU is transmitted, the transmit window is updated such that the
     // transmitted MPDU is in the window, hence we cannot be notified of the
     // acknowledgment of an MPDU which is beyond the transmit window
-    m_txWindow.At(distance) = true;
+    m_txWindow.Set(distance);
 
     // the starting sequence number can be advanced to the sequence number of
     // the nearest unacknowledged MPDU
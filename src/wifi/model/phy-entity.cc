@@ -309,41 +309,80 @@ PhyEntity::EndReceiveField(WifiPpduField field, Ptr<Event> event)
     }
     else
     {
-        Ptr<const WifiPpdu> ppdu = event->GetPpdu();
-        switch (status.actionIfFailure)
+        HandleRxFieldFailure(status,
+                             event,
+                             GetRemainingDurationAfterField(event->GetPpdu(), field));
+    }
+}
+
+void
+PhyEntity::EndReceivePhyHeader(Ptr<Event> event)
+{
+    NS_LOG_FUNCTION(this << *event);
+    NS_ASSERT(m_wifiPhy->m_endPhyRxEvent.IsExpired());
+    Ptr<const WifiPpdu> ppdu = event->GetPpdu();
+    const auto preamble = ppdu->GetTxVector().GetPreambleType();
+    // the NI changes occurring during the PHY header are all known by now, hence the fields
+    // can be evaluated in a row with the same outcome as at the end of each field
+    for (auto field = WIFI_PPDU_FIELD_PREAMBLE; field != WIFI_PPDU_FIELD_DATA;
+         field = GetNextField(field, preamble))
+    {
+        NS_ABORT_MSG_IF(field != WIFI_PPDU_FIELD_PREAMBLE && !DoStartReceiveField(field, event),
+                        "Unknown field " << field << " for this PHY entity");
+        if (const auto status = DoEndReceiveField(field, event); !status.isSuccess)
         {
-        case ABORT:
-            // Abort reception, but consider medium as busy
-            AbortCurrentReception(status.reason);
-            if (event->GetEndTime() > (Simulator::Now() + m_state->GetDelayUntilIdle()))
-            {
-                m_wifiPhy->SwitchMaybeToCcaBusy(ppdu);
-            }
-            break;
-        case DROP:
-            // Notify drop, keep in CCA busy, and perform same processing as IGNORE case
-            if (status.reason == FILTERED)
-            {
-                // PHY-RXSTART is immediately followed by PHY-RXEND (Filtered)
-                m_wifiPhy->m_phyRxPayloadBeginTrace(
-                    txVector,
-                    NanoSeconds(0)); // this callback (equivalent to PHY-RXSTART primitive) is also
-                                     // triggered for filtered PPDUs
-            }
-            m_wifiPhy->NotifyRxPpduDrop(ppdu, status.reason);
-            m_wifiPhy->NotifyCcaBusy(ppdu, GetRemainingDurationAfterField(ppdu, field));
-        // no break
-        case IGNORE:
-            // Keep in Rx state and reset at end
-            m_endRxPayloadEvents.push_back(
-                Simulator::Schedule(GetRemainingDurationAfterField(ppdu, field),
-                                    &PhyEntity::ResetReceive,
-                                    this,
-                                    event));
-            break;
-        default:
-            NS_FATAL_ERROR("Unknown action in case of failure");
+            HandleRxFieldFailure(status, event, event->GetEndTime() - Simulator::Now());
+            return;
+        }
+    }
+
+    if (m_wifiPhy->m_ccaResetEvent.IsPending())
+    {
+        // the reception is about to be aborted (OBSS PD), as it would have been before the
+        // start of the payload: stay in CCA busy until then
+        m_wifiPhy->NotifyCcaBusy(ppdu, event->GetEndTime() - Simulator::Now());
+        return;
+    }
+    StartReceivePayload(event);
+}
+
+void
+PhyEntity::HandleRxFieldFailure(const PhyFieldRxStatus& status,
+                                Ptr<Event> event,
+                                Time remainingDuration)
+{
+    NS_LOG_FUNCTION(this << status << *event << remainingDuration);
+    Ptr<const WifiPpdu> ppdu = event->GetPpdu();
+    switch (status.actionIfFailure)
+    {
+    case ABORT:
+        // Abort reception, but consider medium as busy
+        AbortCurrentReception(status.reason);
+        if (event->GetEndTime() > (Simulator::Now() + m_state->GetDelayUntilIdle()))
+        {
+            m_wifiPhy->SwitchMaybeToCcaBusy(ppdu);
+        }
+        break;
+    case DROP:
+        // Notify drop, keep in CCA busy, and perform same processing as IGNORE case
+        if (status.reason == FILTERED)
+        {
+            // PHY-RXSTART is immediately followed by PHY-RXEND (Filtered)
+            m_wifiPhy->m_phyRxPayloadBeginTrace(
+                ppdu->GetTxVector(),
+                NanoSeconds(0)); // this callback (equivalent to PHY-RXSTART primitive) is also
+                                 // triggered for filtered PPDUs
         }
+        m_wifiPhy->NotifyRxPpduDrop(ppdu, status.reason);
+        m_wifiPhy->NotifyCcaBusy(ppdu, remainingDuration);
+    // no break
+    case IGNORE:
+        // Keep in Rx state and reset at end
+        m_endRxPayloadEvents.push_back(
+            Simulator::Schedule(remainingDuration, &PhyEntity::ResetReceive, this, event));
+        break;
+    default:
+        NS_FATAL_ERROR("Unknown action in case of failure");
     }
 }
 
@@ -598,10 +637,11 @@ PhyEntity::ScheduleEndOfMpdus(Ptr<Event> event)
         (nMpdus > 1) ? FIRST_MPDU_IN_AGGREGATE : (psdu->IsSingle() ? SINGLE_MPDU : NORMAL_MPDU);
     uint32_t totalAmpduSize = 0;
     double totalAmpduNumSymbols = 0.0;
+    const auto abstracted = IsRxAbstracted(ppdu);
     auto mpdu = psdu->begin();
     for (size_t i = 0; i < nMpdus && mpdu != psdu->end(); ++mpdu)
     {
-        if (m_wifiPhy->m_notifyRxMacHeaderEnd)
+        if (m_wifiPhy->m_notifyRxMacHeaderEnd && !abstracted)
         {
             // calculate MAC header size (including A-MPDU subframe header, if present)
             auto macHdrSize =
@@ -650,18 +690,28 @@ PhyEntity::ScheduleEndOfMpdus(Ptr<Event> event)
         }
 
         endOfMpduDuration += mpduDuration;
-        NS_LOG_INFO("Schedule end of MPDU #"
-                    << i << " in " << endOfMpduDuration.As(Time::NS) << " (relativeStart="
-                    << relativeStart.As(Time::NS) << ", mpduDuration=" << mpduDuration.As(Time::NS)
-                    << ", remainingAmdpuDuration=" << remainingAmpduDuration.As(Time::NS) << ")");
-        m_endOfMpduEvents.push_back(Simulator::Schedule(endOfMpduDuration,
-                                                        &PhyEntity::EndOfMpdu,
-                                                        this,
-                                                        event,
-                                                        *mpdu,
-                                                        i,
-                                                        relativeStart,
-                                                        mpduDuration));
+        if (abstracted)
+        {
+            // the reception status of the MPDU is obtained at the end of the PPDU
+            m_abstractedMpdus.push_back({*mpdu, i, relativeStart, mpduDuration});
+        }
+        else
+        {
+            NS_LOG_INFO("Schedule end of MPDU #"
+                        << i << " in " << endOfMpduDuration.As(Time::NS)
+                        << " (relativeStart=" << relativeStart.As(Time::NS)
+                        << ", mpduDuration=" << mpduDuration.As(Time::NS)
+                        << ", remainingAmdpuDuration=" << remainingAmpduDuration.As(Time::NS)
+                        << ")");
+            m_endOfMpduEvents.push_back(Simulator::Schedule(endOfMpduDuration,
+                                                            &PhyEntity::EndOfMpdu,
+                                                            this,
+                                                            event,
+                                                            *mpdu,
+                                                            i,
+                                                            relativeStart,
+                                                            mpduDuration));
+        }
 
         // Prepare next iteration
         ++i;
@@ -715,6 +765,11 @@ PhyEntity::EndReceivePayload(Ptr<Event> event)
     NS_LOG_FUNCTION(
         this << *event << ppdu->GetTxDuration() - CalculatePhyPreambleAndHeaderDuration(txVector));
     NS_ASSERT(event->GetEndTime() == Simulator::Now());
+    for (const auto& [mpdu, index, relativeStart, duration] : m_abstractedMpdus)
+    {
+        EndOfMpdu(event, mpdu, index, relativeStart, duration);
+    }
+    m_abstractedMpdus.clear();
     const auto staId = GetStaId(ppdu);
     const auto channelWidthAndBand = GetChannelWidthAndBand(txVector, staId);
     const auto snr = m_wifiPhy->m_interference->CalculateSnr(event,
@@ -947,6 +1002,7 @@ PhyEntity::NotifyInterferenceRxEndAndClear(bool reset)
         NS_ASSERT(endOfMacHdrEvent.IsExpired());
     }
     m_endOfMacHdrEvents.clear();
+    m_abstractedMpdus.clear();
     if (reset)
     {
         m_wifiPhy->Reset();
@@ -1087,6 +1143,18 @@ PhyEntity::EndPreambleDetectionPeriod(Ptr<Event> event)
                                  m_wifiPhy->m_currentEvent->GetRxPowerPerBand());
         m_wifiPhy->m_timeLastPreambleDetected = Simulator::Now();
 
+        if (IsRxAbstracted(event->GetPpdu()))
+        {
+            // Receive the whole PHY header at once
+            const auto durationTillEnd =
+                CalculatePhyPreambleAndHeaderDuration(event->GetPpdu()->GetTxVector()) -
+                m_wifiPhy->GetPreambleDetectionDuration();
+            m_wifiPhy->NotifyCcaBusy(event->GetPpdu(), durationTillEnd);
+            m_wifiPhy->m_endPhyRxEvent =
+                Simulator::Schedule(durationTillEnd, &PhyEntity::EndReceivePhyHeader, this, event);
+            return;
+        }
+
         // Continue receiving preamble
         const auto durationTillEnd =
             GetDuration(WIFI_PPDU_FIELD_PREAMBLE, event->GetPpdu()->GetTxVector()) -
@@ -1152,6 +1220,7 @@ PhyEntity::CancelAllEvents()
         endMacHdrEvent.Cancel();
     }
     m_endOfMacHdrEvents.clear();
+    m_abstractedMpdus.clear();
 }
 
 bool
@@ -1195,6 +1264,7 @@ PhyEntity::DoAbortCurrentReception(WifiPhyRxfailureReason reason)
             endMacHdrEvent.Cancel();
         }
         m_endOfMacHdrEvents.clear();
+        m_abstractedMpdus.clear();
     }
 }
 
@@ -1219,6 +1289,12 @@ PhyEntity::DoResetReceive(Ptr<Event> event)
     NS_ASSERT(event->GetEndTime() == Simulator::Now());
 }
 
+bool
+PhyEntity::IsRxAbstracted(Ptr<const WifiPpdu> ppdu) const
+{
+    return m_wifiPhy->m_abstraction && ppdu->GetType() == WIFI_PPDU_TYPE_SU;
+}
+
 double
 PhyEntity::GetRandomValue() const
 {
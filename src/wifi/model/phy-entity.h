@@ -381,6 +381,18 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
      * \param event the event holding incoming PPDU's information
      */
     void EndReceiveField(WifiPpduField field, Ptr<Event> event);
+    /**
+     * End receiving the PHY header (i.e., all the fields preceding the data field) of a PPDU
+     * whose reception is abstracted (\see IsRxAbstracted).
+     *
+     * This method will call the DoStartReceiveField and DoEndReceiveField of every field of
+     * the PHY header in turn, as EndReceiveField would have done at the end of each field.
+     * In case of success, reception of the payload is started. In case of failure, the
+     * indications in the returned \see PhyFieldRxStatus are performed.
+     *
+     * \param event the event holding incoming PPDU's information
+     */
+    void EndReceivePhyHeader(Ptr<Event> event);
 
     /**
      * The last symbol of the PPDU has arrived.
@@ -651,6 +663,28 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
      */
     void DropPreambleEvent(Ptr<const WifiPpdu> ppdu, WifiPhyRxfailureReason reason, Time endRx);
 
+    /**
+     * Perform the indications of the given status after the reception of a field has failed.
+     *
+     * \param status the status of the reception of the field
+     * \param event the event holding incoming PPDU's information
+     * \param remainingDuration the remaining duration of the PPDU after the field
+     */
+    void HandleRxFieldFailure(const PhyFieldRxStatus& status,
+                              Ptr<Event> event,
+                              Time remainingDuration);
+
+    /**
+     * Return whether the reception of the given PPDU is abstracted, i.e., whether the PHY header
+     * is evaluated in a single event at the end of the PHY header and the MPDUs in a single
+     * event at the end of the PPDU. This is the case for SU PPDUs if the Abstraction attribute
+     * of the WifiPhy is set.
+     *
+     * \param ppdu the incoming PPDU
+     * \return \c true if the reception of the PPDU is abstracted, \c false otherwise
+     */
+    bool IsRxAbstracted(Ptr<const WifiPpdu> ppdu) const;
+
     /**
      * Erase the event corresponding to the PPDU from the list of preamble events,
      * but consider it as noise after the completion of the current event.
@@ -949,6 +983,18 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
     std::vector<EventId>
         m_endRxPayloadEvents; //!< the end of receive events (only one unless UL MU reception)
 
+    /// Information about an MPDU whose reception is evaluated at the end of the PPDU
+    struct AbstractedMpdu
+    {
+        Ptr<WifiMpdu> mpdu; //!< the MPDU
+        size_t index;       //!< the index of the MPDU within the A-MPDU
+        Time relativeStart; //!< the start time of the MPDU relative to the start of the payload
+        Time duration;      //!< the duration of the MPDU
+    };
+
+    std::vector<AbstractedMpdu>
+        m_abstractedMpdus; //!< the MPDUs of the PPDU under reception, if abstracted
+
     /**
      * A pair of a UID and STA_ID
      */
@@ -1421,97 +1421,86 @@ MinstrelHtWifiManager::UpdateStats(MinstrelHtWifiRemoteStation* station)
 
     /* Initialize global rate indexes */
     station->m_maxTpRate = GetLowestIndex(station);
-    station->m_maxTpRate2 = GetLowestIndex(station);
-    station->m_maxProbRate = GetLowestIndex(station);
+    station->m_maxTpRate2 = station->m_maxTpRate;
+    station->m_maxProbRate = station->m_maxTpRate;
 
     /// Update throughput and EWMA for each rate inside each group.
     for (uint8_t j = 0; j < m_numGroups; j++)
     {
-        if (station->m_groupsTable[j].m_supported)
+        auto& group = station->m_groupsTable[j];
+        if (!group.m_supported)
         {
-            station->m_sampleCount++;
+            continue;
+        }
 
-            /* (re)Initialize group rate indexes */
-            station->m_groupsTable[j].m_maxTpRate = GetLowestIndex(station, j);
-            station->m_groupsTable[j].m_maxTpRate2 = GetLowestIndex(station, j);
-            station->m_groupsTable[j].m_maxProbRate = GetLowestIndex(station, j);
+        station->m_sampleCount++;
 
-            for (uint8_t i = 0; i < m_numRates; i++)
+        /* (re)Initialize group rate indexes */
+        group.m_maxTpRate = GetLowestIndex(station, j);
+        group.m_maxTpRate2 = group.m_maxTpRate;
+        group.m_maxProbRate = group.m_maxTpRate;
+
+        for (uint8_t i = 0; i < m_numRates; i++)
+        {
+            auto& rate = group.m_ratesTable[i];
+            if (!rate.supported)
             {
-                if (station->m_groupsTable[j].m_ratesTable[i].supported)
-                {
-                    station->m_groupsTable[j].m_ratesTable[i].retryUpdated = false;
-
-                    NS_LOG_DEBUG(
-                        +i << " "
-                           << GetMcsSupported(station,
-                                              station->m_groupsTable[j].m_ratesTable[i].mcsIndex)
-                           << "\t attempt="
-                           << station->m_groupsTable[j].m_ratesTable[i].numRateAttempt
-                           << "\t success="
-                           << station->m_groupsTable[j].m_ratesTable[i].numRateSuccess);
-
-                    /// If we've attempted something.
-                    if (station->m_groupsTable[j].m_ratesTable[i].numRateAttempt > 0)
-                    {
-                        station->m_groupsTable[j].m_ratesTable[i].numSamplesSkipped = 0;
-                        /**
-                         * Calculate the probability of success.
-                         * Assume probability scales from 0 to 100.
-                         */
-                        tempProb =
-                            (100 * station->m_groupsTable[j].m_ratesTable[i].numRateSuccess) /
-                            station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-
-                        /// Bookkeeping.
-                        station->m_groupsTable[j].m_ratesTable[i].prob = tempProb;
-
-                        if (station->m_groupsTable[j].m_ratesTable[i].successHist == 0)
-                        {
-                            station->m_groupsTable[j].m_ratesTable[i].ewmaProb = tempProb;
-                        }
-                        else
-                        {
-                            station->m_groupsTable[j].m_ratesTable[i].ewmsdProb =
-                                CalculateEwmsd(station->m_groupsTable[j].m_ratesTable[i].ewmsdProb,
-                                               tempProb,
-                                               station->m_groupsTable[j].m_ratesTable[i].ewmaProb,
-                                               m_ewmaLevel);
-                            /// EWMA probability
-                            tempProb =
-                                (tempProb * (100 - m_ewmaLevel) +
-                                 station->m_groupsTable[j].m_ratesTable[i].ewmaProb * m_ewmaLevel) /
-                                100;
-                            station->m_groupsTable[j].m_ratesTable[i].ewmaProb = tempProb;
-                        }
+                continue;
+            }
 
-                        station->m_groupsTable[j].m_ratesTable[i].throughput =
-                            CalculateThroughput(station, j, i, tempProb);
+            rate.retryUpdated = false;
 
-                        station->m_groupsTable[j].m_ratesTable[i].successHist +=
-                            station->m_groupsTable[j].m_ratesTable[i].numRateSuccess;
-                        station->m_groupsTable[j].m_ratesTable[i].attemptHist +=
-                            station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-                    }
-                    else
-                    {
-                        station->m_groupsTable[j].m_ratesTable[i].numSamplesSkipped++;
-                    }
+            NS_LOG_DEBUG(+i << " " << GetMcsSupported(station, rate.mcsIndex)
+                            << "\t attempt=" << rate.numRateAttempt
+                            << "\t success=" << rate.numRateSuccess);
 
-                    /// Bookkeeping.
-                    station->m_groupsTable[j].m_ratesTable[i].prevNumRateSuccess =
-                        station->m_groupsTable[j].m_ratesTable[i].numRateSuccess;
-                    station->m_groupsTable[j].m_ratesTable[i].prevNumRateAttempt =
-                        station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-                    station->m_groupsTable[j].m_ratesTable[i].numRateSuccess = 0;
-                    station->m_groupsTable[j].m_ratesTable[i].numRateAttempt = 0;
+            /// If we've attempted something.
+            if (rate.numRateAttempt > 0)
+            {
+                rate.numSamplesSkipped = 0;
+                /**
+                 * Calculate the probability of success.
+                 * Assume probability scales from 0 to 100.
+                 */
+                tempProb = (100 * rate.numRateSuccess) / rate.numRateAttempt;
 
-                    if (station->m_groupsTable[j].m_ratesTable[i].throughput != 0)
-                    {
-                        SetBestStationThRates(station, GetIndex(j, i));
-                        SetBestProbabilityRate(station, GetIndex(j, i));
-                    }
+                /// Bookkeeping.
+                rate.prob = tempProb;
+
+                if (rate.successHist == 0)
+                {
+                    rate.ewmaProb = tempProb;
                 }
+                else
+                {
+                    rate.ewmsdProb =
+                        CalculateEwmsd(rate.ewmsdProb, tempProb, rate.ewmaProb, m_ewmaLevel);
+                    /// EWMA probability
+                    tempProb =
+                        (tempProb * (100 - m_ewmaLevel) + rate.ewmaProb * m_ewmaLevel) / 100;
+                    rate.ewmaProb = tempProb;
+                }
+
+                rate.throughput = CalculateThroughput(station, j, i, tempProb);
+
+                rate.successHist += rate.numRateSuccess;
+                rate.attemptHist += rate.numRateAttempt;
+            }
+            else
+            {
+                rate.numSamplesSkipped++;
+            }
+
+            /// Bookkeeping.
+            rate.prevNumRateSuccess = rate.numRateSuccess;
+            rate.prevNumRateAttempt = rate.numRateAttempt;
+            rate.numRateSuccess = 0;
+            rate.numRateAttempt = 0;
+
+            if (rate.throughput != 0)
+            {
+                SetBestStationThRates(station, GetIndex(j, i));
+                SetBestProbabilityRate(station, GetIndex(j, i));
             }
         }
     }
@@ -1569,7 +1558,7 @@ void
 MinstrelHtWifiManager::SetBestProbabilityRate(MinstrelHtWifiRemoteStation* station, uint16_t index)
 {
     GroupInfo* group;
-    MinstrelHtRateInfo rate;
+    const MinstrelHtRateInfo* rate;
     uint8_t tmpGroupId;
     uint8_t tmpRateId;
     double tmpTh;
@@ -1585,14 +1574,14 @@ MinstrelHtWifiManager::SetBestProbabilityRate(MinstrelHtWifiRemoteStation* stati
     groupId = GetGroupId(index);
     rateId = GetRateId(index);
     group = &station->m_groupsTable[groupId];
-    rate = group->m_ratesTable[rateId];
+    rate = &group->m_ratesTable[rateId];
 
     tmpGroupId = GetGroupId(station->m_maxProbRate);
     tmpRateId = GetRateId(station->m_maxProbRate);
     tmpProb = station->m_groupsTable[tmpGroupId].m_ratesTable[tmpRateId].ewmaProb;
     tmpTh = station->m_groupsTable[tmpGroupId].m_ratesTable[tmpRateId].throughput;
 
-    if (rate.ewmaProb > 75)
+    if (rate->ewmaProb > 75)
     {
         currentTh = station->m_groupsTable[groupId].m_ratesTable[rateId].throughput;
         if (currentTh > tmpTh)
@@ -1611,12 +1600,12 @@ MinstrelHtWifiManager::SetBestProbabilityRate(MinstrelHtWifiRemoteStation* stati
     }
     else
     {
-        if (rate.ewmaProb > tmpProb)
+        if (rate->ewmaProb > tmpProb)
         {
             station->m_maxProbRate = index;
         }
         maxGPRateId = GetRateId(group->m_maxProbRate);
-        if (rate.ewmaProb > group->m_ratesTable[maxGPRateId].ewmaProb)
+        if (rate->ewmaProb > group->m_ratesTable[maxGPRateId].ewmaProb)
         {
             group->m_maxProbRate = index;
         }
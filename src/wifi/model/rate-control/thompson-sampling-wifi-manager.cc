@@ -24,18 +24,13 @@ namespace ns3
 {
 
 /**
- * A structure containing parameters of a single rate and its
- * statistics.
+ * A structure containing the parameters of a single rate.
  */
 struct RateStats
 {
     WifiMode mode;      ///< MCS
     MHz_u channelWidth; ///< channel width
     uint8_t nss;        ///< Number of spatial streams
-
-    double success{0.0}; ///< averaged number of successful transmissions
-    double fails{0.0};   ///< averaged number of failed transmissions
-    Time lastDecay{0};   ///< last time exponential decay was applied to this rate
 };
 
 /**
@@ -43,13 +38,25 @@ struct RateStats
  *
  * This struct extends from WifiRemoteStation to hold additional
  * information required by ThompsonSamplingWifiManager.
+ *
+ * The statistics of the rates are stored in separate arrays (indexed like
+ * m_mcsStats), which are swept in a single pass every time a new mode is
+ * drawn. All the rates are decayed at the same time, hence a single decay
+ * timestamp is kept for the station.
  */
 struct ThompsonSamplingWifiRemoteStation : public WifiRemoteStation
 {
     size_t m_nextMode; //!< Mode to select for the next transmission
     size_t m_lastMode; //!< Most recently used mode, used to write statistics
 
-    std::vector<RateStats> m_mcsStats; //!< Collected statistics
+    std::vector<RateStats> m_mcsStats; //!< Parameters of the rates
+    std::vector<double> m_success;     //!< averaged number of successful transmissions, per rate
+    std::vector<double> m_fails;       //!< averaged number of failed transmissions, per rate
+    Time m_lastDecay{0};               //!< last time exponential decay was applied to the rates
+
+    std::vector<uint64_t> m_dataRates; //!< data rates (bps) of the rates
+    Time m_dataRatesGi{0};             //!< guard interval of the HE rates in m_dataRates
+    bool m_dataRatesSgi{false};        //!< whether m_dataRates uses the short GI for HT/VHT rates
 };
 
 NS_OBJECT_ENSURE_REGISTERED(ThompsonSamplingWifiManager);
@@ -164,6 +171,9 @@ ThompsonSamplingWifiManager::InitializeStation(WifiRemoteStation* st) const
 
     NS_ASSERT_MSG(!station->m_mcsStats.empty(), "No usable MCS found");
 
+    station->m_success.assign(station->m_mcsStats.size(), 0.0);
+    station->m_fails.assign(station->m_mcsStats.size(), 0.0);
+
     UpdateNextMode(st);
 }
 
@@ -185,8 +195,8 @@ ThompsonSamplingWifiManager::DoReportDataFailed(WifiRemoteStation* st)
     NS_LOG_FUNCTION(this << st);
     InitializeStation(st);
     auto station = static_cast<ThompsonSamplingWifiRemoteStation*>(st);
-    Decay(st, station->m_lastMode);
-    station->m_mcsStats.at(station->m_lastMode).fails++;
+    Decay(st);
+    station->m_fails.at(station->m_lastMode)++;
     UpdateNextMode(st);
 }
 
@@ -210,34 +220,56 @@ ThompsonSamplingWifiManager::UpdateNextMode(WifiRemoteStation* st) const
 
     NS_ASSERT(!station->m_mcsStats.empty());
 
+    Decay(st);
+    UpdateDataRates(st);
+
     // Use the most robust MCS if frameSuccessRate is 0 for all MCS.
     station->m_nextMode = 0;
 
-    for (uint32_t i = 0; i < station->m_mcsStats.size(); i++)
+    for (std::size_t i = 0; i < station->m_mcsStats.size(); i++)
     {
-        Decay(st, i);
-        const auto mode{station->m_mcsStats.at(i).mode};
-
-        const auto guardInterval = GetModeGuardInterval(st, mode);
-        const auto rate = mode.GetDataRate(station->m_mcsStats.at(i).channelWidth,
-                                           guardInterval,
-                                           station->m_mcsStats.at(i).nss);
-
         // Thompson sampling
-        frameSuccessRate = SampleBetaVariable(1.0 + station->m_mcsStats.at(i).success,
-                                              1.0 + station->m_mcsStats.at(i).fails);
+        frameSuccessRate =
+            SampleBetaVariable(1.0 + station->m_success[i], 1.0 + station->m_fails[i]);
         NS_LOG_DEBUG("Draw"
-                     << " success=" << station->m_mcsStats.at(i).success
-                     << " fails=" << station->m_mcsStats.at(i).fails
-                     << " frameSuccessRate=" << frameSuccessRate << " mode=" << mode);
-        if (frameSuccessRate * rate > maxThroughput)
+                     << " success=" << station->m_success[i] << " fails=" << station->m_fails[i]
+                     << " frameSuccessRate=" << frameSuccessRate
+                     << " mode=" << station->m_mcsStats[i].mode);
+        if (frameSuccessRate * station->m_dataRates[i] > maxThroughput)
         {
-            maxThroughput = frameSuccessRate * rate;
+            maxThroughput = frameSuccessRate * station->m_dataRates[i];
             station->m_nextMode = i;
         }
     }
 }
 
+void
+ThompsonSamplingWifiManager::UpdateDataRates(WifiRemoteStation* st) const
+{
+    auto station = static_cast<ThompsonSamplingWifiRemoteStation*>(st);
+
+    // the guard interval of a rate only depends on its modulation class and on
+    // the capabilities of the station, which may change after the association
+    const auto heGi = std::max(GetGuardInterval(st), GetGuardInterval());
+    const auto sgi = GetShortGuardIntervalSupported(st) && GetShortGuardIntervalSupported();
+    if (!station->m_dataRates.empty() && station->m_dataRatesGi == heGi &&
+        station->m_dataRatesSgi == sgi)
+    {
+        return;
+    }
+
+    NS_LOG_FUNCTION(this << st << heGi << sgi);
+    station->m_dataRates.resize(station->m_mcsStats.size());
+    for (std::size_t i = 0; i < station->m_mcsStats.size(); i++)
+    {
+        const auto& rate = station->m_mcsStats[i];
+        station->m_dataRates[i] =
+            rate.mode.GetDataRate(rate.channelWidth, GetModeGuardInterval(st, rate.mode), rate.nss);
+    }
+    station->m_dataRatesGi = heGi;
+    station->m_dataRatesSgi = sgi;
+}
+
 void
 ThompsonSamplingWifiManager::DoReportDataOk(WifiRemoteStation* st,
                                             double ackSnr,
@@ -249,8 +281,8 @@ ThompsonSamplingWifiManager::DoReportDataOk(WifiRemoteStation* st,
     NS_LOG_FUNCTION(this << st << ackSnr << ackMode.GetUniqueName() << dataSnr);
     InitializeStation(st);
     auto station = static_cast<ThompsonSamplingWifiRemoteStation*>(st);
-    Decay(st, station->m_lastMode);
-    station->m_mcsStats.at(station->m_lastMode).success++;
+    Decay(st);
+    station->m_success.at(station->m_lastMode)++;
     UpdateNextMode(st);
 }
 
@@ -267,9 +299,9 @@ ThompsonSamplingWifiManager::DoReportAmpduTxStatus(WifiRemoteStation* st,
     InitializeStation(st);
     auto station = static_cast<ThompsonSamplingWifiRemoteStation*>(st);
 
-    Decay(st, station->m_lastMode);
-    station->m_mcsStats.at(station->m_lastMode).success += nSuccessfulMpdus;
-    station->m_mcsStats.at(station->m_lastMode).fails += nFailedMpdus;
+    Decay(st);
+    station->m_success.at(station->m_lastMode) += nSuccessfulMpdus;
+    station->m_fails.at(station->m_lastMode) += nFailedMpdus;
 
     UpdateNextMode(st);
 }
@@ -324,7 +356,10 @@ ThompsonSamplingWifiManager::DoGetDataTxVector(WifiRemoteStation* st, MHz_u allo
                  << " mode=" << mode << " channelWidth=" << channelWidth << " nss=" << +nss
                  << " guardInterval=" << guardInterval);
 
-    const auto rate = mode.GetDataRate(channelWidth, guardInterval, nss);
+    UpdateDataRates(st);
+    const auto rate = (channelWidth == stats.channelWidth)
+                          ? station->m_dataRates.at(station->m_nextMode)
+                          : mode.GetDataRate(channelWidth, guardInterval, nss);
     if (m_currentRate != rate)
     {
         NS_LOG_DEBUG("New datarate: " << rate);
@@ -381,21 +416,26 @@ ThompsonSamplingWifiManager::SampleBetaVariable(uint64_t alpha, uint64_t beta) c
 }
 
 void
-ThompsonSamplingWifiManager::Decay(WifiRemoteStation* st, size_t i) const
+ThompsonSamplingWifiManager::Decay(WifiRemoteStation* st) const
 {
-    NS_LOG_FUNCTION(this << st << i);
+    NS_LOG_FUNCTION(this << st);
     InitializeStation(st);
     auto station = static_cast<ThompsonSamplingWifiRemoteStation*>(st);
 
     Time now = Simulator::Now();
-    auto& stats = station->m_mcsStats.at(i);
-    if (now > stats.lastDecay)
+    if (now > station->m_lastDecay)
     {
-        const double coefficient = std::exp(m_decay * (stats.lastDecay - now).GetSeconds());
+        const double coefficient = std::exp(m_decay * (station->m_lastDecay - now).GetSeconds());
 
-        stats.success *= coefficient;
-        stats.fails *= coefficient;
-        stats.lastDecay = now;
+        for (auto& success : station->m_success)
+        {
+            success *= coefficient;
+        }
+        for (auto& fails : station->m_fails)
+        {
+            fails *= coefficient;
+        }
+        station->m_lastDecay = now;
     }
 }
 
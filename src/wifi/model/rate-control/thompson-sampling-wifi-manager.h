@@ -87,12 +87,19 @@ class ThompsonSamplingWifiManager : public WifiRemoteStationManager
     void UpdateNextMode(WifiRemoteStation* station) const;
 
     /**
-     * Applies exponential decay to MCS statistics.
+     * Applies exponential decay to the statistics of all the MCSs.
      *
      * \param st Remote STA for which MCS statistics is to be updated.
-     * \param i MCS index.
      */
-    void Decay(WifiRemoteStation* st, size_t i) const;
+    void Decay(WifiRemoteStation* st) const;
+
+    /**
+     * Computes the data rates of the MCSs of the given station, unless they have
+     * already been computed for the current guard intervals of the station.
+     *
+     * \param st Remote STA
+     */
+    void UpdateDataRates(WifiRemoteStation* st) const;
 
     /**
      * Returns guard interval for the given mode.
@@ -17,6 +17,7 @@
 #include "ns3/packet.h"
 
 #include <algorithm>
+#include <bit>
 
 namespace ns3
 {
@@ -122,12 +123,12 @@ RecipientBlockAckAgreement::NotifyReceivedMpdu(Ptr<const WifiMpdu> mpdu)
     if (distance < m_scoreboard.GetWinSize())
     {
         // set to 1 the bit in position SN within the bitmap
-        m_scoreboard.At(distance) = true;
+        m_scoreboard.Set(distance);
     }
     else if (distance < SEQNO_SPACE_HALF_SIZE)
     {
         m_scoreboard.Advance(distance - m_scoreboard.GetWinSize() + 1);
-        m_scoreboard.At(m_scoreboard.GetWinSize() - 1) = true;
+        m_scoreboard.Set(m_scoreboard.GetWinSize() - 1);
     }
 
     distance = GetDistance(mpduSeqNumber, m_winStartB);
@@ -242,11 +243,13 @@ RecipientBlockAckAgreement::FillBlockAckBitmap(CtrlBAckResponseHeader* blockAckH
         blockAckHeader->SetStartingSequence(ssn, index);
         blockAckHeader->ResetBitmap(index);
 
-        for (std::size_t i = 0; i < m_scoreboard.GetWinSize(); i++)
+        // read the scoreboard a word at a time and skip the MPDUs not received
+        for (std::size_t i = 0; i < m_scoreboard.GetWinSize(); i += 64)
         {
-            if (m_scoreboard.At(i))
+            for (auto word = m_scoreboard.GetWord(i); word != 0; word &= word - 1)
             {
-                blockAckHeader->SetReceivedPacket((ssn + i) % SEQNO_SPACE_SIZE, index);
+                const auto distance = i + std::countr_zero(word);
+                blockAckHeader->SetReceivedPacket((ssn + distance) % SEQNO_SPACE_SIZE, index);
             }
         }
     }
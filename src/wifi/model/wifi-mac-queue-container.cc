@@ -24,22 +24,24 @@ WifiMacQueueContainer::clear()
 {
     m_queues.clear();
     m_expiredQueue.clear();
-    m_nBytesPerQueue.clear();
+    m_nextExpiryTimes.clear();
 }
 
 WifiMacQueueContainer::iterator
 WifiMacQueueContainer::insert(const_iterator pos, Ptr<WifiMpdu> item)
 {
     WifiContainerQueueId queueId = GetQueueId(item);
+    auto& info = m_queues[queueId];
 
-    NS_ABORT_MSG_UNLESS(pos == m_queues[queueId].cend() || GetQueueId(pos->mpdu) == queueId,
+    NS_ABORT_MSG_UNLESS(pos == info.queue.cend() || GetQueueId(pos->mpdu) == queueId,
                         "pos iterator does not point to the correct container queue");
     NS_ABORT_MSG_IF(!item->IsOriginal(), "Only the original copy of an MPDU can be inserted");
 
-    auto [it, ret] = m_nBytesPerQueue.insert({queueId, 0});
-    it->second += item->GetSize();
+    info.nBytes += item->GetSize();
 
-    return m_queues[queueId].emplace(pos, item);
+    auto it = info.queue.emplace(pos, item);
+    AddExpiryTime(queueId, info, it);
+    return it;
 }
 
 WifiMacQueueContainer::iterator
@@ -51,12 +53,14 @@ WifiMacQueueContainer::erase(const_iterator pos)
     }
 
     WifiContainerQueueId queueId = GetQueueId(pos->mpdu);
-    auto it = m_nBytesPerQueue.find(queueId);
-    NS_ASSERT(it != m_nBytesPerQueue.end());
-    NS_ASSERT(it->second >= pos->mpdu->GetSize());
-    it->second -= pos->mpdu->GetSize();
-
-    return m_queues[queueId].erase(pos);
+    auto queueIt = m_queues.find(queueId);
+    NS_ASSERT(queueIt != m_queues.end());
+    auto& info = queueIt->second;
+    NS_ASSERT(info.nBytes >= pos->mpdu->GetSize());
+    info.nBytes -= pos->mpdu->GetSize();
+    RemoveExpiryTime(queueId, info, pos);
+
+    return info.queue.erase(pos);
 }
 
 Ptr<WifiMpdu>
@@ -65,6 +69,59 @@ WifiMacQueueContainer::GetItem(const const_iterator it) const
     return it->mpdu;
 }
 
+void
+WifiMacQueueContainer::SetExpiryTime(iterator it, Time expiryTime) const
+{
+    NS_ASSERT(!it->expired);
+
+    WifiContainerQueueId queueId = GetQueueId(it->mpdu);
+    auto queueIt = m_queues.find(queueId);
+    NS_ASSERT(queueIt != m_queues.end());
+    RemoveExpiryTime(queueId, queueIt->second, it);
+    it->expiryTime = expiryTime;
+    AddExpiryTime(queueId, queueIt->second, it);
+}
+
+void
+WifiMacQueueContainer::AddExpiryTime(const WifiContainerQueueId& queueId,
+                                     QueueInfo& info,
+                                     iterator it) const
+{
+    if (!info.expiryTimes.empty() && *info.expiryTimes.cbegin() <= it->expiryTime)
+    {
+        // the earliest expiry time of the container queue does not change
+        it->expiryIt = info.expiryTimes.insert(it->expiryTime);
+        return;
+    }
+
+    if (!info.expiryTimes.empty())
+    {
+        m_nextExpiryTimes.erase({*info.expiryTimes.cbegin(), queueId});
+    }
+    it->expiryIt = info.expiryTimes.insert(it->expiryTime);
+    m_nextExpiryTimes.emplace(it->expiryTime, queueId);
+}
+
+void
+WifiMacQueueContainer::RemoveExpiryTime(const WifiContainerQueueId& queueId,
+                                        QueueInfo& info,
+                                        const_iterator it) const
+{
+    if (it->expiryIt != info.expiryTimes.cbegin())
+    {
+        // the earliest expiry time of the container queue does not change
+        info.expiryTimes.erase(it->expiryIt);
+        return;
+    }
+
+    m_nextExpiryTimes.erase({*it->expiryIt, queueId});
+    info.expiryTimes.erase(it->expiryIt);
+    if (!info.expiryTimes.empty())
+    {
+        m_nextExpiryTimes.emplace(*info.expiryTimes.cbegin(), queueId);
+    }
+}
+
 WifiContainerQueueId
 WifiMacQueueContainer::GetQueueId(Ptr<const WifiMpdu> mpdu)
 {
@@ -91,28 +148,37 @@ WifiMacQueueContainer::GetQueueId(Ptr<const WifiMpdu> mpdu)
 const WifiMacQueueContainer::ContainerQueue&
 WifiMacQueueContainer::GetQueue(const WifiContainerQueueId& queueId) const
 {
-    return m_queues[queueId];
+    return m_queues[queueId].queue;
 }
 
 uint32_t
 WifiMacQueueContainer::GetNBytes(const WifiContainerQueueId& queueId) const
 {
-    if (auto it = m_queues.find(queueId); it == m_queues.end() || it->second.empty())
+    if (auto it = m_queues.find(queueId); it != m_queues.end())
     {
-        return 0;
+        return it->second.nBytes;
     }
-    return m_nBytesPerQueue.at(queueId);
+    return 0;
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::ExtractExpiredMpdus(const WifiContainerQueueId& queueId) const
 {
-    return DoExtractExpiredMpdus(m_queues[queueId]);
+    auto& info = m_queues[queueId];
+
+    if (info.expiryTimes.empty() || *info.expiryTimes.cbegin() > Simulator::Now())
+    {
+        // no MPDU in the container queue has expired lifetime
+        return {info.queue.end(), info.queue.end()};
+    }
+    return DoExtractExpiredMpdus(queueId, info);
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
-WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
+WifiMacQueueContainer::DoExtractExpiredMpdus(const WifiContainerQueueId& queueId,
+                                             QueueInfo& info) const
 {
+    auto& queue = info.queue;
     std::optional<std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>> ret;
     auto firstExpiredIt = queue.begin();
     auto lastExpiredIt = firstExpiredIt;
@@ -142,11 +208,9 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
             lastExpiredIt->ac = AC_UNDEF;
             lastExpiredIt->deleter(lastExpiredIt->mpdu);
 
-            WifiContainerQueueId queueId = GetQueueId(lastExpiredIt->mpdu);
-            auto it = m_nBytesPerQueue.find(queueId);
-            NS_ASSERT(it != m_nBytesPerQueue.end());
-            NS_ASSERT(it->second >= lastExpiredIt->mpdu->GetSize());
-            it->second -= lastExpiredIt->mpdu->GetSize();
+            NS_ASSERT(info.nBytes >= lastExpiredIt->mpdu->GetSize());
+            info.nBytes -= lastExpiredIt->mpdu->GetSize();
+            RemoveExpiryTime(queueId, info, lastExpiredIt);
 
             ++lastExpiredIt;
         }
@@ -167,10 +231,20 @@ std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::ExtractAllExpiredMpdus() const
 {
     std::optional<WifiMacQueueContainer::iterator> firstExpiredIt;
+    Time now = Simulator::Now();
+
+    // only the container queues whose earliest expiry time has elapsed hold MPDUs with
+    // expired lifetime. Collect them first, because the extraction updates their entries
+    std::vector<WifiContainerQueueId> queueIds;
+    for (auto it = m_nextExpiryTimes.cbegin(); it != m_nextExpiryTimes.cend() && it->first <= now;
+         ++it)
+    {
+        queueIds.push_back(it->second);
+    }
 
-    for (auto& queue : m_queues)
+    for (const auto& queueId : queueIds)
     {
-        auto [firstIt, lastIt] = DoExtractExpiredMpdus(queue.second);
+        auto [firstIt, lastIt] = DoExtractExpiredMpdus(queueId, m_queues.at(queueId));
 
         if (firstIt != lastIt && !firstExpiredIt)
         {
@@ -198,16 +272,19 @@ std::size_t
 std::hash<ns3::WifiContainerQueueId>::operator()(ns3::WifiContainerQueueId queueId) const
 {
     auto [type, addrType, address, tid] = queueId;
-    const std::size_t size = tid.has_value() ? 8 : 7;
 
-    std::vector<uint8_t> buffer(size);
-    buffer[0] = type;
-    address.CopyTo(&buffer[1]);
-    if (tid.has_value())
+    // pack the queue ID in a 64-bit value: the address in the 48 least significant bits,
+    // then the queue type, the receiver address type and the TID (plus one, if any)
+    uint8_t buffer[6];
+    address.CopyTo(buffer);
+    uint64_t key = 0;
+    for (const auto byte : buffer)
     {
-        buffer[7] = *tid;
+        key = (key << 8) | byte;
     }
+    key |= static_cast<uint64_t>(type) << 48;
+    key |= static_cast<uint64_t>(addrType) << 52;
+    key |= static_cast<uint64_t>(tid.has_value() ? *tid + 1 : 0) << 56;
 
-    std::string s(buffer.begin(), buffer.end());
-    return std::hash<std::string>{}(s);
+    return std::hash<uint64_t>{}(key);
 }
@@ -15,6 +15,7 @@
 
 #include <list>
 #include <optional>
+#include <set>
 #include <tuple>
 #include <unordered_map>
 
@@ -98,6 +99,11 @@ namespace ns3
  *
  * This container holds multiple container queues organized in an hash table
  * whose keys are WifiContainerQueueId tuples identifying the container queues.
+ *
+ * The expiry times of the MPDUs of each container queue are indexed, and the
+ * container keeps the container queues sorted by the earliest expiry time of
+ * their MPDUs. Hence, the extraction of the MPDUs with expired lifetime only
+ * visits the container queues holding such MPDUs.
  */
 class WifiMacQueueContainer
 {
@@ -139,6 +145,16 @@ class WifiMacQueueContainer
      */
     Ptr<WifiMpdu> GetItem(const const_iterator it) const;
 
+    /**
+     * Set the expiry time of the MPDU included in the element pointed to by the given
+     * iterator, which must point to an element of a container queue (i.e., not to an
+     * MPDU with expired lifetime).
+     *
+     * \param it the given iterator
+     * \param expiryTime the expiry time of the MPDU
+     */
+    void SetExpiryTime(iterator it, Time expiryTime) const;
+
     /**
      * Return the QueueId identifying the container queue in which the given MPDU is
      * (or is to be) enqueued. Note that the given MPDU must not contain a control frame.
@@ -194,21 +210,53 @@ class WifiMacQueueContainer
     std::pair<iterator, iterator> GetAllExpiredMpdus() const;
 
   private:
+    /// Information about a container queue
+    struct QueueInfo
+    {
+        ContainerQueue queue;            //!< the container queue
+        uint32_t nBytes{0};              //!< size in bytes of the MPDUs in the container queue
+        std::multiset<Time> expiryTimes; //!< expiry times of the MPDUs in the container queue
+    };
+
     /**
      * Transfer non-inflight MPDUs with expired lifetime in the given container queue to the
      * container queue storing MPDUs with expired lifetime.
      *
-     * \param queue the given container queue
+     * \param queueId the QueueId identifying the given container queue
+     * \param info the information about the given container queue
      * \return the range [first, last) of iterators pointing to the MPDUs transferred
      *         to the container queue storing MPDUs with expired lifetime
      */
-    std::pair<iterator, iterator> DoExtractExpiredMpdus(ContainerQueue& queue) const;
+    std::pair<iterator, iterator> DoExtractExpiredMpdus(const WifiContainerQueueId& queueId,
+                                                        QueueInfo& info) const;
+
+    /**
+     * Add the expiry time of the MPDU included in the element pointed to by the given
+     * iterator to the expiry index of the given container queue.
+     *
+     * \param queueId the QueueId identifying the given container queue
+     * \param info the information about the given container queue
+     * \param it the given iterator
+     */
+    void AddExpiryTime(const WifiContainerQueueId& queueId, QueueInfo& info, iterator it) const;
+
+    /**
+     * Remove the expiry time of the MPDU included in the element pointed to by the given
+     * iterator from the expiry index of the given container queue.
+     *
+     * \param queueId the QueueId identifying the given container queue
+     * \param info the information about the given container queue
+     * \param it the given iterator
+     */
+    void RemoveExpiryTime(const WifiContainerQueueId& queueId,
+                          QueueInfo& info,
+                          const_iterator it) const;
 
-    mutable std::unordered_map<WifiContainerQueueId, ContainerQueue>
+    mutable std::unordered_map<WifiContainerQueueId, QueueInfo>
         m_queues;                          //!< the container queues
     mutable ContainerQueue m_expiredQueue; //!< queue storing MPDUs with expired lifetime
-    mutable std::unordered_map<WifiContainerQueueId, uint32_t>
-        m_nBytesPerQueue; //!< size in bytes of the container queues
+    mutable std::set<std::pair<Time, WifiContainerQueueId>>
+        m_nextExpiryTimes; //!< earliest expiry time of the MPDUs in each non-empty container queue
 };
 
 } // namespace ns3
@@ -15,6 +15,7 @@
 #include "ns3/nstime.h"
 
 #include <map>
+#include <set>
 
 namespace ns3
 {
@@ -38,13 +39,17 @@ class WifiMpdu;
  */
 struct WifiMacQueueElem
 {
-    Ptr<WifiMpdu> mpdu;                         ///< MPDU stored by this element
-    Time expiryTime{0};                         ///< expiry time of the MPDU (set by WifiMacQueue)
-    AcIndex ac{AC_UNDEF};                       ///< the Access Category associated with the queue
-                                                ///< storing this element (set by WifiMacQueue)
-    bool expired{false};                        ///< whether this MPDU has been marked as expired
-    std::map<uint8_t, Ptr<WifiMpdu>> inflights; ///< map of MPDUs in-flight on each link
-    Callback<void, Ptr<WifiMpdu>> deleter;      ///< reset the iterator stored by the MPDU
+    Ptr<WifiMpdu> mpdu;                           ///< MPDU stored by this element
+    Time expiryTime{0};                           ///< expiry time of the MPDU (set by WifiMacQueue
+                                                  ///< through WifiMacQueueContainer::SetExpiryTime)
+    AcIndex ac{AC_UNDEF};                         ///< the Access Category associated with the queue
+                                                  ///< storing this element (set by WifiMacQueue)
+    bool expired{false};                          ///< whether this MPDU has been marked as expired
+    std::map<uint8_t, Ptr<WifiMpdu>> inflights;   ///< map of MPDUs in-flight on each link
+    Callback<void, Ptr<WifiMpdu>> deleter;        ///< reset the iterator stored by the MPDU
+    std::multiset<Time>::const_iterator expiryIt; ///< position of the expiry time in the
+                                                  ///< expiry index of the container queue
+                                                  ///< (set by WifiMacQueueContainer)
 
     /**
      * Constructor.
@@ -37,6 +37,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <unordered_map>
 
 #undef NS_LOG_APPEND_CONTEXT
 #define NS_LOG_APPEND_CONTEXT                                                                      \
@@ -299,6 +300,15 @@ WifiPhy::GetTypeId()
                           BooleanValue(false),
                           MakeBooleanAccessor(&WifiPhy::m_notifyRxMacHeaderEnd),
                           MakeBooleanChecker())
+            .AddAttribute("Abstraction",
+                          "Whether the reception of SU PPDUs is abstracted: the PHY header is "
+                          "evaluated in a single event at the end of the PHY header and the "
+                          "MPDUs are evaluated in a single event at the end of the PPDU, "
+                          "instead of at the end of every PHY header field and of every MPDU. "
+                          "The MAC header RX end is not notified in this mode.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&WifiPhy::m_abstraction),
+                          MakeBooleanChecker())
             .AddTraceSource(
                 "PhyTxBegin",
                 "Trace source indicating a packet has begun transmitting over the medium; "
@@ -1527,6 +1537,60 @@ WifiPhy::GetStartOfPacketDuration(const WifiTxVector& txVector)
     return MicroSeconds(4);
 }
 
+WifiPhy::PpduDurations&
+WifiPhy::GetPpduDurations(const WifiTxVector& txVector, WifiPhyBand band)
+{
+    NS_ASSERT(!txVector.IsMu());
+    const auto guardInterval = txVector.GetGuardInterval().GetNanoSeconds();
+    const auto width = static_cast<uint64_t>(txVector.GetChannelWidth());
+    NS_ASSERT(txVector.GetMode().GetUid() < (1 << 16) && guardInterval >= 0 &&
+              guardInterval < (1 << 16) && width < (1 << 12));
+    // pack the fields of the TXVECTOR the duration of a SU PPDU depends on
+    const uint64_t key = static_cast<uint64_t>(txVector.GetMode().GetUid()) |
+                         (static_cast<uint64_t>(txVector.GetPreambleType()) << 16) |
+                         (static_cast<uint64_t>(guardInterval) << 24) |
+                         (static_cast<uint64_t>(txVector.GetNss()) << 40) |
+                         (static_cast<uint64_t>(txVector.GetNess()) << 44) |
+                         (static_cast<uint64_t>(txVector.IsStbc()) << 48) |
+                         (static_cast<uint64_t>(band) << 49) | (width << 52);
+
+    static std::unordered_map<uint64_t, PpduDurations> g_ppduDurations;
+    auto [it, inserted] = g_ppduDurations.try_emplace(key);
+    if (inserted)
+    {
+        it->second.preambleAndHeader = GetStaticPhyEntity(txVector.GetModulationClass())
+                                           ->CalculatePhyPreambleAndHeaderDuration(txVector);
+        // no PSDU can be as large as the size marking the unused pairs
+        it->second.payloads.fill({std::numeric_limits<uint32_t>::max(), Time()});
+    }
+    return it->second;
+}
+
+Time
+WifiPhy::GetMemoizedPayloadDuration(uint32_t size,
+                                    PpduDurations& durations,
+                                    const WifiTxVector& txVector,
+                                    WifiPhyBand band)
+{
+    auto& [memoizedSize, duration] = durations.payloads[size % durations.payloads.size()];
+    if (memoizedSize != size)
+    {
+        uint32_t totalAmpduSize;
+        double totalAmpduNumSymbols;
+        duration = GetStaticPhyEntity(txVector.GetModulationClass())
+                       ->GetPayloadDuration(size,
+                                            txVector,
+                                            band,
+                                            NORMAL_MPDU,
+                                            false,
+                                            totalAmpduSize,
+                                            totalAmpduNumSymbols,
+                                            SU_STA_ID);
+        memoizedSize = size;
+    }
+    return duration;
+}
+
 Time
 WifiPhy::GetPayloadDuration(uint32_t size,
                             const WifiTxVector& txVector,
@@ -1534,6 +1598,10 @@ WifiPhy::GetPayloadDuration(uint32_t size,
                             MpduType mpdutype,
                             uint16_t staId)
 {
+    if (mpdutype == NORMAL_MPDU && !txVector.IsMu())
+    {
+        return GetMemoizedPayloadDuration(size, GetPpduDurations(txVector, band), txVector, band);
+    }
     uint32_t totalAmpduSize;
     double totalAmpduNumSymbols;
     return GetPayloadDuration(size,
@@ -1570,6 +1638,10 @@ WifiPhy::GetPayloadDuration(uint32_t size,
 Time
 WifiPhy::CalculatePhyPreambleAndHeaderDuration(const WifiTxVector& txVector)
 {
+    if (!txVector.IsMu())
+    {
+        return GetPpduDurations(txVector, WIFI_PHY_BAND_UNSPECIFIED).preambleAndHeader;
+    }
     return GetStaticPhyEntity(txVector.GetModulationClass())
         ->CalculatePhyPreambleAndHeaderDuration(txVector);
 }
@@ -1580,8 +1652,18 @@ WifiPhy::CalculateTxDuration(uint32_t size,
                              WifiPhyBand band,
                              uint16_t staId)
 {
-    Time duration = CalculatePhyPreambleAndHeaderDuration(txVector) +
-                    GetPayloadDuration(size, txVector, band, NORMAL_MPDU, staId);
+    Time duration;
+    if (!txVector.IsMu())
+    {
+        auto& durations = GetPpduDurations(txVector, band);
+        duration = durations.preambleAndHeader +
+                   GetMemoizedPayloadDuration(size, durations, txVector, band);
+    }
+    else
+    {
+        duration = CalculatePhyPreambleAndHeaderDuration(txVector) +
+                   GetPayloadDuration(size, txVector, band, NORMAL_MPDU, staId);
+    }
     NS_ASSERT(duration.IsStrictlyPositive());
     return duration;
 }
@@ -2283,9 +2365,9 @@ WifiPhy::ResetCca(bool powerRestricted, dBm_u txPowerMaxSiso, dBm_u txPowerMaxMi
         Simulator::Schedule(m_currentEvent->GetEndTime() - Simulator::Now(),
                             &WifiPhy::EndReceiveInterBss,
                             this);
-        Simulator::ScheduleNow(&WifiPhy::AbortCurrentReception,
-                               this,
-                               OBSS_PD_CCA_RESET); // finish processing field first
+        // finish processing field first
+        m_ccaResetEvent =
+            Simulator::ScheduleNow(&WifiPhy::AbortCurrentReception, this, OBSS_PD_CCA_RESET);
     }
 }
 
@@ -17,6 +17,7 @@
 
 #include "ns3/error-model.h"
 
+#include <array>
 #include <limits>
 
 #define WIFI_PHY_NS_LOG_APPEND_CONTEXT(phy)                                                        \
@@ -1331,6 +1332,7 @@ class WifiPhy : public Object
 
     EventId m_endPhyRxEvent; //!< the end of PHY receive event
     EventId m_endTxEvent;    //!< the end of transmit event
+    EventId m_ccaResetEvent; //!< the abort of the reception upon a CCA reset
 
     Ptr<Event> m_currentEvent; //!< Hold the current event
     std::map<std::pair<uint64_t /* UID*/, WifiPreamble>, Ptr<Event>>
@@ -1580,6 +1582,39 @@ class WifiPhy : public Object
      */
     static std::map<WifiModulationClass, Ptr<PhyEntity>>& GetStaticPhyEntities();
 
+    /// Durations memoized for the SU PPDUs transmitted with a given TXVECTOR in a given band
+    struct PpduDurations
+    {
+        Time preambleAndHeader; //!< duration of the PHY preamble and header
+        /// (PSDU size, payload duration) pairs, indexed by PSDU size modulo the number of pairs
+        std::array<std::pair<uint32_t, Time>, 128> payloads;
+    };
+
+    /**
+     * Get the durations memoized for the SU PPDUs transmitted with the given TXVECTOR in the
+     * given band. The durations depend on a few fields of the TXVECTOR only (modulation, number
+     * of streams, channel width, etc.), which identify the memoized durations.
+     *
+     * \param txVector the TXVECTOR of a SU PPDU
+     * \param band the frequency band
+     *
+     * \return the memoized durations
+     */
+    static PpduDurations& GetPpduDurations(const WifiTxVector& txVector, WifiPhyBand band);
+
+    /**
+     * \param size the number of bytes in the PSDU
+     * \param durations the durations memoized for the TXVECTOR and the band
+     * \param txVector the TXVECTOR of the SU PPDU
+     * \param band the frequency band
+     *
+     * \return the duration of the PSDU, computed on the first use of its size only
+     */
+    static Time GetMemoizedPayloadDuration(uint32_t size,
+                                           PpduDurations& durations,
+                                           const WifiTxVector& txVector,
+                                           WifiPhyBand band);
+
     WifiStandard m_standard;                    //!< WifiStandard
     WifiModulationClass m_maxModClassSupported; //!< max modulation class supported
     WifiPhyBand m_band;                         //!< WifiPhyBand
@@ -1629,6 +1664,7 @@ class WifiPhy : public Object
     Ptr<ErrorModel> m_postReceptionErrorModel;            //!< Error model for receive packet events
     Time m_timeLastPreambleDetected; //!< Record the time the last preamble was detected
     bool m_notifyRxMacHeaderEnd;     //!< whether the PHY is capable of notifying MAC header RX end
+    bool m_abstraction;              //!< whether the reception of SU PPDUs is abstracted
 
     Callback<void> m_capabilitiesChangedCallback; //!< Callback when PHY capabilities changed
 };
@@ -14,6 +14,8 @@
 #include "wifi-utils.h"
 #include "yans-wifi-phy.h"
 
+#include "ns3/boolean.h"
+#include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
 #include "ns3/node.h"
@@ -46,11 +48,38 @@ YansWifiChannel::GetTypeId()
                           "A pointer to the propagation delay model attached to this channel.",
                           PointerValue(),
                           MakePointerAccessor(&YansWifiChannel::m_delay),
-                          MakePointerChecker<PropagationDelayModel>());
+                          MakePointerChecker<PropagationDelayModel>())
+            .AddAttribute("MaxRange",
+                          "The maximum distance in meters between the sender of a PPDU and "
+                          "the PHYs the PPDU is delivered to, or 0 for no limit. The PHYs "
+                          "in range are found through a spatial index of their positions, "
+                          "instead of visiting all the PHYs attached to this channel.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&YansWifiChannel::SetMaxRange,
+                                             &YansWifiChannel::GetMaxRange),
+                          MakeDoubleChecker<double>(0))
+            .AddAttribute("LossCache",
+                          "Whether to compute the reception power of each pair of PHYs once "
+                          "and reuse it until either PHY moves. This suits static topologies "
+                          "with deterministic propagation loss models, as the losses drawn "
+                          "for each PPDU (e.g., Nakagami fading) are reused too.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&YansWifiChannel::m_lossCacheEnabled),
+                          MakeBooleanChecker())
+            .AddAttribute("LossCacheTolerance",
+                          "The distance in meters a PHY can move by before the cached "
+                          "reception powers of its paths are computed again.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&YansWifiChannel::SetLossCacheTolerance,
+                                             &YansWifiChannel::GetLossCacheTolerance),
+                          MakeDoubleChecker<double>(0));
     return tid;
 }
 
 YansWifiChannel::YansWifiChannel()
+    : m_maxRange(0),
+      m_nIndexed(0),
+      m_lossCacheEnabled(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -61,11 +90,22 @@ YansWifiChannel::~YansWifiChannel()
     m_phyList.clear();
 }
 
+void
+YansWifiChannel::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_grid.Clear();
+    m_nIndexed = 0;
+    m_lossCache.Clear();
+    Channel::DoDispose();
+}
+
 void
 YansWifiChannel::SetPropagationLossModel(const Ptr<PropagationLossModel> loss)
 {
     NS_LOG_FUNCTION(this << loss);
     m_loss = loss;
+    m_lossCache.Clear();
 }
 
 void
@@ -81,44 +121,81 @@ YansWifiChannel::Send(Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, dBm_u t
     NS_LOG_FUNCTION(this << sender << ppdu << txPower);
     Ptr<MobilityModel> senderMobility = sender->GetMobility();
     NS_ASSERT(senderMobility);
-    for (auto i = m_phyList.begin(); i != m_phyList.end(); i++)
+
+    if (m_maxRange == 0)
     {
-        if (sender != (*i))
+        for (const auto& receiver : m_phyList)
         {
-            // For now don't account for inter channel interference nor channel bonding
-            if ((*i)->GetChannelNumber() != sender->GetChannelNumber())
-            {
-                continue;
-            }
-
-            auto receiverMobility = (*i)->GetMobility()->GetObject<MobilityModel>();
-            const auto delay = m_delay->GetDelay(senderMobility, receiverMobility);
-            const auto rxPower = m_loss->CalcRxPower(txPower, senderMobility, receiverMobility);
-            NS_LOG_DEBUG("propagation: txPower="
-                         << txPower << "dBm, rxPower=" << rxPower << "dBm, "
-                         << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
-                         << "m, delay=" << delay);
-            auto dstNetDevice = (*i)->GetDevice();
-            uint32_t dstNode;
-            if (!dstNetDevice)
-            {
-                dstNode = 0xffffffff;
-            }
-            else
-            {
-                dstNode = dstNetDevice->GetNode()->GetId();
-            }
-
-            Simulator::ScheduleWithContext(dstNode,
-                                           delay,
-                                           &YansWifiChannel::Receive,
-                                           (*i),
-                                           ppdu,
-                                           rxPower);
+            SendTo(sender, receiver, ppdu, txPower);
         }
+        return;
+    }
+
+    for (; m_nIndexed < m_phyList.size(); m_nIndexed++)
+    {
+        auto mobility = m_phyList[m_nIndexed]->GetMobility();
+        NS_ASSERT_MSG(mobility, "A PHY attached to the channel has no mobility model");
+        m_grid.Add(mobility, m_nIndexed);
+    }
+    // the PHYs in range are visited in the order they were added, as above
+    m_grid.GetInRange(senderMobility->GetPosition(), m_maxRange, m_inRange);
+    for (auto index : m_inRange)
+    {
+        SendTo(sender, m_phyList[index], ppdu, txPower);
     }
 }
 
+void
+YansWifiChannel::SendTo(Ptr<YansWifiPhy> sender,
+                        Ptr<YansWifiPhy> receiver,
+                        Ptr<const WifiPpdu> ppdu,
+                        dBm_u txPower) const
+{
+    if (sender == receiver)
+    {
+        return;
+    }
+
+    // For now don't account for inter channel interference nor channel bonding
+    if (receiver->GetChannelNumber() != sender->GetChannelNumber())
+    {
+        return;
+    }
+
+    auto senderMobility = sender->GetMobility();
+    auto receiverMobility = receiver->GetMobility()->GetObject<MobilityModel>();
+    const auto delay = m_delay->GetDelay(senderMobility, receiverMobility);
+    const auto rxPower =
+        m_lossCacheEnabled
+            ? m_lossCache.CalcRxPower(m_loss,
+                                      txPower,
+                                      senderMobility,
+                                      receiverMobility,
+                                      static_cast<uint64_t>(sender->GetFrequency()))
+            : m_loss->CalcRxPower(txPower, senderMobility, receiverMobility);
+    NS_LOG_DEBUG("propagation: txPower="
+                 << txPower << "dBm, rxPower=" << rxPower << "dBm, "
+                 << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
+                 << "m, delay=" << delay);
+    auto dstNetDevice = receiver->GetDevice();
+    uint32_t dstNode;
+    if (!dstNetDevice)
+    {
+        dstNode = 0xffffffff;
+    }
+    else
+    {
+        dstNode = dstNetDevice->GetNode()->GetId();
+    }
+
+    Simulator::ScheduleWithContext(dstNode,
+                                   delay,
+                                   &YansWifiChannel::Receive,
+                                   receiver,
+                                   ppdu,
+                                   rxPower);
+}
+
 void
 YansWifiChannel::Receive(Ptr<YansWifiPhy> phy, Ptr<const WifiPpdu> ppdu, dBm_u rxPower)
 {
@@ -158,12 +235,44 @@ YansWifiChannel::Add(Ptr<YansWifiPhy> phy)
     m_phyList.push_back(phy);
 }
 
+void
+YansWifiChannel::SetMaxRange(double range)
+{
+    NS_LOG_FUNCTION(this << range);
+    m_maxRange = range;
+    if (m_maxRange > 0)
+    {
+        m_grid.SetCellSize(m_maxRange);
+    }
+}
+
+double
+YansWifiChannel::GetMaxRange() const
+{
+    return m_maxRange;
+}
+
+void
+YansWifiChannel::SetLossCacheTolerance(double tolerance)
+{
+    NS_LOG_FUNCTION(this << tolerance);
+    m_lossCache.SetTolerance(tolerance);
+}
+
+double
+YansWifiChannel::GetLossCacheTolerance() const
+{
+    return m_lossCache.GetTolerance();
+}
+
 int64_t
 YansWifiChannel::AssignStreams(int64_t stream)
 {
     NS_LOG_FUNCTION(this << stream);
     int64_t currentStream = stream;
     currentStream += m_loss->AssignStreams(stream);
+    // the cached losses may have been drawn from the previous streams
+    m_lossCache.Clear();
     return (currentStream - stream);
 }
 
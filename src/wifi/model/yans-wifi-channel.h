@@ -12,6 +12,8 @@
 #include "wifi-units.h"
 
 #include "ns3/channel.h"
+#include "ns3/propagation-loss-cache.h"
+#include "ns3/spatial-grid.h"
 
 namespace ns3
 {
@@ -32,6 +34,17 @@ class WifiPpdu;
  * class and supports an ns3::PropagationLossModel and an
  * ns3::PropagationDelayModel.  By default, no propagation models are set;
  * it is the caller's responsibility to set them before using the channel.
+ *
+ * If the MaxRange attribute is set, a PPDU is only delivered to the PHYs
+ * within that distance of the sender, which are found through a SpatialGrid
+ * of the positions of the PHYs, so that the cost of a transmission depends
+ * on the number of PHYs in range rather than on the number of PHYs on the
+ * channel.
+ *
+ * If the LossCache attribute is set, the reception power of each pair of
+ * PHYs is computed once and reused until either PHY moves, through a
+ * PropagationLossCache, which suits static topologies with deterministic
+ * propagation loss models.
  */
 class YansWifiChannel : public Channel
 {
@@ -72,7 +85,8 @@ class YansWifiChannel : public Channel
      * This method should not be invoked by normal users. It is
      * currently invoked only from YansWifiPhy::StartTx.  The channel
      * attempts to deliver the PPDU to all other YansWifiPhy objects
-     * on the channel (except for the sender).
+     * on the channel (except for the sender), or only to those within
+     * MaxRange of the sender if that attribute is set.
      */
     void Send(Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, dBm_u txPower) const;
 
@@ -87,6 +101,31 @@ class YansWifiChannel : public Channel
      */
     int64_t AssignStreams(int64_t stream);
 
+    /**
+     * \param range the maximum distance in meters between the sender of a PPDU
+     *        and the PHYs the PPDU is delivered to, or 0 for no limit
+     */
+    void SetMaxRange(double range);
+    /**
+     * \return the maximum distance in meters between the sender of a PPDU and
+     *         the PHYs the PPDU is delivered to, or 0 for no limit
+     */
+    double GetMaxRange() const;
+
+    /**
+     * \param tolerance the distance in meters a PHY can move by before the
+     *        cached reception powers of its paths are computed again
+     */
+    void SetLossCacheTolerance(double tolerance);
+    /**
+     * \return the distance in meters a PHY can move by before the cached
+     *         reception powers of its paths are computed again
+     */
+    double GetLossCacheTolerance() const;
+
+  protected:
+    void DoDispose() override;
+
   private:
     /**
      * A vector of pointers to YansWifiPhy.
@@ -104,9 +143,31 @@ class YansWifiChannel : public Channel
      */
     static void Receive(Ptr<YansWifiPhy> receiver, Ptr<const WifiPpdu> ppdu, dBm_u txPower);
 
+    /**
+     * Schedule the reception of a PPDU by the given PHY, if the PHY is not the
+     * sender and is tuned to the channel of the sender.
+     *
+     * \param sender the PHY object from which the packet is originating
+     * \param receiver the PHY the PPDU is delivered to
+     * \param ppdu the PPDU to send
+     * \param txPower the TX power associated to the packet
+     */
+    void SendTo(Ptr<YansWifiPhy> sender,
+                Ptr<YansWifiPhy> receiver,
+                Ptr<const WifiPpdu> ppdu,
+                dBm_u txPower) const;
+
     PhyList m_phyList;                  //!< List of YansWifiPhys connected to this YansWifiChannel
     Ptr<PropagationLossModel> m_loss;   //!< Propagation loss model
     Ptr<PropagationDelayModel> m_delay; //!< Propagation delay model
+    double m_maxRange;                  //!< Maximum distance to the receivers, 0 for no limit
+    // the PHYs are indexed lazily, as their mobility model is usually
+    // aggregated to their node after they are added to the channel
+    mutable SpatialGrid m_grid;               //!< Positions of the PHYs, by index in m_phyList
+    mutable std::size_t m_nIndexed;           //!< Number of PHYs in m_phyList added to m_grid
+    mutable std::vector<uint32_t> m_inRange;  //!< Indices of the PHYs in range of the sender
+    bool m_lossCacheEnabled;                  //!< Whether the reception powers are cached
+    mutable PropagationLossCache m_lossCache; //!< Reception powers of the pairs of PHYs
 };
 
 } // namespace ns3
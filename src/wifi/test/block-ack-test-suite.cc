@@ -664,6 +664,87 @@ OriginatorBlockAckWindowTest::DoRun()
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the access to a block ack window a word at a time
+ *
+ * A window whose size is not a multiple of 64 is repeatedly advanced (so that its
+ * head wraps around the end of the bitmap) and its elements are set according to a
+ * pattern. The words returned by the window, as well as the number of leading
+ * elements that are set, are checked against the values of the single elements.
+ */
+class BlockAckWindowWordTest : public TestCase
+{
+  public:
+    BlockAckWindowWordTest();
+
+  private:
+    void DoRun() override;
+};
+
+BlockAckWindowWordTest::BlockAckWindowWordTest()
+    : TestCase("Check the access to a block ack window a word at a time")
+{
+}
+
+void
+BlockAckWindowWordTest::DoRun()
+{
+    const std::size_t winSize = 100;
+    uint16_t winStart = 4090;
+
+    BlockAckWindow window;
+    window.Init(winStart, winSize);
+
+    for (std::size_t step : {0, 1, 13, 64, 70, 99, 3, 100, 150})
+    {
+        window.Advance(step);
+        winStart = (winStart + step) % SEQNO_SPACE_SIZE;
+        NS_TEST_EXPECT_MSG_EQ(window.GetWinStart(), winStart, "Incorrect winStart");
+
+        // the elements that entered the window must be cleared
+        for (std::size_t i = winSize - std::min(step, winSize); i < winSize; i++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(window.At(i), false, "Element " << i << " not cleared");
+        }
+
+        // set a run of leading elements and then every third element (the elements
+        // set before advancing the window are kept)
+        const auto nLeading = (step * 7) % winSize;
+        for (std::size_t i = 0; i < winSize; i++)
+        {
+            if (i < nLeading || (i > nLeading && i % 3 == 0))
+            {
+                window.Set(i);
+            }
+        }
+        std::size_t expectedLeading = 0;
+        while (expectedLeading < winSize && window.At(expectedLeading))
+        {
+            expectedLeading++;
+        }
+        NS_TEST_EXPECT_MSG_EQ(window.GetNLeadingSet(),
+                              expectedLeading,
+                              "Incorrect number of leading elements set after step " << step);
+
+        for (std::size_t distance : {std::size_t{0}, std::size_t{5}, std::size_t{63}, winSize - 1})
+        {
+            const auto word = window.GetWord(distance);
+            for (std::size_t i = 0; i < 64; i++)
+            {
+                const bool bit = (word >> i) & 1;
+                const bool expected = (distance + i < winSize) && window.At(distance + i);
+                NS_TEST_EXPECT_MSG_EQ(bit,
+                                      expected,
+                                      "Incorrect bit " << i << " of the word at distance "
+                                                       << distance << " after step " << step);
+            }
+        }
+    }
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -2258,6 +2339,7 @@ BlockAckTestSuite::BlockAckTestSuite()
     AddTestCase(new PacketBufferingCaseA, TestCase::Duration::QUICK);
     AddTestCase(new PacketBufferingCaseB, TestCase::Duration::QUICK);
     AddTestCase(new OriginatorBlockAckWindowTest, TestCase::Duration::QUICK);
+    AddTestCase(new BlockAckWindowWordTest, TestCase::Duration::QUICK);
     AddTestCase(new CtrlBAckResponseHeaderTest, TestCase::Duration::QUICK);
     AddTestCase(new BlockAckRecipientBufferTest(0), TestCase::Duration::QUICK);
     AddTestCase(new BlockAckRecipientBufferTest(4090), TestCase::Duration::QUICK);
@@ -10,6 +10,7 @@
 #include "ns3/constant-position-mobility-model.h"
 #include "ns3/fcfs-wifi-queue-scheduler.h"
 #include "ns3/frame-exchange-manager.h"
+#include "ns3/ht-configuration.h"
 #include "ns3/interference-helper.h"
 #include "ns3/node.h"
 #include "ns3/pointer.h"
@@ -44,11 +45,14 @@ class PowerRateAdaptationTest : public TestCase
     void TestAparf();
     /// Test rrpaa function
     void TestRrpaa();
+    /// Test thompson sampling function, when the guard interval of the remote station changes
+    void TestThompsonSamplingGuardInterval();
     /**
      * Configure nde function
+     * \param standard the standard of the PHY layer
      * \returns the node
      */
-    Ptr<Node> ConfigureNode();
+    Ptr<Node> ConfigureNode(WifiStandard standard = WIFI_STANDARD_80211a);
 
     ObjectFactory m_manager; ///< manager
 };
@@ -59,7 +63,7 @@ PowerRateAdaptationTest::PowerRateAdaptationTest()
 }
 
 Ptr<Node>
-PowerRateAdaptationTest::ConfigureNode()
+PowerRateAdaptationTest::ConfigureNode(WifiStandard standard)
 {
     /*
      * Create and configure node.
@@ -88,7 +92,12 @@ PowerRateAdaptationTest::ConfigureNode()
     phy->SetChannel(channel);
     phy->SetDevice(dev);
     phy->SetMobility(mobility);
-    phy->ConfigureStandard(WIFI_STANDARD_80211a);
+    phy->ConfigureStandard(standard);
+    dev->SetStandard(standard);
+    if (standard >= WIFI_STANDARD_80211n)
+    {
+        dev->SetHtConfiguration(CreateObject<HtConfiguration>());
+    }
 
     /*
      * Configure power control parameters.
@@ -1142,12 +1151,75 @@ PowerRateAdaptationTest::TestRrpaa()
     Simulator::Destroy();
 }
 
+void
+PowerRateAdaptationTest::TestThompsonSamplingGuardInterval()
+{
+    m_manager.SetTypeId("ns3::ThompsonSamplingWifiManager");
+    Ptr<Node> node = ConfigureNode(WIFI_STANDARD_80211n);
+    Ptr<WifiNetDevice> dev = DynamicCast<WifiNetDevice>(node->GetDevice(0));
+    Ptr<WifiRemoteStationManager> manager = dev->GetRemoteStationManager();
+    dev->GetHtConfiguration()->SetShortGuardIntervalSupported(true);
+
+    uint64_t rate = 0;
+    manager->TraceConnectWithoutContext(
+        "Rate",
+        Callback<void, uint64_t, uint64_t>([&rate](uint64_t, uint64_t newRate) {
+            rate = newRate;
+        }));
+
+    /*
+     * The remote station does not support the short guard interval when associating.
+     */
+    Mac48Address remoteAddress = Mac48Address::Allocate();
+    HtCapabilities htCapabilities;
+    htCapabilities.SetShortGuardInterval20(0);
+    for (uint8_t mcs = 0; mcs < 8; ++mcs)
+    {
+        htCapabilities.SetRxMcsBitmask(mcs);
+    }
+    manager->AddStationHtCapabilities(remoteAddress, htCapabilities);
+
+    WifiMacHeader packetHeader;
+    packetHeader.SetAddr1(remoteAddress);
+    packetHeader.SetType(WIFI_MAC_QOSDATA);
+    packetHeader.SetQosTid(0);
+    Ptr<WifiMpdu> mpdu = Create<WifiMpdu>(Create<Packet>(10), packetHeader);
+    WifiMode ackMode;
+
+    /*
+     * The rate of the selected mode, reported by the Rate trace, is computed from the data
+     * rates cached for the station, which must follow the guard interval of the station.
+     */
+    for (uint8_t sgi : {0, 1, 0})
+    {
+        htCapabilities.SetShortGuardInterval20(sgi);
+        manager->AddStationHtCapabilities(remoteAddress, htCapabilities);
+
+        for (int i = 0; i < 5; i++)
+        {
+            WifiTxVector txVector =
+                manager->GetDataTxVector(packetHeader, dev->GetPhy()->GetChannelWidth());
+            NS_TEST_ASSERT_MSG_EQ(txVector.GetGuardInterval(),
+                                  NanoSeconds(sgi ? 400 : 800),
+                                  "Thompson sampling: Incorrect guard interval");
+            NS_TEST_ASSERT_MSG_EQ(rate,
+                                  txVector.GetMode().GetDataRate(txVector),
+                                  "Thompson sampling: Data rate not computed for the guard "
+                                  "interval of the station");
+            manager->ReportDataOk(mpdu, 0, ackMode, 0, txVector);
+        }
+    }
+
+    Simulator::Destroy();
+}
+
 void
 PowerRateAdaptationTest::DoRun()
 {
     TestParf();
     TestAparf();
     TestRrpaa();
+    TestThompsonSamplingGuardInterval();
 }
 
 /**
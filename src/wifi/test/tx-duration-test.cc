@@ -1925,6 +1925,125 @@ PhyHeaderSectionsTest::DoRun()
     CheckPhyHeaderSections(phyEntity->GetPhyHeaderSections(txVector, ppduStart), sections);
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Memoized TX duration test
+ *
+ * The durations of the SU PPDUs are memoized per TXVECTOR, band and PSDU size.
+ * This test checks that the memoized durations match the durations computed
+ * from scratch, for TXVECTORs differing in a single field and for PSDU sizes
+ * evicting each other from the memoized durations.
+ */
+class MemoizedTxDurationTest : public TestCase
+{
+  public:
+    MemoizedTxDurationTest();
+
+  private:
+    void DoRun() override;
+};
+
+MemoizedTxDurationTest::MemoizedTxDurationTest()
+    : TestCase("Check the memoized TX durations")
+{
+}
+
+void
+MemoizedTxDurationTest::DoRun()
+{
+    std::list<std::pair<WifiTxVector, WifiPhyBand>> txVectors;
+    WifiTxVector txVector(HtPhy::GetHtMcs3(),
+                          0,
+                          WIFI_PREAMBLE_HT_MF,
+                          NanoSeconds(800),
+                          2,
+                          1,
+                          0,
+                          20,
+                          false);
+    txVectors.emplace_back(txVector, WIFI_PHY_BAND_5GHZ);
+    txVectors.emplace_back(txVector, WIFI_PHY_BAND_2_4GHZ);
+    txVector.SetGuardInterval(NanoSeconds(400));
+    txVectors.emplace_back(txVector, WIFI_PHY_BAND_5GHZ);
+    txVector.SetStbc(true);
+    txVectors.emplace_back(txVector, WIFI_PHY_BAND_5GHZ);
+    txVector.SetNess(1);
+    txVectors.emplace_back(txVector, WIFI_PHY_BAND_5GHZ);
+    txVector.SetChannelWidth(40);
+    txVectors.emplace_back(txVector, WIFI_PHY_BAND_5GHZ);
+    txVector.SetMode(HtPhy::GetHtMcs11());
+    txVector.SetNss(2);
+    txVectors.emplace_back(txVector, WIFI_PHY_BAND_5GHZ);
+    txVectors.emplace_back(WifiTxVector(HePhy::GetHeMcs0(),
+                                        0,
+                                        WIFI_PREAMBLE_HE_SU,
+                                        NanoSeconds(3200),
+                                        1,
+                                        1,
+                                        0,
+                                        20,
+                                        false),
+                           WIFI_PHY_BAND_6GHZ);
+    txVectors.emplace_back(WifiTxVector(HePhy::GetHeMcs0(),
+                                        0,
+                                        WIFI_PREAMBLE_HE_ER_SU,
+                                        NanoSeconds(3200),
+                                        1,
+                                        1,
+                                        0,
+                                        20,
+                                        false),
+                           WIFI_PHY_BAND_6GHZ);
+    txVectors.emplace_back(WifiTxVector(DsssPhy::GetDsssRate11Mbps(),
+                                        0,
+                                        WIFI_PREAMBLE_SHORT,
+                                        NanoSeconds(800),
+                                        1,
+                                        1,
+                                        0,
+                                        22,
+                                        false),
+                           WIFI_PHY_BAND_2_4GHZ);
+
+    // sizes sharing their place in the memoized durations, in interleaved order
+    std::list<uint32_t> sizes;
+    for (uint32_t size : {0, 1, 127, 1500})
+    {
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            sizes.push_back(size + (i % 2) * 128 * 3);
+        }
+    }
+
+    for (const auto& [txVector, band] : txVectors)
+    {
+        for (auto size : sizes)
+        {
+            uint32_t totalAmpduSize;
+            double totalAmpduNumSymbols;
+            auto expected = WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector) +
+                            WifiPhy::GetPayloadDuration(size,
+                                                        txVector,
+                                                        band,
+                                                        NORMAL_MPDU,
+                                                        false,
+                                                        totalAmpduSize,
+                                                        totalAmpduNumSymbols,
+                                                        SU_STA_ID);
+            NS_TEST_EXPECT_MSG_EQ(WifiPhy::CalculateTxDuration(size, txVector, band),
+                                  expected,
+                                  "Wrong TX duration for size " << size << " and " << txVector);
+            NS_TEST_EXPECT_MSG_EQ(WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector) +
+                                      WifiPhy::GetPayloadDuration(size, txVector, band),
+                                  expected,
+                                  "Wrong payload duration for size " << size << " and "
+                                                                     << txVector);
+        }
+    }
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1942,6 +2061,8 @@ TxDurationTestSuite::TxDurationTestSuite()
 {
     AddTestCase(new TxDurationTest, TestCase::Duration::QUICK);
 
+    AddTestCase(new MemoizedTxDurationTest, TestCase::Duration::QUICK);
+
     AddTestCase(new PhyHeaderSectionsTest, TestCase::Duration::QUICK);
 
     // 20 MHz band, HeSigBDurationTest::OFDMA, even number of users per HE-SIG-B content channel
@@ -14,11 +14,13 @@
 #include <gsl/gsl_sf_bessel.h>
 #endif
 
+#include "ns3/double.h"
 #include "ns3/dsss-error-rate-model.h"
 #include "ns3/he-phy.h" //includes HT and VHT
 #include "ns3/interference-helper.h"
 #include "ns3/log.h"
 #include "ns3/nist-error-rate-model.h"
+#include "ns3/object-factory.h"
 #include "ns3/table-based-error-rate-model.h"
 #include "ns3/test.h"
 #include "ns3/wifi-phy.h"
@@ -1025,6 +1027,164 @@ TableBasedErrorRateTestCase::DoRun()
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Wifi Error Rate Models SNR Grid Test Case
+ *
+ * Check that the success rate of a set of chunks is the product of the
+ * success rates of the chunks, and that the success rate interpolated from a
+ * grid of SNR values (SnrGridStep attribute) is close to it.
+ */
+class WifiErrorRateModelsTestCaseSnrGrid : public TestCase
+{
+  public:
+    WifiErrorRateModelsTestCaseSnrGrid();
+
+  private:
+    void DoRun() override;
+};
+
+WifiErrorRateModelsTestCaseSnrGrid::WifiErrorRateModelsTestCaseSnrGrid()
+    : TestCase("WifiErrorRateModel success rates interpolated from a grid of SNR values")
+{
+}
+
+void
+WifiErrorRateModelsTestCaseSnrGrid::DoRun()
+{
+    const std::vector<std::pair<std::string, double>> models{{"ns3::YansErrorRateModel", 5e-4},
+                                                             {"ns3::NistErrorRateModel", 5e-4},
+                                                             {"ns3::TableBasedErrorRateModel",
+                                                              5e-3}};
+    for (const auto& [model, tolerance] : models)
+    {
+        ObjectFactory factory(model);
+        auto exact = factory.Create<ErrorRateModel>();
+        factory.Set("SnrGridStep", DoubleValue(0.1));
+        auto grid = factory.Create<ErrorRateModel>();
+        for (const auto& mode : {OfdmPhy::GetOfdmRate6Mbps(),
+                                 HtPhy::GetHtMcs0(),
+                                 HtPhy::GetHtMcs7(),
+                                 VhtPhy::GetVhtMcs8(),
+                                 HePhy::GetHeMcs5()})
+        {
+            WifiTxVector txVector;
+            txVector.SetMode(mode);
+            for (dB_u snr = -5; snr <= dB_u{35}; snr += dB_u{0.5})
+            {
+                // chunks at SNRs off the points of the grid
+                const std::vector<std::pair<double, uint64_t>> chunks{
+                    {DbToRatio(snr + dB_u{0.03}), 4000},
+                    {DbToRatio(snr + dB_u{0.27}), 8000},
+                    {DbToRatio(snr + dB_u{0.51}), 12000}};
+                double psr = 1.0;
+                for (const auto& [chunkSnr, nbits] : chunks)
+                {
+                    psr *= exact->GetChunkSuccessRate(mode, txVector, chunkSnr, nbits);
+                }
+                NS_TEST_EXPECT_MSG_EQ(exact->GetChunksSuccessRate(mode, txVector, chunks),
+                                      psr,
+                                      model << ": wrong success rate for " << mode << " at "
+                                            << snr << " dB");
+                NS_TEST_EXPECT_MSG_EQ_TOL(grid->GetChunksSuccessRate(mode, txVector, chunks),
+                                          psr,
+                                          tolerance,
+                                          model << ": wrong interpolated success rate for "
+                                                << mode << " at " << snr << " dB");
+            }
+        }
+    }
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Wifi Error Rate Models Payload SNR Grid Test Case
+ *
+ * Check that the error rate of a payload chunk computed by the
+ * InterferenceHelper with an error rate model interpolating the success rates
+ * from a grid of SNR values (SnrGridStep attribute) is close to the exact one,
+ * for SISO and MIMO, and that the chunks of zero bits do not change the
+ * interpolated success rate.
+ */
+class WifiErrorRateModelsTestCasePayloadSnrGrid : public TestCase
+{
+  public:
+    WifiErrorRateModelsTestCasePayloadSnrGrid();
+
+  private:
+    void DoRun() override;
+};
+
+WifiErrorRateModelsTestCasePayloadSnrGrid::WifiErrorRateModelsTestCasePayloadSnrGrid()
+    : TestCase("WifiErrorRateModel payload error rates interpolated from a grid of SNR values")
+{
+}
+
+void
+WifiErrorRateModelsTestCasePayloadSnrGrid::DoRun()
+{
+    TestInterferenceHelper exact;
+    exact.SetNumberOfReceiveAntennas(2);
+    exact.SetErrorRateModel(CreateObject<NistErrorRateModel>());
+    TestInterferenceHelper interpolated;
+    interpolated.SetNumberOfReceiveAntennas(2);
+    auto gridModel = CreateObject<NistErrorRateModel>();
+    gridModel->SetAttribute("SnrGridStep", DoubleValue(0.1));
+    interpolated.SetErrorRateModel(gridModel);
+
+    for (const auto& mode :
+         {HtPhy::GetHtMcs0(), HtPhy::GetHtMcs7(), VhtPhy::GetVhtMcs8(), HePhy::GetHeMcs5()})
+    {
+        for (uint8_t nss : {1, 2})
+        {
+            WifiTxVector txVector;
+            txVector.SetMode(mode);
+            txVector.SetChannelWidth(20);
+            txVector.SetNss(nss);
+            txVector.SetNTx(nss);
+            for (const auto& duration : {MicroSeconds(40), MicroSeconds(400)})
+            {
+                for (dB_u snr = 0; snr <= dB_u{35}; snr += dB_u{0.5})
+                {
+                    // SNR off the points of the grid
+                    const auto snir = DbToRatio(snr + dB_u{0.13});
+                    const auto per =
+                        1 - exact.CalculatePayloadChunkSuccessRate(snir, duration, txVector);
+                    NS_TEST_EXPECT_MSG_EQ_TOL(
+                        1 - interpolated.CalculatePayloadChunkSuccessRate(snir, duration, txVector),
+                        per,
+                        5e-4,
+                        "Wrong interpolated PER for " << mode << " with " << +nss
+                                                      << " spatial streams, a duration of "
+                                                      << duration.As(Time::US) << " at " << snr
+                                                      << " dB");
+                }
+            }
+
+            // a chunk of zero bits at the lowest SNRs of the grid, where the success rate per
+            // bit may be zero
+            for (dB_u snr = -20; snr <= dB_u{-10}; snr += dB_u{1})
+            {
+                const std::vector<std::pair<double, uint64_t>> chunk{{DbToRatio(dB_u{10}), 1000}};
+                auto chunks = chunk;
+                chunks.emplace_back(DbToRatio(snr + dB_u{0.05}), 0);
+                const auto psr = gridModel->GetChunksSuccessRate(mode, txVector, chunks);
+                NS_TEST_EXPECT_MSG_EQ(std::isnan(psr),
+                                      false,
+                                      "Success rate of " << mode << " is NaN at " << snr << " dB");
+                NS_TEST_EXPECT_MSG_EQ(psr,
+                                      gridModel->GetChunksSuccessRate(mode, txVector, chunk),
+                                      "A chunk of zero bits changed the success rate of "
+                                          << mode << " at " << snr << " dB");
+            }
+        }
+    }
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1043,6 +1203,8 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite()
     AddTestCase(new WifiErrorRateModelsTestCaseDsss, TestCase::Duration::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseNist, TestCase::Duration::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseMimo, TestCase::Duration::QUICK);
+    AddTestCase(new WifiErrorRateModelsTestCaseSnrGrid, TestCase::Duration::QUICK);
+    AddTestCase(new WifiErrorRateModelsTestCasePayloadSnrGrid, TestCase::Duration::QUICK);
     AddTestCase(new TableBasedErrorRateTestCase("DefaultTableBasedHtMcs0-1458bytes",
                                                 HtPhy::GetHtMcs0(),
                                                 1458),
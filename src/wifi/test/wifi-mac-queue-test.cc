@@ -160,7 +160,7 @@ WifiExtractExpiredMpdusTest::Enqueue(Mac48Address rxAddr, bool inflight, Time ex
 
     auto queueId = WifiMacQueueContainer::GetQueueId(mpdu);
     auto elemIt = m_container.insert(m_container.GetQueue(queueId).cend(), mpdu);
-    elemIt->expiryTime = expiryTime;
+    m_container.SetExpiryTime(elemIt, expiryTime);
     if (inflight)
     {
         elemIt->inflights.emplace(0, mpdu);
@@ -217,6 +217,16 @@ WifiExtractExpiredMpdusTest::DoRun()
     WifiContainerQueueId queueId1{WIFI_QOSDATA_QUEUE, WIFI_UNICAST, rxAddr1, 0};
     WifiContainerQueueId queueId2{WIFI_QOSDATA_QUEUE, WIFI_UNICAST, rxAddr2, 0};
 
+    Simulator::Schedule(MilliSeconds(5), [&]() {
+        /**
+         * No MPDU has expired lifetime yet
+         */
+        auto [first1, last1] = m_container.ExtractExpiredMpdus(queueId1);
+        NS_TEST_EXPECT_MSG_EQ((first1 == last1), true, "Did not expect expired MPDUs in queue 1");
+        auto [first, last] = m_container.ExtractAllExpiredMpdus();
+        NS_TEST_EXPECT_MSG_EQ((first == last), true, "Did not expect expired MPDUs");
+    });
+
     Simulator::Schedule(MilliSeconds(25), [&]() {
         /**
          * Extract expired MPDUs from container queue 1
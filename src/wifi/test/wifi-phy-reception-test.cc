@@ -11,6 +11,7 @@
 #include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/double.h"
+#include "ns3/he-configuration.h"
 #include "ns3/he-phy.h"
 #include "ns3/he-ppdu.h"
 #include "ns3/interference-helper.h"
@@ -31,6 +32,7 @@
 #include "ns3/spectrum-wifi-phy.h"
 #include "ns3/test.h"
 #include "ns3/threshold-preamble-detection-model.h"
+#include "ns3/uinteger.h"
 #include "ns3/wifi-bandwidth-filter.h"
 #include "ns3/wifi-mac-header.h"
 #include "ns3/wifi-mpdu.h"
@@ -2421,7 +2423,12 @@ TestPhyHeadersReception::DoRun()
 class TestAmpduReception : public WifiPhyReceptionTest
 {
   public:
-    TestAmpduReception();
+    /**
+     * Constructor
+     *
+     * \param abstraction whether the reception of the A-MPDUs is abstracted
+     */
+    TestAmpduReception(bool abstraction);
 
   private:
     void DoSetup() override;
@@ -2519,10 +2526,14 @@ class TestAmpduReception : public WifiPhyReceptionTest
 
     uint8_t m_rxDroppedBitmapAmpdu1{0}; ///< bitmap of dropped MPDUs in A-MPDU #1
     uint8_t m_rxDroppedBitmapAmpdu2{0}; ///< bitmap of dropped MPDUs in A-MPDU #2
+
+    bool m_abstraction; ///< whether the reception of the A-MPDUs is abstracted
 };
 
-TestAmpduReception::TestAmpduReception()
-    : WifiPhyReceptionTest("A-MPDU reception test")
+TestAmpduReception::TestAmpduReception(bool abstraction)
+    : WifiPhyReceptionTest(std::string("A-MPDU reception test") +
+                           (abstraction ? " with PHY abstraction" : "")),
+      m_abstraction(abstraction)
 {
 }
 
@@ -2774,6 +2785,7 @@ void
 TestAmpduReception::DoSetup()
 {
     WifiPhyReceptionTest::DoSetup();
+    m_phy->SetAttribute("Abstraction", BooleanValue(m_abstraction));
 
     m_phy->SetReceiveOkCallback(MakeCallback(&TestAmpduReception::RxSuccess, this));
     m_phy->SetReceiveErrorCallback(MakeCallback(&TestAmpduReception::RxFailure, this));
@@ -3959,6 +3971,348 @@ TestAmpduReception::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief PHY abstraction test
+ *
+ * An A-MPDU is received with and without PHY abstraction, first with a power high enough for
+ * the A-MPDU to be successfully received, then with a power that only allows for the PHY header
+ * to be successfully received. In all cases, the PHY is expected to be CCA_BUSY during the PHY
+ * header, RX during the payload and IDLE afterwards. The reception outcome is expected to be
+ * the same with and without abstraction, but the abstracted reception should take fewer events.
+ * Then, an inter-BSS A-MPDU is received with and without PHY abstraction, first filtered based
+ * on its BSS color, then aborted by a CCA reset requested at the end of HE-SIG-A (as done by
+ * OBSS PD spatial reuse). In both cases, the payload is not received. The PHY is expected to
+ * stay CCA_BUSY until the end of the filtered A-MPDU, and to be IDLE after the PHY header of the
+ * A-MPDU for which the CCA is reset.
+ */
+class TestPhyAbstraction : public WifiPhyReceptionTest
+{
+  public:
+    TestPhyAbstraction();
+
+  private:
+    void DoSetup() override;
+    void DoRun() override;
+
+    /**
+     * RX success function
+     * \param psdu the PSDU
+     * \param rxSignalInfo the info on the received signal (\see RxSignalInfo)
+     * \param txVector the transmit vector
+     * \param statusPerMpdu reception status per MPDU
+     */
+    void RxSuccess(Ptr<const WifiPsdu> psdu,
+                   RxSignalInfo rxSignalInfo,
+                   const WifiTxVector& txVector,
+                   const std::vector<bool>& statusPerMpdu);
+    /**
+     * RX failure function
+     * \param psdu the PSDU
+     */
+    void RxFailure(Ptr<const WifiPsdu> psdu);
+
+    /**
+     * \return the TXVECTOR of the A-MPDUs
+     */
+    WifiTxVector GetTxVector() const;
+
+    /**
+     * Send an A-MPDU.
+     * \param psdu the A-MPDU
+     * \param rxPower the receive power
+     */
+    void SendAmpdu(Ptr<WifiPsdu> psdu, dBm_u rxPower);
+
+    /**
+     * Receive an A-MPDU and check the PHY state during the reception and the outcome of the
+     * reception.
+     * \param abstraction whether the reception is abstracted
+     * \param rxPower the receive power
+     * \param expectedSuccess whether the A-MPDU is expected to be successfully received
+     * \return the number of events executed by the simulator
+     */
+    uint64_t RunReception(bool abstraction, dBm_u rxPower, bool expectedSuccess);
+
+    /**
+     * Receive an inter-BSS A-MPDU and check that its payload is not received and that the PHY
+     * is CCA_BUSY until its end if it is filtered, IDLE after its PHY header otherwise.
+     * \param abstraction whether the reception is abstracted
+     * \param filtered whether the A-MPDU is filtered based on its BSS color (otherwise a CCA
+     *                 reset is requested at the end of HE-SIG-A)
+     */
+    void RunInterBssReception(bool abstraction, bool filtered);
+
+    /**
+     * RX PPDU drop function
+     * \param ppdu the PPDU
+     * \param reason the reason why the PPDU is dropped
+     */
+    void RxPpduDrop(Ptr<const WifiPpdu> ppdu, WifiPhyRxfailureReason reason);
+
+    /**
+     * Callback triggered at the end of HE-SIG-A, requesting a CCA reset.
+     * \param params the HE-SIG-A parameters
+     */
+    void ResetCca(HeSigAParameters params);
+
+    uint32_t m_countRxSuccess{0}; ///< count RX success
+    uint32_t m_countRxFailure{0}; ///< count RX failure
+    std::vector<WifiPhyRxfailureReason> m_dropReasons; ///< reasons of the dropped PPDUs
+    uint8_t m_txBssColor{0};                           ///< BSS color of the A-MPDUs
+};
+
+TestPhyAbstraction::TestPhyAbstraction()
+    : WifiPhyReceptionTest("PHY abstraction test")
+{
+}
+
+void
+TestPhyAbstraction::RxSuccess(Ptr<const WifiPsdu> psdu,
+                              RxSignalInfo rxSignalInfo,
+                              const WifiTxVector& txVector,
+                              const std::vector<bool>& statusPerMpdu)
+{
+    NS_LOG_FUNCTION(this << *psdu << rxSignalInfo << txVector);
+    if (!statusPerMpdu.empty()) // wait for the whole A-MPDU
+    {
+        m_countRxSuccess++;
+    }
+}
+
+void
+TestPhyAbstraction::RxFailure(Ptr<const WifiPsdu> psdu)
+{
+    NS_LOG_FUNCTION(this << *psdu);
+    m_countRxFailure++;
+}
+
+void
+TestPhyAbstraction::RxPpduDrop(Ptr<const WifiPpdu> ppdu, WifiPhyRxfailureReason reason)
+{
+    NS_LOG_FUNCTION(this << ppdu << reason);
+    m_dropReasons.push_back(reason);
+}
+
+void
+TestPhyAbstraction::ResetCca(HeSigAParameters params)
+{
+    NS_LOG_FUNCTION(this << params.rssi << +params.bssColor);
+    m_phy->ResetCca(false);
+}
+
+WifiTxVector
+TestPhyAbstraction::GetTxVector() const
+{
+    WifiTxVector txVector(HePhy::GetHeMcs11(),
+                          0,
+                          WIFI_PREAMBLE_HE_SU,
+                          NanoSeconds(800),
+                          1,
+                          1,
+                          0,
+                          20,
+                          true);
+    txVector.SetBssColor(m_txBssColor);
+    return txVector;
+}
+
+void
+TestPhyAbstraction::SendAmpdu(Ptr<WifiPsdu> psdu, dBm_u rxPower)
+{
+    const auto txVector = GetTxVector();
+    auto txDuration = m_phy->CalculateTxDuration(psdu->GetSize(), txVector, m_phy->GetPhyBand());
+    auto ppdu = Create<HePpdu>(psdu, txVector, m_phy->GetOperatingChannel(), txDuration, m_uid++);
+
+    auto txParams = Create<WifiSpectrumSignalParameters>();
+    txParams->psd = WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(FREQUENCY,
+                                                                                CHANNEL_WIDTH,
+                                                                                DbmToW(rxPower),
+                                                                                GUARD_WIDTH);
+    txParams->txPhy = nullptr;
+    txParams->duration = txDuration;
+    txParams->ppdu = ppdu;
+
+    m_phy->StartRx(txParams, nullptr);
+}
+
+uint64_t
+TestPhyAbstraction::RunReception(bool abstraction, dBm_u rxPower, bool expectedSuccess)
+{
+    m_phy->SetAttribute("Abstraction", BooleanValue(abstraction));
+    m_countRxSuccess = 0;
+    m_countRxFailure = 0;
+
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    hdr.SetQosTid(0);
+    std::vector<Ptr<WifiMpdu>> mpduList;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        mpduList.push_back(Create<WifiMpdu>(Create<Packet>(1000), hdr));
+    }
+    auto psdu = Create<WifiPsdu>(mpduList);
+
+    const auto txVector = GetTxVector();
+    const auto headerDuration = WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector);
+    const auto txDuration =
+        WifiPhy::CalculateTxDuration(psdu->GetSize(), txVector, m_phy->GetPhyBand());
+
+    Simulator::Schedule(MilliSeconds(1), &TestPhyAbstraction::SendAmpdu, this, psdu, rxPower);
+    Simulator::Schedule(MilliSeconds(1) + headerDuration - NanoSeconds(1),
+                        &TestPhyAbstraction::CheckPhyState,
+                        this,
+                        WifiPhyState::CCA_BUSY);
+    Simulator::Schedule(MilliSeconds(1) + headerDuration + NanoSeconds(1),
+                        &TestPhyAbstraction::CheckPhyState,
+                        this,
+                        WifiPhyState::RX);
+    Simulator::Schedule(MilliSeconds(1) + txDuration - NanoSeconds(1),
+                        &TestPhyAbstraction::CheckPhyState,
+                        this,
+                        WifiPhyState::RX);
+    Simulator::Schedule(MilliSeconds(1) + txDuration + NanoSeconds(1),
+                        &TestPhyAbstraction::CheckPhyState,
+                        this,
+                        WifiPhyState::IDLE);
+
+    const auto eventCount = Simulator::GetEventCount();
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(m_countRxSuccess,
+                          (expectedSuccess ? 1 : 0),
+                          "Unexpected number of successful receptions (abstraction="
+                              << abstraction << ")");
+    NS_TEST_EXPECT_MSG_EQ(m_countRxFailure,
+                          (expectedSuccess ? 0 : 1),
+                          "Unexpected number of failed receptions (abstraction=" << abstraction
+                                                                                  << ")");
+    return Simulator::GetEventCount() - eventCount;
+}
+
+void
+TestPhyAbstraction::RunInterBssReception(bool abstraction, bool filtered)
+{
+    m_phy->SetAttribute("Abstraction", BooleanValue(abstraction));
+    m_countRxSuccess = 0;
+    m_countRxFailure = 0;
+    m_dropReasons.clear();
+
+    auto heConfiguration = CreateObject<HeConfiguration>();
+    heConfiguration->SetAttribute("BssColor", UintegerValue(filtered ? 1 : 0));
+    DynamicCast<WifiNetDevice>(m_phy->GetDevice())->SetHeConfiguration(heConfiguration);
+    m_txBssColor = 2;
+    auto hePhy = DynamicCast<HePhy>(m_phy->GetPhyEntity(WIFI_MOD_CLASS_HE));
+    if (filtered)
+    {
+        hePhy->SetEndOfHeSigACallback(HePhy::EndOfHeSigACallback());
+    }
+    else
+    {
+        hePhy->SetEndOfHeSigACallback(MakeCallback(&TestPhyAbstraction::ResetCca, this));
+    }
+
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    hdr.SetQosTid(0);
+    std::vector<Ptr<WifiMpdu>> mpduList;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        mpduList.push_back(Create<WifiMpdu>(Create<Packet>(1000), hdr));
+    }
+    auto psdu = Create<WifiPsdu>(mpduList);
+
+    const auto txVector = GetTxVector();
+    const auto headerDuration = WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector);
+    const auto txDuration =
+        WifiPhy::CalculateTxDuration(psdu->GetSize(), txVector, m_phy->GetPhyBand());
+
+    // the CCA reset happens at the end of HE-SIG-A without abstraction and at the end of the
+    // PHY header with abstraction, in both cases the payload is not received
+    const auto stateAfterHeader = filtered ? WifiPhyState::CCA_BUSY : WifiPhyState::IDLE;
+
+    Simulator::Schedule(MilliSeconds(1), &TestPhyAbstraction::SendAmpdu, this, psdu, dBm_u{-30});
+    if (filtered)
+    {
+        Simulator::Schedule(MilliSeconds(1) + headerDuration - NanoSeconds(1),
+                            &TestPhyAbstraction::CheckPhyState,
+                            this,
+                            WifiPhyState::CCA_BUSY);
+    }
+    Simulator::Schedule(MilliSeconds(1) + headerDuration + NanoSeconds(1),
+                        &TestPhyAbstraction::CheckPhyState,
+                        this,
+                        stateAfterHeader);
+    Simulator::Schedule(MilliSeconds(1) + txDuration - NanoSeconds(1),
+                        &TestPhyAbstraction::CheckPhyState,
+                        this,
+                        stateAfterHeader);
+    Simulator::Schedule(MilliSeconds(1) + txDuration + NanoSeconds(1),
+                        &TestPhyAbstraction::CheckPhyState,
+                        this,
+                        WifiPhyState::IDLE);
+
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(m_countRxSuccess + m_countRxFailure,
+                          0,
+                          "The payload should not have been received (abstraction="
+                              << abstraction << ", filtered=" << filtered << ")");
+    NS_TEST_ASSERT_MSG_EQ(m_dropReasons.size(),
+                          1,
+                          "The PPDU should have been dropped once (abstraction="
+                              << abstraction << ", filtered=" << filtered << ")");
+    NS_TEST_EXPECT_MSG_EQ(m_dropReasons.front(),
+                          (filtered ? FILTERED : OBSS_PD_CCA_RESET),
+                          "Unexpected drop reason (abstraction=" << abstraction << ", filtered="
+                                                                 << filtered << ")");
+
+    hePhy->SetEndOfHeSigACallback(HePhy::EndOfHeSigACallback());
+    m_txBssColor = 0;
+}
+
+void
+TestPhyAbstraction::DoSetup()
+{
+    WifiPhyReceptionTest::DoSetup();
+    // the HE configuration of the device is only used if the standard is set
+    DynamicCast<WifiNetDevice>(m_phy->GetDevice())->SetStandard(WIFI_STANDARD_80211ax);
+    m_phy->SetReceiveOkCallback(MakeCallback(&TestPhyAbstraction::RxSuccess, this));
+    m_phy->SetReceiveErrorCallback(MakeCallback(&TestPhyAbstraction::RxFailure, this));
+    m_phy->TraceConnectWithoutContext("PhyRxPpduDrop",
+                                      MakeCallback(&TestPhyAbstraction::RxPpduDrop, this));
+}
+
+void
+TestPhyAbstraction::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    int64_t streamNumber = 0;
+    m_phy->AssignStreams(streamNumber);
+
+    for (const auto& [rxPower, expectedSuccess] : {std::pair{-30.0, true}, {-80.0, false}})
+    {
+        const auto fullEvents = RunReception(false, rxPower, expectedSuccess);
+        const auto abstractedEvents = RunReception(true, rxPower, expectedSuccess);
+        NS_LOG_DEBUG("RX power " << rxPower << " dBm: " << fullEvents << " events, "
+                                 << abstractedEvents << " events with abstraction");
+        NS_TEST_EXPECT_MSG_LT(abstractedEvents,
+                              fullEvents,
+                              "The abstracted reception should take fewer events");
+    }
+
+    for (const auto filtered : {true, false})
+    {
+        RunInterBssReception(false, filtered);
+        RunInterBssReception(true, filtered);
+    }
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -5028,7 +5382,9 @@ WifiPhyReceptionTestSuite::WifiPhyReceptionTestSuite()
     AddTestCase(new TestThresholdPreambleDetectionWithFrameCapture, TestCase::Duration::QUICK);
     AddTestCase(new TestSimpleFrameCaptureModel, TestCase::Duration::QUICK);
     AddTestCase(new TestPhyHeadersReception, TestCase::Duration::QUICK);
-    AddTestCase(new TestAmpduReception, TestCase::Duration::QUICK);
+    AddTestCase(new TestAmpduReception(false), TestCase::Duration::QUICK);
+    AddTestCase(new TestAmpduReception(true), TestCase::Duration::QUICK);
+    AddTestCase(new TestPhyAbstraction, TestCase::Duration::QUICK);
     AddTestCase(new TestUnsupportedModulationReception(), TestCase::Duration::QUICK);
     AddTestCase(new TestUnsupportedBandwidthReception(), TestCase::Duration::QUICK);
     AddTestCase(new TestPrimary20CoveredByPpdu(), TestCase::Duration::QUICK);
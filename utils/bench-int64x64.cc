@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/core-module.h"
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/** Output field width. */
+const int g_fwidth = 16;
+
+/**
+ * Time \pname{total} applications of a binary operation.
+ *
+ * The operands are taken in turn from \pname{lhs} and \pname{rhs}, so that
+ * the compiler cannot hoist the operation out of the loop.
+ *
+ * \param [in] op The operation.
+ * \param [in] lhs The left operands.
+ * \param [in] rhs The right operands.
+ * \param [in] total The number of operations.
+ * \returns The elapsed time (s).
+ */
+double
+Bench(const std::function<int64x64_t(const int64x64_t&, const int64x64_t&)>& op,
+      const std::vector<int64x64_t>& lhs,
+      const std::vector<int64x64_t>& rhs,
+      uint64_t total)
+{
+    SystemWallClockMs timer;
+    int64x64_t sum;
+    timer.Start();
+    for (uint64_t i = 0; i < total; ++i)
+    {
+        sum += op(lhs[i % lhs.size()], rhs[i % rhs.size()]);
+    }
+    double elapsed = timer.End() / 1000.0;
+    // prevent the loop from being optimized away
+    if (sum == int64x64_t(0.123456789))
+    {
+        LOG("");
+    }
+    return elapsed;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint64_t total = 10000000;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the int64x64_t arithmetic operations used by ns3::Time,\n"
+              "ns3::DataRate and the unit conversions.");
+    cmd.AddValue("total", "number of operations per test", total);
+    cmd.Parse(argc, argv);
+
+    auto rng = CreateObject<UniformRandomVariable>();
+    std::vector<int64x64_t> values;
+    std::vector<int64x64_t> fractions;
+    std::vector<int64x64_t> integers;
+    std::vector<int64x64_t> inverses;
+    for (int i = 0; i < 1024; ++i)
+    {
+        values.emplace_back(rng->GetValue(0, 1e9));
+        fractions.emplace_back(rng->GetValue(1, 1e6));
+        // bit counts and data rates
+        integers.emplace_back(rng->GetInteger(1, 100000000));
+        inverses.push_back(int64x64_t::Invert(rng->GetInteger(1, 1000000000)));
+    }
+
+    std::string implementation;
+    switch (int64x64_t::implementation)
+    {
+    case int64x64_t::int128_impl:
+        implementation = "int128_impl";
+        break;
+    case int64x64_t::cairo_impl:
+        implementation = "cairo_impl";
+        break;
+    case int64x64_t::ld_impl:
+        implementation = "ld_impl";
+        break;
+    }
+    LOG("Implementation: " << implementation);
+    LOG("Operations per test: " << total);
+    LOG(std::left << std::setw(3 * g_fwidth) << "Operation"
+                  << "Time (ns)");
+
+    auto report = [total](const std::string& name, double elapsed) {
+        LOG(std::left << std::setw(3 * g_fwidth) << name << elapsed * 1e9 / total);
+    };
+
+    report("Multiplication",
+           Bench([](const int64x64_t& a, const int64x64_t& b) { return a * b; },
+                 values,
+                 fractions,
+                 total));
+    report("Division by a fraction",
+           Bench([](const int64x64_t& a, const int64x64_t& b) { return a / b; },
+                 values,
+                 fractions,
+                 total));
+    report("Division by an integer",
+           Bench([](const int64x64_t& a, const int64x64_t& b) { return a / b; },
+                 values,
+                 integers,
+                 total));
+    report("MulByInvert",
+           Bench(
+               [](const int64x64_t& a, const int64x64_t& b) {
+                   int64x64_t result = a;
+                   result.MulByInvert(b);
+                   return result;
+               },
+               values,
+               inverses,
+               total));
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// Benchmark of the InterferenceHelper, built from the scenario of the
+// wifi-test-interference-helper example: a number of hidden stations
+// transmit PPDUs to an access point, at random times so that the PPDUs
+// overlap.  Every PHY tracks the noise and interference of all the bands of
+// its channel (e.g., about 150 bands for an 802.11ax PHY operating on a
+// 160 MHz channel, the RUs included), which makes the InterferenceHelper
+// the main cost of the simulation.
+//
+// The program reports the wall clock time per PPDU transmitted, and the
+// numbers of PPDUs received and dropped by the access point, which do not
+// depend on the implementation of the InterferenceHelper.  The number of
+// events executed by the simulator is also reported, so that the cost of
+// the full reception model can be compared with the one of the abstracted
+// reception (--abstraction).
+
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/double.h"
+#include "ns3/he-phy.h"
+#include "ns3/interference-helper.h"
+#include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/nist-error-rate-model.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/propagation-delay-model.h"
+#include "ns3/propagation-loss-model.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/spectrum-wifi-phy.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/wifi-mac-trailer.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-psdu.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/// Interference benchmark
+class InterferenceBenchmark
+{
+  public:
+    /// Input structure
+    struct Input
+    {
+        uint32_t nStations{8};     ///< number of transmitting stations
+        uint32_t nPpdus{200};      ///< number of PPDUs transmitted by each station
+        Time period{"500us"};      ///< mean time between two PPDUs of a station
+        uint32_t packetSize{1500}; ///< size of the PSDUs in bytes
+        uint8_t mcs{5};            ///< HE MCS of the PPDUs
+        MHz_u width{160};          ///< channel width
+        bool abstraction{false};   ///< whether the reception of the PPDUs is abstracted
+    };
+
+    /**
+     * Run the benchmark.
+     *
+     * \param input the input of the benchmark
+     */
+    void Run(const Input& input);
+
+  private:
+    /**
+     * Create a PHY attached to the channel at the given position.
+     *
+     * \param position the position of the PHY
+     * \return the PHY
+     */
+    Ptr<SpectrumWifiPhy> CreatePhy(const Vector& position);
+
+    /**
+     * \return the TXVECTOR of the PPDUs
+     */
+    WifiTxVector GetTxVector() const;
+
+    /**
+     * Transmit a PPDU from the given station and schedule the next one.
+     *
+     * \param station the index of the station
+     * \param remaining the number of PPDUs remaining to transmit after this one
+     */
+    void Send(uint32_t station, uint32_t remaining);
+
+    /**
+     * Callback invoked when the access point receives a PPDU.
+     *
+     * \param packet the packet received
+     */
+    void Received(Ptr<const Packet> packet);
+
+    /**
+     * Callback invoked when the access point drops a PPDU.
+     *
+     * \param packet the packet dropped
+     * \param reason the reason of the drop
+     */
+    void Dropped(Ptr<const Packet> packet, WifiPhyRxfailureReason reason);
+
+    Input m_input;                            ///< input
+    Ptr<MultiModelSpectrumChannel> m_channel; ///< channel
+    std::vector<Ptr<SpectrumWifiPhy>> m_phys; ///< PHYs, the access point first
+    Ptr<UniformRandomVariable> m_interval;    ///< time between two PPDUs of a station
+    uint64_t m_received{0};                   ///< PPDUs received by the access point
+    uint64_t m_dropped{0};                    ///< PPDUs dropped by the access point
+};
+
+Ptr<SpectrumWifiPhy>
+InterferenceBenchmark::CreatePhy(const Vector& position)
+{
+    auto node = CreateObject<Node>();
+    auto device = CreateObject<WifiNetDevice>();
+    auto phy = CreateObject<SpectrumWifiPhy>();
+    phy->SetDevice(device);
+    phy->SetAttribute("Abstraction", BooleanValue(m_input.abstraction));
+    phy->SetInterferenceHelper(CreateObject<InterferenceHelper>());
+    phy->SetErrorRateModel(CreateObject<NistErrorRateModel>());
+    phy->AddChannel(m_channel);
+    auto mobility = CreateObject<ConstantPositionMobilityModel>();
+    mobility->SetPosition(position);
+    phy->SetMobility(mobility);
+    phy->ConfigureStandard(WIFI_STANDARD_80211ax);
+    device->SetPhy(phy);
+    node->AddDevice(device);
+    phy->SetOperatingChannel(WifiPhy::ChannelTuple{0, m_input.width, WIFI_PHY_BAND_5GHZ, 0});
+    return phy;
+}
+
+WifiTxVector
+InterferenceBenchmark::GetTxVector() const
+{
+    return WifiTxVector(HePhy::GetHeMcs(m_input.mcs),
+                        0,
+                        WIFI_PREAMBLE_HE_SU,
+                        NanoSeconds(800),
+                        1,
+                        1,
+                        0,
+                        m_input.width,
+                        false);
+}
+
+void
+InterferenceBenchmark::Send(uint32_t station, uint32_t remaining)
+{
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    hdr.SetQosTid(0);
+    auto packet =
+        Create<Packet>(m_input.packetSize - hdr.GetSerializedSize() - WIFI_MAC_FCS_LENGTH);
+    m_phys[station]->Send(Create<WifiPsdu>(packet, hdr), GetTxVector());
+    if (remaining > 0)
+    {
+        Simulator::Schedule(MicroSeconds(m_interval->GetInteger()),
+                            &InterferenceBenchmark::Send,
+                            this,
+                            station,
+                            remaining - 1);
+    }
+}
+
+void
+InterferenceBenchmark::Received(Ptr<const Packet> packet)
+{
+    m_received++;
+}
+
+void
+InterferenceBenchmark::Dropped(Ptr<const Packet> packet, WifiPhyRxfailureReason reason)
+{
+    m_dropped++;
+}
+
+void
+InterferenceBenchmark::Run(const Input& input)
+{
+    m_input = input;
+    m_channel = CreateObject<MultiModelSpectrumChannel>();
+    m_channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+    m_channel->AddPropagationLossModel(CreateObject<LogDistancePropagationLossModel>());
+
+    // the access point at the center of a circle of stations
+    m_phys.push_back(CreatePhy({0, 0, 0}));
+    for (uint32_t i = 0; i < input.nStations; i++)
+    {
+        auto angle = 2 * M_PI * i / input.nStations;
+        m_phys.push_back(CreatePhy({10 * std::cos(angle), 10 * std::sin(angle), 0}));
+    }
+    m_phys.front()->TraceConnectWithoutContext(
+        "PhyRxEnd",
+        MakeCallback(&InterferenceBenchmark::Received, this));
+    m_phys.front()->TraceConnectWithoutContext(
+        "PhyRxDrop",
+        MakeCallback(&InterferenceBenchmark::Dropped, this));
+
+    // the PPDUs of a station are far enough apart for the previous one to be over
+    auto duration =
+        WifiPhy::CalculateTxDuration(input.packetSize, GetTxVector(), WIFI_PHY_BAND_5GHZ)
+            .GetMicroSeconds();
+    auto period = input.period.GetMicroSeconds();
+    m_interval = CreateObject<UniformRandomVariable>();
+    m_interval->SetAttribute("Min", DoubleValue(duration + 1));
+    m_interval->SetAttribute("Max", DoubleValue(std::max(2 * period - duration, duration + 1)));
+    m_interval->SetStream(1);
+    for (uint32_t i = 1; i <= input.nStations; i++)
+    {
+        Simulator::Schedule(MicroSeconds(m_interval->GetInteger()),
+                            &InterferenceBenchmark::Send,
+                            this,
+                            i,
+                            input.nPpdus - 1);
+    }
+
+    SystemWallClockMs timer;
+    timer.Start();
+    Simulator::Run();
+    double elapsed = timer.End() / 1000.0;
+    uint64_t nPpdus = static_cast<uint64_t>(input.nStations) * input.nPpdus;
+
+    LOG("PPDUs transmitted:    " << nPpdus);
+    LOG("PPDUs received by AP: " << m_received);
+    LOG("PPDUs dropped by AP:  " << m_dropped);
+    LOG("Wall clock time (s):  " << elapsed);
+    LOG("Time per PPDU (us):   " << elapsed * 1e6 / nPpdus);
+    LOG("Events executed:      " << Simulator::GetEventCount());
+
+    Simulator::Destroy();
+    for (auto& phy : m_phys)
+    {
+        phy->Dispose();
+    }
+    m_phys.clear();
+}
+
+int
+main(int argc, char* argv[])
+{
+    InterferenceBenchmark::Input input;
+    uint16_t mcs = input.mcs;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the InterferenceHelper with stations transmitting\n"
+              "overlapping 802.11ax PPDUs to an access point.");
+    cmd.AddValue("nStations", "Number of transmitting stations", input.nStations);
+    cmd.AddValue("nPpdus", "Number of PPDUs transmitted by each station", input.nPpdus);
+    cmd.AddValue("period", "Mean time between two PPDUs of a station", input.period);
+    cmd.AddValue("packetSize", "Size of the PSDUs in bytes", input.packetSize);
+    cmd.AddValue("mcs", "HE MCS of the PPDUs", mcs);
+    cmd.AddValue("width", "Channel width in MHz (20, 40, 80 or 160)", input.width);
+    cmd.AddValue("abstraction", "Abstract the reception of the PPDUs", input.abstraction);
+    cmd.Parse(argc, argv);
+    input.mcs = static_cast<uint8_t>(mcs);
+
+    RngSeedManager::SetSeed(1);
+    InterferenceBenchmark benchmark;
+    benchmark.Run(input);
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/core-module.h"
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/** Output field width. */
+const int g_fwidth = 16;
+
+/**
+ * Time the generation of \pname{total} values by calling GetValue() once per value.
+ *
+ * \param [in] rv The random variable.
+ * \param [in] total The number of values to generate.
+ * \returns The elapsed time (s).
+ */
+double
+BenchSingle(Ptr<RandomVariableStream> rv, uint64_t total)
+{
+    SystemWallClockMs timer;
+    double sum = 0;
+    timer.Start();
+    for (uint64_t i = 0; i < total; ++i)
+    {
+        sum += rv->GetValue();
+    }
+    double elapsed = timer.End() / 1000.0;
+    // prevent the loop from being optimized away
+    if (sum == 0.123456789)
+    {
+        LOG("");
+    }
+    return elapsed;
+}
+
+/**
+ * Time the generation of \pname{total} values by calling GetValues() on
+ * batches of \pname{batch} values.
+ *
+ * \param [in] rv The random variable.
+ * \param [in] total The number of values to generate.
+ * \param [in] batch The batch size.
+ * \returns The elapsed time (s).
+ */
+double
+BenchBulk(Ptr<RandomVariableStream> rv, uint64_t total, uint64_t batch)
+{
+    SystemWallClockMs timer;
+    std::vector<double> values(batch);
+    double sum = 0;
+    timer.Start();
+    for (uint64_t generated = 0; generated < total; generated += batch)
+    {
+        rv->GetValues(values);
+        sum += values.back();
+    }
+    double elapsed = timer.End() / 1000.0;
+    // prevent the loop from being optimized away
+    if (sum == 0.123456789)
+    {
+        LOG("");
+    }
+    return elapsed;
+}
+
+/**
+ * Create a random variable from its description.
+ *
+ * \param [in] description The TypeId name, possibly followed by attribute
+ *             values in the ObjectFactory syntax.
+ * \returns The random variable.
+ */
+Ptr<RandomVariableStream>
+CreateRandomVariable(const std::string& description)
+{
+    ObjectFactory factory;
+    std::istringstream(description) >> factory;
+    auto rv = factory.Create<RandomVariableStream>();
+    if (auto empirical = DynamicCast<EmpiricalRandomVariable>(rv))
+    {
+        // a CDF with a few dozen points, like the ones found in traffic models
+        for (int i = 1; i <= 32; ++i)
+        {
+            empirical->CDF(i * i, i / 32.0);
+        }
+    }
+    return rv;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint64_t total = 10000000;
+    uint64_t batch = 1024;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the generation of random values one at a time\n"
+              "with RandomVariableStream::GetValue() against batches\n"
+              "with RandomVariableStream::GetValues(), for every generator type.\n"
+              "Both methods generate exactly the same values.");
+    cmd.AddValue("total", "number of values to generate per test", total);
+    cmd.AddValue("batch", "number of values per GetValues() call", batch);
+    cmd.Parse(argc, argv);
+    NS_ABORT_MSG_IF(batch < 1, "The batch size must be at least 1");
+
+    const std::vector<std::string> distributions{
+        "ns3::UniformRandomVariable",
+        "ns3::ExponentialRandomVariable",
+        "ns3::ParetoRandomVariable",
+        "ns3::WeibullRandomVariable",
+        "ns3::NormalRandomVariable",
+        "ns3::LogNormalRandomVariable",
+        "ns3::TriangularRandomVariable",
+        "ns3::EmpiricalRandomVariable[Interpolate=true]",
+        "ns3::LargestExtremeValueRandomVariable",
+    };
+
+    LOG("Values per test: " << total << ", batch size: " << batch);
+
+    for (auto [type, typeName] : {std::pair{RngSeedManager::MRG32K3A, "MRG32k3a"},
+                                  std::pair{RngSeedManager::PHILOX4X32, "Philox4x32"}})
+    {
+        RngSeedManager::SetRngType(type);
+        LOG("");
+        LOG("Generator: " << typeName);
+        LOG(std::left << std::setw(3 * g_fwidth) << "Distribution" << std::setw(g_fwidth)
+                      << "GetValue (ns)" << std::setw(g_fwidth) << "GetValues (ns)"
+                      << "Speedup");
+        for (const auto& description : distributions)
+        {
+            auto single = BenchSingle(CreateRandomVariable(description), total);
+            auto bulk = BenchBulk(CreateRandomVariable(description), total, batch);
+            LOG(std::left << std::setw(3 * g_fwidth) << description << std::setw(g_fwidth)
+                          << single * 1e9 / total << std::setw(g_fwidth) << bulk * 1e9 / total
+                          << single / bulk);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/wifi-module.h"
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/** Output field width. */
+const int g_fwidth = 16;
+
+/**
+ * Time \pname{total} calls of an operation and print the time per call.
+ *
+ * \param [in] name The name of the operation.
+ * \param [in] op The operation, which takes the iteration number and
+ *             returns a value depending on its result.
+ * \param [in] total The number of calls.
+ */
+void
+Bench(const std::string& name, const std::function<int64_t(uint64_t)>& op, uint64_t total)
+{
+    SystemWallClockMs timer;
+    int64_t sum = 0;
+    timer.Start();
+    for (uint64_t i = 0; i < total; ++i)
+    {
+        sum += op(i);
+    }
+    double elapsed = timer.End() / 1000.0;
+    // prevent the loop from being optimized away
+    if (sum == 123456789)
+    {
+        LOG("");
+    }
+    LOG(std::left << std::setw(3 * g_fwidth) << name << elapsed * 1e9 / total);
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint64_t total = 10000000;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the creation of Time objects from values in a given unit,\n"
+              "their conversion to values in a given unit, and the computation of\n"
+              "the duration of Wi-Fi PPDUs, which makes heavy use of both.");
+    cmd.AddValue("total", "number of operations per test", total);
+    cmd.Parse(argc, argv);
+
+    // Time instances are recorded until the simulation starts, in case the
+    // resolution is changed: run an empty simulation to skip that cost
+    Simulator::Run();
+
+    const std::vector<Time> times{NanoSeconds(1),
+                                  NanoSeconds(800),
+                                  MicroSeconds(9),
+                                  MicroSeconds(5484),
+                                  MilliSeconds(100),
+                                  Seconds(1.5),
+                                  Seconds(3600),
+                                  NanoSeconds(-123456789)};
+    const std::vector<int64x64_t> integers{1, 16, 100, 3200, 12800, -5};
+
+    LOG("Operations per test: " << total);
+    LOG(std::left << std::setw(3 * g_fwidth) << "Operation"
+                  << "Time (ns)");
+
+    Bench(
+        "Seconds(double), integer value",
+        [](uint64_t i) { return Seconds(static_cast<double>(i % 16)).GetTimeStep(); },
+        total);
+    Bench(
+        "Seconds(double), fractional value",
+        [](uint64_t i) { return Seconds((i % 16) * 0.25 + 0.1).GetTimeStep(); },
+        total);
+    Bench(
+        "MicroSeconds(int64_t)",
+        [](uint64_t i) { return MicroSeconds(i % 16).GetTimeStep(); },
+        total);
+    Bench(
+        "NanoSeconds(int64x64_t)",
+        [&integers](uint64_t i) {
+            return NanoSeconds(integers[i % integers.size()]).GetTimeStep();
+        },
+        total);
+    Bench(
+        "Time::GetSeconds()",
+        [&times](uint64_t i) {
+            return static_cast<int64_t>(times[i % times.size()].GetSeconds());
+        },
+        total);
+    Bench(
+        "Time::GetMicroSeconds()",
+        [&times](uint64_t i) { return times[i % times.size()].GetMicroSeconds(); },
+        total);
+    Bench(
+        "Time::GetNanoSeconds()",
+        [&times](uint64_t i) { return times[i % times.size()].GetNanoSeconds(); },
+        total);
+    Bench(
+        "Time::To(Time::PS)",
+        [&times](uint64_t i) { return times[i % times.size()].To(Time::PS).GetHigh(); },
+        total);
+
+    // (mode, power level, preamble, guard interval, nTx, nss, ness, width, aggregation)
+    const std::vector<WifiTxVector> txVectors{
+        {HtPhy::GetHtMcs7(), 0, WIFI_PREAMBLE_HT_MF, NanoSeconds(800), 1, 1, 0, 20, true},
+        {VhtPhy::GetVhtMcs9(), 0, WIFI_PREAMBLE_VHT_SU, NanoSeconds(400), 2, 2, 0, 80, true},
+        {HePhy::GetHeMcs11(), 0, WIFI_PREAMBLE_HE_SU, NanoSeconds(800), 1, 1, 0, 160, true},
+        {HePhy::GetHeMcs0(), 0, WIFI_PREAMBLE_HE_SU, NanoSeconds(3200), 1, 1, 0, 20, false},
+    };
+    const std::vector<uint32_t> sizes{14, 76, 1536, 11454, 65535};
+
+    Bench(
+        "WifiPhy::CalculateTxDuration()",
+        [&txVectors, &sizes](uint64_t i) {
+            return WifiPhy::CalculateTxDuration(sizes[i % sizes.size()],
+                                                txVectors[(i / sizes.size()) % txVectors.size()],
+                                                WIFI_PHY_BAND_5GHZ)
+                .GetTimeStep();
+        },
+        total / 10);
+
+    Simulator::Destroy();
+    return 0;
+}
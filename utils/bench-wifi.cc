@@ -0,0 +1,807 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// Benchmark of the Wi-Fi models, which measures the throughput of the
+// simulator (events per second, wall clock time per simulated second) for a
+// few standard configurations, so that the performance can be tracked across
+// releases.  The following scenarios are available:
+//
+// - dense-ap: 802.11ax BSSs of 10 nodes (an access point and 9 stations)
+//   placed on a grid and operating on 20 MHz channels of the 5 GHz band
+//   reused across the BSSs;
+// - mlo: the same deployment with 802.11be AP MLDs and non-AP MLDs setting
+//   up two links, one in the 5 GHz band and one in the 6 GHz band;
+// - adhoc: 802.11ax ad hoc stations placed on a grid and sharing a 20 MHz
+//   channel, each of them transmitting to a neighbor (single hop);
+// - mesh: 802.11a 802.11s mesh points placed on a grid, so that only the
+//   neighboring mesh points are in range, each of them transmitting to the mesh
+//   point two columns away on its row (two hops, with HWMP path discovery).
+//   This scenario is only available if the mesh module is enabled.
+//
+// In the infrastructure scenarios, every station has an uplink flow to its
+// access point and the access point has a downlink flow to every station.
+// The flows are generated by packet socket clients transmitting a packet
+// every --interval, starting after a warmup period (during which the
+// stations associate) which is not part of the measurements.
+//
+// The results are written as a JSON object, which includes the wall clock
+// time, the peak resident set size of the process and the number of events
+// executed, in total and per module.  The module of an event is the ns-3
+// library which scheduled it (see ModuleCountingSimulatorImpl); the events
+// cancelled before their expiration are included in the total only.
+// Counting the events per module adds a small overhead to every event, which
+// can be avoided with --countModules=0.  Since the peak RSS covers the whole
+// process, run one configuration per process, e.g.:
+//
+//   for n in 10 100 1000; do ./bench-wifi --scenario=mlo --nodes=$n; done
+
+#include "ns3/abort.h"
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/default-simulator-impl.h"
+#include "ns3/demangle.h"
+#include "ns3/double.h"
+#include "ns3/event-impl.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/node.h"
+#include "ns3/packet-socket-client.h"
+#include "ns3/packet-socket-helper.h"
+#include "ns3/packet-socket-server.h"
+#include "ns3/propagation-delay-model.h"
+#include "ns3/propagation-loss-model.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/spectrum-wifi-helper.h"
+#include "ns3/ssid.h"
+#include "ns3/sta-wifi-mac.h"
+#include "ns3/string.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/uinteger.h"
+#include "ns3/wifi-mac-helper.h"
+#include "ns3/wifi-net-device.h"
+
+#ifdef NS3_MESH
+#include "ns3/mesh-helper.h"
+#endif
+
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <dlfcn.h>
+#include <sys/resource.h>
+#endif
+
+using namespace ns3;
+
+/**
+ * Simulator implementation counting the events executed per module.
+ *
+ * Every event scheduled is wrapped in an event which increments the counter
+ * of the module of the original event before invoking it.  The module of an
+ * event is the ns-3 library holding the code of the event, i.e., the library
+ * which scheduled it.  When the libraries cannot be told apart (static or
+ * monolithic builds, platforms without dladdr), the module of an event is the
+ * group name of the first class registered with the TypeId system found in
+ * the type of the event.
+ */
+class ModuleCountingSimulatorImpl : public DefaultSimulatorImpl
+{
+  public:
+    ModuleCountingSimulatorImpl();
+
+    EventId Schedule(const Time& delay, EventImpl* event) override;
+    void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event) override;
+
+    /**
+     * \return the number of events executed per module since the last reset
+     */
+    std::map<std::string, uint64_t> GetModuleCounts() const;
+
+    /// Reset the number of events executed per module
+    void ResetModuleCounts();
+
+  private:
+    /// Event incrementing a counter before invoking the event it wraps
+    class CountedEvent : public EventImpl
+    {
+      public:
+        /**
+         * Constructor.
+         *
+         * \param event the event to wrap, which is owned by this event
+         * \param counter the counter to increment when the event is executed
+         */
+        CountedEvent(EventImpl* event, uint64_t& counter);
+
+      protected:
+        void Notify() override;
+
+      private:
+        Ptr<EventImpl> m_event; ///< the wrapped event
+        uint64_t& m_counter;    ///< the counter of the module of the event
+    };
+
+    /**
+     * \param event the event to wrap
+     * \return the event counting the executions of the given event
+     */
+    EventImpl* Wrap(EventImpl* event);
+
+    /**
+     * \param event an event
+     * \return the module of the event
+     */
+    std::string GetModule(const EventImpl* event) const;
+
+    /**
+     * \param address an address in the code or data of a library
+     * \return the file name of the library, or an empty string if not available
+     */
+    static std::string GetLibraryName(const void* address);
+
+    std::string m_libraryPrefix; ///< the part of the library names before the module name
+    std::string m_librarySuffix; ///< the part of the library names after the module name
+    std::map<std::string, uint64_t> m_counts;                  ///< counters per module
+    std::unordered_map<std::type_index, uint64_t*> m_counters; ///< counter per event type
+};
+
+ModuleCountingSimulatorImpl::ModuleCountingSimulatorImpl()
+{
+    // the names of the libraries of the modules differ by the module name only,
+    // e.g., libns3-dev-core-default.so and libns3-dev-wifi-default.so
+    auto core = GetLibraryName(reinterpret_cast<const void*>(&Simulator::Now));
+    if (auto pos = core.find("-core"); pos != std::string::npos)
+    {
+        m_libraryPrefix = core.substr(0, pos + 1);
+        m_librarySuffix = core.substr(pos + 5);
+    }
+}
+
+ModuleCountingSimulatorImpl::CountedEvent::CountedEvent(EventImpl* event, uint64_t& counter)
+    : m_event(event, false),
+      m_counter(counter)
+{
+}
+
+void
+ModuleCountingSimulatorImpl::CountedEvent::Notify()
+{
+    ++m_counter;
+    m_event->Invoke();
+}
+
+EventId
+ModuleCountingSimulatorImpl::Schedule(const Time& delay, EventImpl* event)
+{
+    // ScheduleNow calls Schedule, hence it needs not be overridden
+    return DefaultSimulatorImpl::Schedule(delay, Wrap(event));
+}
+
+void
+ModuleCountingSimulatorImpl::ScheduleWithContext(uint32_t context,
+                                                 const Time& delay,
+                                                 EventImpl* event)
+{
+    DefaultSimulatorImpl::ScheduleWithContext(context, delay, Wrap(event));
+}
+
+EventImpl*
+ModuleCountingSimulatorImpl::Wrap(EventImpl* event)
+{
+    auto [it, inserted] = m_counters.try_emplace(std::type_index(typeid(*event)), nullptr);
+    if (inserted)
+    {
+        it->second = &m_counts[GetModule(event)];
+    }
+    return new CountedEvent(event, *it->second);
+}
+
+std::string
+ModuleCountingSimulatorImpl::GetLibraryName(const void* address)
+{
+#if defined(__linux__) || defined(__APPLE__)
+    Dl_info info;
+    if (dladdr(address, &info) != 0 && info.dli_fname != nullptr)
+    {
+        std::string name{info.dli_fname};
+        return name.substr(name.find_last_of('/') + 1);
+    }
+#endif
+    return "";
+}
+
+std::string
+ModuleCountingSimulatorImpl::GetModule(const EventImpl* event) const
+{
+    if (!m_libraryPrefix.empty())
+    {
+        // the virtual table of the event is in the library which instantiated it
+        auto library = GetLibraryName(*reinterpret_cast<void* const*>(event));
+        if (library.size() > m_libraryPrefix.size() + m_librarySuffix.size() &&
+            library.starts_with(m_libraryPrefix) && library.ends_with(m_librarySuffix))
+        {
+            return library.substr(m_libraryPrefix.size(),
+                                  library.size() - m_libraryPrefix.size() -
+                                      m_librarySuffix.size());
+        }
+    }
+
+    const auto type = Demangle(typeid(*event).name());
+    const std::string ns{"ns3::"};
+    for (auto pos = type.find(ns); pos != std::string::npos; pos = type.find(ns, pos + 1))
+    {
+        auto end = pos + ns.size();
+        while (end < type.size() && (std::isalnum(type[end]) || type[end] == '_'))
+        {
+            end++;
+        }
+        TypeId tid;
+        if (TypeId::LookupByNameFailSafe(type.substr(pos, end - pos), &tid) &&
+            !tid.GetGroupName().empty())
+        {
+            return tid.GetGroupName();
+        }
+    }
+    return "other";
+}
+
+std::map<std::string, uint64_t>
+ModuleCountingSimulatorImpl::GetModuleCounts() const
+{
+    std::map<std::string, uint64_t> counts;
+    for (const auto& [module, count] : m_counts)
+    {
+        if (count > 0)
+        {
+            counts.emplace(module, count);
+        }
+    }
+    return counts;
+}
+
+void
+ModuleCountingSimulatorImpl::ResetModuleCounts()
+{
+    for (auto& [module, count] : m_counts)
+    {
+        count = 0;
+    }
+}
+
+/// Wi-Fi benchmark
+class WifiBenchmark
+{
+  public:
+    /// Input structure
+    struct Input
+    {
+        std::string scenario{"dense-ap"}; ///< scenario (dense-ap, mlo, adhoc or mesh)
+        uint32_t nNodes{10};              ///< number of nodes
+        Time duration{"1s"};              ///< simulated time measured
+        Time warmup{"1s"};                ///< simulated time before the measurements
+        uint32_t packetSize{1000};        ///< size of the packets in bytes
+        Time interval{"10ms"};            ///< time between two packets of a flow
+        bool countModules{true};          ///< whether to count the events per module
+    };
+
+    /**
+     * Run the benchmark.
+     *
+     * \param input the input of the benchmark
+     * \param os the output stream the JSON results are written to
+     */
+    void Run(const Input& input, std::ostream& os);
+
+  private:
+    /**
+     * Create the BSSs of the dense-ap (single link) or mlo (two links) scenario.
+     *
+     * \param mlo whether the devices are multi-link devices
+     */
+    void SetupInfrastructure(bool mlo);
+
+    /// Create the stations of the adhoc scenario
+    void SetupAdhoc();
+
+#ifdef NS3_MESH
+    /// Create the mesh points of the mesh scenario
+    void SetupMesh();
+#endif
+
+    /**
+     * Place the given nodes on a grid.
+     *
+     * \param nodes the nodes
+     * \param spacing the distance between two adjacent nodes in meters
+     * \param offset the offset of every node from its position on the grid
+     */
+    void PlaceOnGrid(const NodeContainer& nodes, double spacing, const Vector& offset);
+
+    /**
+     * Add a flow between two devices.
+     *
+     * \param from the device transmitting the packets
+     * \param to the device receiving the packets
+     */
+    void AddFlow(Ptr<NetDevice> from, Ptr<NetDevice> to);
+
+    /// Install a packet socket server on every node
+    void InstallServers();
+
+    /**
+     * Callback invoked when a server receives a packet.
+     *
+     * \param packet the packet received
+     * \param from the address of the sender
+     */
+    void Received(Ptr<const Packet> packet, const Address& from);
+
+    /**
+     * \return the number of stations associated with an access point
+     */
+    uint32_t GetNAssociatedStations() const;
+
+    /**
+     * \return the peak resident set size of the process in KiB, or zero if not available
+     */
+    static uint64_t GetPeakRss();
+
+    /**
+     * Write the results as a JSON object.
+     *
+     * \param os the output stream
+     * \param elapsed the wall clock time of the measurements in seconds
+     * \param nEvents the number of events executed during the measurements
+     * \param moduleCounts the number of events executed per module
+     */
+    void WriteJson(std::ostream& os,
+                   double elapsed,
+                   uint64_t nEvents,
+                   const std::map<std::string, uint64_t>& moduleCounts) const;
+
+    Input m_input;                         ///< input
+    std::string m_standard;                ///< the standard of the devices
+    NodeContainer m_nodes;                 ///< all the nodes
+    NetDeviceContainer m_apDevices;        ///< the devices of the access points
+    NetDeviceContainer m_staDevices;       ///< the devices of the (non-AP) stations or mesh points
+    Ptr<UniformRandomVariable> m_startRng; ///< start time of the flows within an interval
+    uint64_t m_nFlows{0};                  ///< number of flows
+    uint64_t m_received{0};                ///< packets received during the measurements
+};
+
+void
+WifiBenchmark::PlaceOnGrid(const NodeContainer& nodes, double spacing, const Vector& offset)
+{
+    auto side = static_cast<uint32_t>(std::ceil(std::sqrt(nodes.GetN())));
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator("ns3::GridPositionAllocator",
+                                  "MinX",
+                                  DoubleValue(offset.x),
+                                  "MinY",
+                                  DoubleValue(offset.y),
+                                  "DeltaX",
+                                  DoubleValue(spacing),
+                                  "DeltaY",
+                                  DoubleValue(spacing),
+                                  "GridWidth",
+                                  UintegerValue(side),
+                                  "LayoutType",
+                                  StringValue("RowFirst"));
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(nodes);
+}
+
+void
+WifiBenchmark::SetupInfrastructure(bool mlo)
+{
+    const std::vector<uint8_t> channels5Ghz{36, 40, 44, 48};
+    const std::vector<uint8_t> channels6Ghz{1, 5, 9, 13};
+    const double bssSpacing{30};
+    const double staDistance{5};
+
+    auto nBss = std::max<uint32_t>(m_input.nNodes / 10, 1);
+    auto nStations = m_input.nNodes > nBss ? m_input.nNodes - nBss : 0;
+
+    std::map<FrequencyRange, Ptr<MultiModelSpectrumChannel>> spectrumChannels;
+    for (const auto& band : {WIFI_SPECTRUM_5_GHZ, WIFI_SPECTRUM_6_GHZ})
+    {
+        auto channel = CreateObject<MultiModelSpectrumChannel>();
+        channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+        channel->AddPropagationLossModel(CreateObject<LogDistancePropagationLossModel>());
+        spectrumChannels.emplace(band, channel);
+    }
+
+    WifiHelper wifi;
+    wifi.SetStandard(mlo ? WIFI_STANDARD_80211be : WIFI_STANDARD_80211ax);
+    m_standard = mlo ? "802.11be" : "802.11ax";
+
+    NodeContainer apNodes(nBss);
+    m_nodes.Add(apNodes);
+    PlaceOnGrid(apNodes, bssSpacing, Vector(0, 0, 0));
+
+    for (uint32_t bss = 0; bss < nBss; bss++)
+    {
+        SpectrumWifiPhyHelper phy(mlo ? 2 : 1);
+        auto channel5Ghz = channels5Ghz[bss % channels5Ghz.size()];
+        phy.Set(0,
+                "ChannelSettings",
+                StringValue("{" + std::to_string(channel5Ghz) + ", 20, BAND_5GHZ, 0}"));
+        phy.AddChannel(spectrumChannels.at(WIFI_SPECTRUM_5_GHZ), WIFI_SPECTRUM_5_GHZ);
+        if (mlo)
+        {
+            auto channel6Ghz = channels6Ghz[bss % channels6Ghz.size()];
+            phy.Set(1,
+                    "ChannelSettings",
+                    StringValue("{" + std::to_string(channel6Ghz) + ", 20, BAND_6GHZ, 0}"));
+            phy.AddChannel(spectrumChannels.at(WIFI_SPECTRUM_6_GHZ), WIFI_SPECTRUM_6_GHZ);
+        }
+
+        Ssid ssid("bss-" + std::to_string(bss));
+        WifiMacHelper mac;
+        mac.SetType("ns3::ApWifiMac", "Ssid", SsidValue(ssid));
+        auto apDevice = wifi.Install(phy, mac, apNodes.Get(bss));
+        m_apDevices.Add(apDevice);
+
+        // the stations are spread evenly across the BSSs
+        auto nBssStations = nStations / nBss + (bss < nStations % nBss ? 1 : 0);
+        NodeContainer staNodes(nBssStations);
+        m_nodes.Add(staNodes);
+        phy.Set("FixedPhyBand", BooleanValue(true));
+        mac.SetType("ns3::StaWifiMac",
+                    "Ssid",
+                    SsidValue(ssid),
+                    "ActiveProbing",
+                    BooleanValue(false));
+        auto staDevices = wifi.Install(phy, mac, staNodes);
+        m_staDevices.Add(staDevices);
+
+        // the stations on a circle around the access point
+        auto apPosition = apNodes.Get(bss)->GetObject<MobilityModel>()->GetPosition();
+        auto positionAlloc = CreateObject<ListPositionAllocator>();
+        for (uint32_t i = 0; i < nBssStations; i++)
+        {
+            auto angle = 2 * M_PI * i / nBssStations;
+            positionAlloc->Add(Vector(apPosition.x + staDistance * std::cos(angle),
+                                      apPosition.y + staDistance * std::sin(angle),
+                                      0));
+        }
+        MobilityHelper mobility;
+        mobility.SetPositionAllocator(positionAlloc);
+        mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+        mobility.Install(staNodes);
+
+        for (auto it = staDevices.Begin(); it != staDevices.End(); ++it)
+        {
+            AddFlow(*it, apDevice.Get(0));
+            AddFlow(apDevice.Get(0), *it);
+        }
+    }
+}
+
+void
+WifiBenchmark::SetupAdhoc()
+{
+    const double spacing{10};
+
+    auto channel = CreateObject<MultiModelSpectrumChannel>();
+    channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+    channel->AddPropagationLossModel(CreateObject<LogDistancePropagationLossModel>());
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    m_standard = "802.11ax";
+
+    SpectrumWifiPhyHelper phy;
+    phy.Set("ChannelSettings", StringValue("{36, 20, BAND_5GHZ, 0}"));
+    phy.SetChannel(channel);
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+
+    m_nodes.Create(m_input.nNodes);
+    m_staDevices = wifi.Install(phy, mac, m_nodes);
+    PlaceOnGrid(m_nodes, spacing, Vector(0, 0, 0));
+
+    // every station transmits to the next one on its row of the grid, the last
+    // station of a row to the previous one
+    auto side = static_cast<uint32_t>(std::ceil(std::sqrt(m_input.nNodes)));
+    for (uint32_t i = 0; i < m_input.nNodes; i++)
+    {
+        auto next = (i % side == side - 1 || i + 1 == m_input.nNodes) ? i - 1 : i + 1;
+        if (next < m_input.nNodes && next != i)
+        {
+            AddFlow(m_staDevices.Get(i), m_staDevices.Get(next));
+        }
+    }
+}
+
+#ifdef NS3_MESH
+void
+WifiBenchmark::SetupMesh()
+{
+    // the neighboring (including diagonal) mesh points are received above the
+    // default preamble detection threshold (-82 dBm) while the mesh points two
+    // columns away are received about 2 dB below it, so that the flows are
+    // forwarded
+    const double spacing{30};
+
+    auto channel = CreateObject<MultiModelSpectrumChannel>();
+    channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+    channel->AddPropagationLossModel(CreateObject<LogDistancePropagationLossModel>());
+
+    // the mesh interfaces are switched to channel 100
+    SpectrumWifiPhyHelper phy;
+    phy.Set("ChannelSettings", StringValue("{100, 20, BAND_5GHZ, 0}"));
+    phy.SetChannel(channel);
+
+    auto mesh = MeshHelper::Default();
+    mesh.SetStackInstaller("ns3::Dot11sStack");
+    mesh.SetSpreadInterfaceChannels(MeshHelper::ZERO_CHANNEL);
+    mesh.SetMacType("RandomStart", TimeValue(MilliSeconds(100)));
+    m_standard = "802.11a";
+
+    m_nodes.Create(m_input.nNodes);
+    m_staDevices = mesh.Install(phy, m_nodes);
+    mesh.AssignStreams(m_staDevices, 100);
+    PlaceOnGrid(m_nodes, spacing, Vector(0, 0, 0));
+
+    // every mesh point transmits to the mesh point two columns away on its row,
+    // the mesh points of the last two columns to the mesh point two columns back
+    auto side = static_cast<uint32_t>(std::ceil(std::sqrt(m_input.nNodes)));
+    for (uint32_t i = 0; i < m_input.nNodes; i++)
+    {
+        uint32_t next = i;
+        if (i % side + 2 < side && i + 2 < m_input.nNodes)
+        {
+            next = i + 2;
+        }
+        else if (i % side >= 2)
+        {
+            next = i - 2;
+        }
+        if (next != i)
+        {
+            AddFlow(m_staDevices.Get(i), m_staDevices.Get(next));
+        }
+    }
+}
+#endif
+
+void
+WifiBenchmark::AddFlow(Ptr<NetDevice> from, Ptr<NetDevice> to)
+{
+    PacketSocketAddress remote;
+    remote.SetSingleDevice(from->GetIfIndex());
+    remote.SetPhysicalAddress(to->GetAddress());
+    remote.SetProtocol(1);
+
+    auto client = CreateObject<PacketSocketClient>();
+    client->SetAttribute("PacketSize", UintegerValue(m_input.packetSize));
+    client->SetAttribute("MaxPackets", UintegerValue(0));
+    client->SetAttribute("Interval", TimeValue(m_input.interval));
+    client->SetRemote(remote);
+    from->GetNode()->AddApplication(client);
+    // the flows start at random times within an interval to avoid synchronization
+    client->SetStartTime(m_input.warmup + MicroSeconds(m_startRng->GetInteger()));
+    client->SetStopTime(m_input.warmup + m_input.duration);
+    m_nFlows++;
+}
+
+void
+WifiBenchmark::InstallServers()
+{
+    for (auto it = m_nodes.Begin(); it != m_nodes.End(); ++it)
+    {
+        PacketSocketAddress local;
+        local.SetSingleDevice((*it)->GetDevice(0)->GetIfIndex());
+        local.SetProtocol(1);
+
+        auto server = CreateObject<PacketSocketServer>();
+        server->SetLocal(local);
+        (*it)->AddApplication(server);
+        server->TraceConnectWithoutContext("Rx", MakeCallback(&WifiBenchmark::Received, this));
+    }
+}
+
+void
+WifiBenchmark::Received(Ptr<const Packet> packet, const Address& from)
+{
+    m_received++;
+}
+
+uint32_t
+WifiBenchmark::GetNAssociatedStations() const
+{
+    uint32_t nAssociated = 0;
+    for (auto it = m_staDevices.Begin(); it != m_staDevices.End(); ++it)
+    {
+        auto mac = DynamicCast<StaWifiMac>(DynamicCast<WifiNetDevice>(*it)->GetMac());
+        if (mac && mac->IsAssociated())
+        {
+            nAssociated++;
+        }
+    }
+    return nAssociated;
+}
+
+uint64_t
+WifiBenchmark::GetPeakRss()
+{
+#if defined(__linux__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#ifdef __APPLE__
+        return usage.ru_maxrss / 1024; // bytes
+#else
+        return usage.ru_maxrss; // KiB
+#endif
+    }
+#endif
+    return 0;
+}
+
+void
+WifiBenchmark::WriteJson(std::ostream& os,
+                         double elapsed,
+                         uint64_t nEvents,
+                         const std::map<std::string, uint64_t>& moduleCounts) const
+{
+    auto simulated = m_input.duration.GetSeconds();
+
+    os << "{\n"
+       << "  \"scenario\": \"" << m_input.scenario << "\",\n"
+       << "  \"standard\": \"" << m_standard << "\",\n"
+       << "  \"nodes\": " << m_nodes.GetN() << ",\n"
+       << "  \"access_points\": " << m_apDevices.GetN() << ",\n"
+       << "  \"stations\": " << m_staDevices.GetN() << ",\n";
+    if (m_apDevices.GetN() > 0)
+    {
+        os << "  \"associated_stations\": " << GetNAssociatedStations() << ",\n";
+    }
+    os << "  \"flows\": " << m_nFlows << ",\n"
+       << "  \"packets_received\": " << m_received << ",\n"
+       << "  \"simulated_time_s\": " << simulated << ",\n"
+       << "  \"warmup_time_s\": " << m_input.warmup.GetSeconds() << ",\n"
+       << "  \"wall_clock_time_s\": " << elapsed << ",\n"
+       << "  \"wall_clock_time_per_simulated_s\": " << elapsed / simulated << ",\n"
+       << "  \"events\": " << nEvents << ",\n"
+       << "  \"events_per_s\": " << (elapsed > 0 ? nEvents / elapsed : 0) << ",\n"
+       << "  \"peak_rss_kib\": " << GetPeakRss();
+    if (m_input.countModules)
+    {
+        os << ",\n  \"module_events\": {";
+        std::string sep{"\n"};
+        for (const auto& [module, count] : moduleCounts)
+        {
+            os << sep << "    \"" << module << "\": " << count;
+            sep = ",\n";
+        }
+        os << "\n  }";
+    }
+    os << "\n}" << std::endl;
+}
+
+void
+WifiBenchmark::Run(const Input& input, std::ostream& os)
+{
+    m_input = input;
+    m_startRng = CreateObject<UniformRandomVariable>();
+    m_startRng->SetAttribute("Min", DoubleValue(0));
+    m_startRng->SetAttribute("Max", DoubleValue(input.interval.GetMicroSeconds()));
+    m_startRng->SetStream(1);
+
+    if (input.scenario == "dense-ap")
+    {
+        SetupInfrastructure(false);
+    }
+    else if (input.scenario == "mlo")
+    {
+        SetupInfrastructure(true);
+    }
+    else if (input.scenario == "adhoc")
+    {
+        SetupAdhoc();
+    }
+    else if (input.scenario == "mesh")
+    {
+#ifdef NS3_MESH
+        SetupMesh();
+#else
+        NS_FATAL_ERROR("The mesh scenario requires the mesh module");
+#endif
+    }
+    else
+    {
+        NS_FATAL_ERROR("Unknown scenario: " << input.scenario);
+    }
+
+    int64_t streamNumber = 100;
+    streamNumber += WifiHelper::AssignStreams(m_apDevices, streamNumber);
+    streamNumber += WifiHelper::AssignStreams(m_staDevices, streamNumber);
+
+    PacketSocketHelper packetSocket;
+    packetSocket.Install(m_nodes);
+    InstallServers();
+
+    Ptr<ModuleCountingSimulatorImpl> counter;
+    if (input.countModules)
+    {
+        counter = DynamicCast<ModuleCountingSimulatorImpl>(Simulator::GetImplementation());
+    }
+
+    // the warmup is not part of the measurements
+    Simulator::Stop(input.warmup);
+    Simulator::Run();
+    m_received = 0;
+    auto nEvents = Simulator::GetEventCount();
+    if (counter)
+    {
+        counter->ResetModuleCounts();
+    }
+
+    Simulator::Stop(input.duration);
+    SystemWallClockMs timer;
+    timer.Start();
+    Simulator::Run();
+    double elapsed = timer.End() / 1000.0;
+    nEvents = Simulator::GetEventCount() - nEvents;
+
+    std::map<std::string, uint64_t> moduleCounts;
+    if (counter)
+    {
+        moduleCounts = counter->GetModuleCounts();
+    }
+    WriteJson(os, elapsed, nEvents, moduleCounts);
+
+    Simulator::Destroy();
+}
+
+int
+main(int argc, char* argv[])
+{
+    WifiBenchmark::Input input;
+    std::string json;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the Wi-Fi models with standard configurations and\n"
+              "write the wall clock time, the peak RSS and the events executed as JSON.");
+    cmd.AddValue("scenario", "Scenario (dense-ap, mlo, adhoc or mesh)", input.scenario);
+    cmd.AddValue("nodes", "Number of nodes", input.nNodes);
+    cmd.AddValue("duration", "Simulated time measured", input.duration);
+    cmd.AddValue("warmup", "Simulated time before the measurements", input.warmup);
+    cmd.AddValue("packetSize", "Size of the packets in bytes", input.packetSize);
+    cmd.AddValue("interval", "Time between two packets of a flow", input.interval);
+    cmd.AddValue("countModules", "Count the events executed per module", input.countModules);
+    cmd.AddValue("json", "File the results are written to (standard output if empty)", json);
+    cmd.Parse(argc, argv);
+
+    if (input.countModules)
+    {
+        Simulator::SetImplementation(CreateObject<ModuleCountingSimulatorImpl>());
+    }
+    RngSeedManager::SetSeed(1);
+
+    WifiBenchmark benchmark;
+    if (json.empty())
+    {
+        benchmark.Run(input, std::cout);
+    }
+    else
+    {
+        std::ofstream os(json);
+        NS_ABORT_MSG_IF(!os.is_open(), "Cannot open " << json);
+        benchmark.Run(input, os);
+    }
+    return 0;
+}